@@ -16,6 +16,7 @@
 #ifndef ACCESSIBILITY_ELEMENT_OPERATOR_CALLBACK_PROXY_H
 #define ACCESSIBILITY_ELEMENT_OPERATOR_CALLBACK_PROXY_H
 
+#include <atomic>
 #include "accessibility_ipc_interface_code.h"
 #include "i_accessibility_element_operator_callback.h"
 #include "iremote_proxy.h"
@@ -81,6 +82,13 @@ public:
      */
     void SetCursorPositionResult(const int32_t cursorPosition, const int32_t requestId) override;
 
+    /**
+     * @brief Enable or disable the shared memory transport of the search results by accessibility id.
+     *        When enabled, results larger than one parcel chunk are sent in one anonymous shared memory region.
+     * @param enabled True: Use shared memory for large results; otherwise always use chunked parcels.
+     */
+    static void SetAshmemTransmitEnabled(const bool enabled);
+
 private:
     /**
      * @brief Write the descriptor of IPC.
@@ -102,6 +110,22 @@ private:
 
     int32_t GetTransmitFlag(int32_t time, int32_t leftSize);
 
+    /**
+     * @brief Send the element infos in one anonymous shared memory region.
+     * @param infos The element info searched by accessibility id.
+     * @param requestId The request id from AA, it is used to match with request and response.
+     * @return true: The infos are sent; otherwise the caller should fall back to chunked parcels.
+     */
+    bool SendElementInfosByAshmem(const std::vector<AccessibilityElementInfo> &infos, const int32_t requestId);
+
+    /**
+     * @brief Send the element infos in chunks of parcels.
+     * @param infos The element info searched by accessibility id.
+     * @param requestId The request id from AA, it is used to match with request and response.
+     */
+    void SendElementInfosByParcel(const std::vector<AccessibilityElementInfo> &infos, const int32_t requestId);
+
+    static std::atomic<bool> ashmemTransmitEnabled_;
     static inline BrokerDelegator<AccessibilityElementOperatorCallbackProxy> delegator;
 };
 } // namespace Accessibility
@@ -16,6 +16,7 @@
 #ifndef ACCESSIBILITY_ELEMENT_OPERATOR_CALLBACK_STUB_H
 #define ACCESSIBILITY_ELEMENT_OPERATOR_CALLBACK_STUB_H
 
+#include <chrono>
 #include <map>
 #include "i_accessibility_element_operator_callback.h"
 #include "iremote_stub.h"
@@ -24,15 +25,35 @@
 namespace OHOS {
 namespace Accessibility {
 
+/*
+* Reassembles the chunked results of SetSearchElementInfoByAccessibilityIdResult.
+* Every request id owns its own buffer, so concurrent transfers never share storage.
+* Transfers whose sender stopped before the final chunk are dropped after STORE_DATA_EXPIRE_TIME.
+*/
 class StoreElementData {
 public:
+    static constexpr int64_t STORE_DATA_EXPIRE_TIME = 10000; // ms
+
     StoreElementData() = default;
     ~StoreElementData() = default;
-    void WriteData(std::vector<AccessibilityElementInfo> &infos);
-    std::vector<AccessibilityElementInfo> ReadData();
-    size_t Size();
-    void Clear();
-    std::vector<AccessibilityElementInfo> storeData_ = {};
+    bool WriteData(const int32_t requestId, std::vector<AccessibilityElementInfo> &infos, const bool isFirst);
+    std::vector<AccessibilityElementInfo> ReadData(const int32_t requestId);
+    bool MarkFailed(const int32_t requestId);
+    size_t Size(const int32_t requestId);
+    size_t TransferCount();
+    void Clear(const int32_t requestId);
+
+private:
+    struct Transfer {
+        std::vector<AccessibilityElementInfo> data {};
+        std::chrono::steady_clock::time_point updateTime {};
+        // a chunk failed to read, the later chunks are dropped until the next transfer starts
+        bool failed = false;
+    };
+
+    void RemoveExpiredLocked(const std::chrono::steady_clock::time_point &now);
+
+    std::map<int32_t, Transfer> storeData_ {};
     ffrt::mutex mutex_;
 };
 
@@ -63,7 +84,16 @@ public:
     virtual int OnRemoteRequest(uint32_t code, MessageParcel &data, MessageParcel &reply,
         MessageOption &option) override;
 
-    static StoreElementData storeElementData;
+protected:
+    /**
+     * @brief Deliver a completely reassembled search result. The default implementation forwards
+     *        to SetSearchElementInfoByAccessibilityIdResult, override it to take ownership of the infos.
+     * @param infos The elements info searched by accessibility id.
+     * @param requestId The request id from AA, it is used to match with request and response.
+     */
+    virtual void OnSearchElementInfoByAccessibilityIdResult(std::vector<AccessibilityElementInfo> &&infos,
+        const int32_t requestId);
+
 private:
     /**
      * @brief Handle the IPC request for the function:SetSearchElementInfoByAccessibilityIdResult.
@@ -73,6 +103,15 @@ private:
      */
     ErrCode HandleSetSearchElementInfoByAccessibilityIdResult(MessageParcel &data, MessageParcel &reply);
 
+    /**
+     * @brief Handle the IPC request for the function:SetSearchElementInfoByAccessibilityIdResult
+     *        whose infos are sent in one anonymous shared memory region.
+     * @param data The data of process communication
+     * @param reply The response of IPC request
+     * @return NO_ERROR: successful; otherwise is failed.
+     */
+    ErrCode HandleSetSearchElementInfoByAccessibilityIdResultByAshmem(MessageParcel &data, MessageParcel &reply);
+
     /**
      * @brief Handle the IPC request for the function:SetSearchElementInfoByTextResult.
      * @param data The data of process communication
@@ -113,8 +152,12 @@ private:
      */
     ErrCode HandleSetCursorPositionResult(MessageParcel &data, MessageParcel &reply);
 
+    void FailSearchElementInfoTransfer(const int32_t flag, const int32_t requestId);
+
     using AccessibilityElementOperatorCallbackFunc =
         ErrCode (AccessibilityElementOperatorCallbackStub::*)(MessageParcel &data, MessageParcel &reply);
+
+    StoreElementData storeElementData_;
 };
 } // namespace Accessibility
 } // namespace OHOS
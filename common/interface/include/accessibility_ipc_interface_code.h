@@ -25,6 +25,7 @@ namespace Accessibility {
         SET_RESULT_FOCUS_MOVE,
         SET_RESULT_PERFORM_ACTION,
         SET_RESULT_CURSOR_RESULT,
+        SET_RESULT_BY_ACCESSIBILITY_ID_ASHMEM,
 
         SEARCH_BY_ACCESSIBILITY_ID = 200,
         SEARCH_BY_TEXT,
@@ -142,6 +143,7 @@ namespace Accessibility {
         GET_SHORTKEY_MULTI_TARGET,
         GET_ROOT_PARENT_ID,
         GET_ALL_TREE_ID,
+        SEND_EVENTS,
 
         ON_STATE_CHANGED = 900,
     };
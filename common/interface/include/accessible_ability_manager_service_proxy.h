@@ -45,6 +45,13 @@ public:
      */
     virtual RetError SendEvent(const AccessibilityEventInfo &uiEvent, const int32_t flag) override;
 
+    /**
+     * @brief Sends a batch of accessibility events in one request.
+     * @param uiEvents Indicates the accessibility events, in the order they were generated.
+     * @return Returns RET_OK if successful, otherwise refer to the RetError for the failure.
+     */
+    virtual RetError SendEvents(const std::vector<AccessibilityEventInfo> &uiEvents, const int32_t flag) override;
+
     /**
      * @brief Register the state observer of AAMS.
      * @param callback state observer
@@ -75,6 +75,14 @@ private:
      */
     ErrCode HandleSendEvent(MessageParcel &data, MessageParcel &reply);
 
+    /**
+     * @brief Handle the IPC request for the function:HandleSendEvents.
+     * @param data The data of process communication
+     * @param reply The response of IPC request
+     * @return NO_ERROR: successful; otherwise is failed.
+     */
+    ErrCode HandleSendEvents(MessageParcel &data, MessageParcel &reply);
+
     /**
      * @brief Handle the IPC request for the function:HandleRegisterStateCallback.
      * @param data The data of process communication
@@ -91,8 +91,26 @@ public:
     {
         return isFilter;
     }
+
+    /**
+     * @brief Set the groups of element info fields to be returned, refer to ElementFieldMask.
+     * @param mask The field mask of the search request.
+     */
+    void SetFieldMask(uint32_t mask)
+    {
+        fieldMask = mask;
+    }
+
+    /**
+     * @brief Get the groups of element info fields to be returned.
+     */
+    uint32_t GetFieldMask()
+    {
+        return fieldMask;
+    }
 private:
    bool isFilter = false;
+   uint32_t fieldMask = ELEMENT_FIELD_ALL;
 };
 } // namespace Accessibility
 } // namespace OHOS
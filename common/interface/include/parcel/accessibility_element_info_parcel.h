@@ -16,11 +16,24 @@
 #ifndef ACCESSIBILITY_ELEMENT_INFO_PARCEL_H
 #define ACCESSIBILITY_ELEMENT_INFO_PARCEL_H
 
+#include <array>
+#include <atomic>
 #include "accessibility_element_info.h"
 #include "parcel.h"
 
 namespace OHOS {
 namespace Accessibility {
+/*
+* The wire format of AccessibilityElementInfoParcel, written as the first word of every element.
+* LEGACY writes every field one by one, nested types as separate parcelables.
+* COMPACT packs the bools into one word, writes nested types inline and skips
+* the fields which keep their default values, marked by a presence mask.
+*/
+enum ElementInfoParcelVersion : int32_t {
+    ELEMENT_INFO_PARCEL_VERSION_LEGACY = 1,
+    ELEMENT_INFO_PARCEL_VERSION_COMPACT = 2,
+};
+
 /*
 * class define the action on Accessibility info
 */
@@ -318,6 +331,14 @@ public:
      */
     explicit AccessibilityElementInfoParcel(const AccessibilityElementInfo &elementInfo);
 
+    /**
+     * @brief Construct, the field groups absent from the mask keep their default values
+     *        so that the compact format skips them.
+     * @param elementInfo The object of AccessibilityElementInfo.
+     * @param fieldMask The groups of fields to be written, refer to ElementFieldMask.
+     */
+    AccessibilityElementInfoParcel(const AccessibilityElementInfo &elementInfo, const uint32_t fieldMask);
+
     /**
      * @brief Used for IPC communication
      * @param parcel
@@ -345,7 +366,108 @@ public:
      */
     static sptr<AccessibilityElementInfoParcel> Unmarshalling(Parcel &parcel);
 
+    /**
+     * @brief Set the wire format used by Marshalling, ReadFromParcel accepts both formats.
+     * @param version The version of the wire format, COMPACT by default.
+     */
+    static void SetMarshallingVersion(const ElementInfoParcelVersion version);
+
 private:
+    static constexpr size_t PACKED_BOOL_COUNT = 21;
+    static constexpr size_t OPTIONAL_STRING_COUNT = 16;
+
+    /**
+     * @brief Get the bool fields packed into the flags of the compact format, in bit order.
+     * @param info The element info, const or not.
+     */
+    template<typename Info>
+    static auto GetPackedBools(Info &info) -> std::array<decltype(&info.checkable_), PACKED_BOOL_COUNT>;
+
+    /**
+     * @brief Get the string fields gated by the presence mask of the compact format, in bit order.
+     * @param info The element info, const or not.
+     */
+    template<typename Info>
+    static auto GetOptionalStrings(Info &info) -> std::array<decltype(&info.text_), OPTIONAL_STRING_COUNT>;
+
+    /**
+     * @brief Reset the field groups absent from the mask to their default values.
+     * @param fieldMask The groups of fields to be kept, refer to ElementFieldMask.
+     */
+    void ProjectFields(const uint32_t fieldMask);
+
+    /**
+     * @brief Read the legacy format, every field one by one.
+     * @param parcel
+     */
+    bool ReadFromParcelLegacy(Parcel &parcel);
+
+    /**
+     * @brief Write the legacy format, every field one by one.
+     * @param parcel
+     */
+    bool MarshallingLegacy(Parcel &parcel) const;
+
+    /**
+     * @brief Read the compact format, the fields absent from the presence mask keep their default values.
+     * @param parcel
+     */
+    bool ReadFromParcelCompact(Parcel &parcel);
+
+    /**
+     * @brief Read the nested types written inline by the compact format.
+     * @param parcel
+     * @param presenceMask The presence mask of the optional fields.
+     */
+    bool ReadFromParcelCompactNested(Parcel &parcel, const uint32_t presenceMask);
+
+    /**
+     * @brief Read the optional groups of numeric fields of the compact format.
+     * @param parcel
+     * @param presenceMask The presence mask of the optional fields.
+     */
+    bool ReadFromParcelCompactGroups(Parcel &parcel, const uint32_t presenceMask);
+
+    /**
+     * @brief Read the containers of the compact format.
+     * @param parcel
+     * @param presenceMask The presence mask of the optional fields.
+     */
+    bool ReadFromParcelCompactContainers(Parcel &parcel, const uint32_t presenceMask);
+
+    /**
+     * @brief Write the compact format.
+     * @param parcel
+     */
+    bool MarshallingCompact(Parcel &parcel) const;
+
+    /**
+     * @brief Write the nested types inline for the compact format.
+     * @param parcel
+     * @param presenceMask The presence mask of the optional fields.
+     */
+    bool MarshallingCompactNested(Parcel &parcel, const uint32_t presenceMask) const;
+
+    /**
+     * @brief Write the optional groups of numeric fields for the compact format.
+     * @param parcel
+     * @param presenceMask The presence mask of the optional fields.
+     */
+    bool MarshallingCompactGroups(Parcel &parcel, const uint32_t presenceMask) const;
+
+    /**
+     * @brief Write the containers for the compact format.
+     * @param parcel
+     * @param presenceMask The presence mask of the optional fields.
+     */
+    bool MarshallingCompactContainers(Parcel &parcel, const uint32_t presenceMask) const;
+
+    /**
+     * @brief Calculate which optional fields differ from their default values.
+     * @return The presence mask of the optional fields.
+     */
+    uint32_t GetPresenceMask() const;
+
      /**
      * @brief Used for IPC communication first part
      * @param parcel
@@ -394,6 +516,8 @@ private:
      * @sysCap Accessibility
      */
     bool MarshallingThirdPart(Parcel &parcel) const;
+
+    static std::atomic<int32_t> marshallingVersion_;
 };
 } // namespace Accessibility
 } // namespace OHOS
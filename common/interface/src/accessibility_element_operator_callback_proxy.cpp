@@ -15,6 +15,7 @@
 
 #include "accessibility_element_operator_callback_proxy.h"
 #include "accessibility_element_info_parcel.h"
+#include "ashmem.h"
 #include "hilog_wrapper.h"
 
 namespace OHOS {
@@ -24,6 +25,10 @@ constexpr int32_t IPC_MEMORY_SIZE = 500 * 1024; // default size is 200 * 1024B,
 constexpr int32_t SINGLE_TRANSMIT = -2;
 constexpr int32_t MULTI_TRANSMIT_FINISH = -1;
 constexpr int32_t DATA_NUMBER_ONE_TIME = 800;
+constexpr int32_t MAX_ASHMEM_TRANSMIT_SIZE = 128 * 1024 * 1024; // keep the same with the receiver
+constexpr const char *ASHMEM_TRANSMIT_NAME = "AccessibilityElementInfos";
+
+std::atomic<bool> AccessibilityElementOperatorCallbackProxy::ashmemTransmitEnabled_ = true;
 
 AccessibilityElementOperatorCallbackProxy::AccessibilityElementOperatorCallbackProxy(
     const sptr<IRemoteObject> &impl) : IRemoteProxy<IAccessibilityElementOperatorCallback>(impl)
@@ -72,13 +77,71 @@ int32_t AccessibilityElementOperatorCallbackProxy::GetTransmitFlag(int32_t time,
     return flag;
 }
 
+void AccessibilityElementOperatorCallbackProxy::SetAshmemTransmitEnabled(const bool enabled)
+{
+    HILOG_INFO("enabled %{public}d", enabled);
+    ashmemTransmitEnabled_.store(enabled);
+}
+
 void AccessibilityElementOperatorCallbackProxy::SetSearchElementInfoByAccessibilityIdResult(
     const std::vector<AccessibilityElementInfo> &infos, const int32_t requestId)
 {
     HILOG_DEBUG("infos size %{public}zu, resquestId %{public}d", infos.size(), requestId);
+    // small results fit in one parcel, the shared memory setup costs more than it saves
+    if (ashmemTransmitEnabled_.load() && infos.size() > static_cast<size_t>(DATA_NUMBER_ONE_TIME)) {
+        if (SendElementInfosByAshmem(infos, requestId)) {
+            return;
+        }
+        HILOG_WARN("send by ashmem failed, fall back to parcels, resquestId %{public}d", requestId);
+    }
+    SendElementInfosByParcel(infos, requestId);
+}
+
+bool AccessibilityElementOperatorCallbackProxy::SendElementInfosByAshmem(
+    const std::vector<AccessibilityElementInfo> &infos, const int32_t requestId)
+{
+    Parcel payload;
+    payload.SetMaxCapacity(MAX_ASHMEM_TRANSMIT_SIZE);
+    uint32_t fieldMask = GetFieldMask();
+    for (auto &info : infos) {
+        AccessibilityElementInfoParcel infoParcel(info, fieldMask);
+        if (!payload.WriteParcelable(&infoParcel)) {
+            HILOG_ERROR("write element info to payload failed, size %{public}zu", payload.GetDataSize());
+            return false;
+        }
+    }
+
+    int32_t payloadSize = static_cast<int32_t>(payload.GetDataSize());
+    sptr<Ashmem> ashmem = Ashmem::CreateAshmem(ASHMEM_TRANSMIT_NAME, payloadSize);
+    if (!ashmem) {
+        HILOG_ERROR("create ashmem failed, size %{public}d", payloadSize);
+        return false;
+    }
+    if (!ashmem->MapReadAndWriteAshmem() ||
+        !ashmem->WriteToAshmem(reinterpret_cast<const void *>(payload.GetData()), payloadSize, 0)) {
+        HILOG_ERROR("write to ashmem failed, size %{public}d", payloadSize);
+        ashmem->CloseAshmem();
+        return false;
+    }
+    ashmem->UnmapAshmem();
+
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option(MessageOption::TF_ASYNC);
+    bool result = WriteInterfaceToken(data) && data.WriteInt32(static_cast<int32_t>(infos.size())) &&
+        data.WriteInt32(payloadSize) && data.WriteAshmem(ashmem) && data.WriteInt32(requestId) &&
+        SendTransactCmd(AccessibilityInterfaceCode::SET_RESULT_BY_ACCESSIBILITY_ID_ASHMEM, data, reply, option);
+    ashmem->CloseAshmem();
+    return result;
+}
+
+void AccessibilityElementOperatorCallbackProxy::SendElementInfosByParcel(
+    const std::vector<AccessibilityElementInfo> &infos, const int32_t requestId)
+{
     int32_t leftSize = static_cast<int32_t>(infos.size());
     int32_t time = 0;
     int32_t index = 0;
+    uint32_t fieldMask = GetFieldMask();
     while (leftSize >= 0) {
         MessageParcel data;
         MessageParcel reply;
@@ -102,13 +165,18 @@ void AccessibilityElementOperatorCallbackProxy::SetSearchElementInfoByAccessibil
             return;
         }
 
+        // the request id goes ahead of the infos, so the receiver can fail the request on a bad chunk
+        if (!data.WriteInt32(requestId)) {
+            return;
+        }
+
         int32_t writeSize = (leftSize <= DATA_NUMBER_ONE_TIME) ? leftSize : DATA_NUMBER_ONE_TIME;
         if (!data.WriteInt32(writeSize)) {
             return;
         }
 
         for (int32_t i = 0; i < writeSize; ++i) {
-            AccessibilityElementInfoParcel infoParcel(infos[index]);
+            AccessibilityElementInfoParcel infoParcel(infos[index], fieldMask);
             index++;
             if (!data.WriteParcelable(&infoParcel)) {
                 HILOG_ERROR("accessibility element info failed index %{public}d", index);
@@ -116,10 +184,6 @@ void AccessibilityElementOperatorCallbackProxy::SetSearchElementInfoByAccessibil
             }
         }
 
-        if (!data.WriteInt32(requestId)) {
-            return;
-        }
-
         if (!SendTransactCmd(AccessibilityInterfaceCode::SET_RESULT_BY_ACCESSIBILITY_ID, data, reply, option)) {
             HILOG_ERROR("set search element info by accessibility id result failed");
             return;
@@ -151,8 +215,9 @@ void AccessibilityElementOperatorCallbackProxy::SetSearchElementInfoByTextResult
         return;
     }
 
+    uint32_t fieldMask = GetFieldMask();
     for (auto &info : infos) {
-        AccessibilityElementInfoParcel infoParcel(info);
+        AccessibilityElementInfoParcel infoParcel(info, fieldMask);
         if (!data.WriteParcelable(&infoParcel)) {
             HILOG_ERROR("write accessibility element info failed");
             return;
@@ -178,7 +243,7 @@ void AccessibilityElementOperatorCallbackProxy::SetFindFocusedElementInfoResult(
     MessageParcel data;
     MessageParcel reply;
     MessageOption option(MessageOption::TF_ASYNC);
-    AccessibilityElementInfoParcel infoParcel(info);
+    AccessibilityElementInfoParcel infoParcel(info, GetFieldMask());
 
     if (!WriteInterfaceToken(data)) {
         HILOG_ERROR("connection write token failed");
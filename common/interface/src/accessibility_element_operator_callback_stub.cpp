@@ -16,8 +16,10 @@
 #include "accessibility_element_operator_callback_stub.h"
 #include "accessibility_element_info_parcel.h"
 #include "accessibility_ipc_interface_code.h"
+#include "ashmem.h"
 #include "hilog_wrapper.h"
 #include "parcel_util.h"
+#include "securec.h"
 
 #define SWITCH_BEGIN(code) switch (code) {
 #define SWITCH_CASE(case_code, func) case case_code:\
@@ -42,6 +44,8 @@
     SWITCH_CASE(AccessibilityInterfaceCode::SET_RESULT_FOCUS_MOVE, HandleSetFocusMoveSearchResult)\
     SWITCH_CASE(AccessibilityInterfaceCode::SET_RESULT_PERFORM_ACTION, HandleSetExecuteActionResult)\
     SWITCH_CASE(AccessibilityInterfaceCode::SET_RESULT_CURSOR_RESULT, HandleSetCursorPositionResult)\
+    SWITCH_CASE(AccessibilityInterfaceCode::SET_RESULT_BY_ACCESSIBILITY_ID_ASHMEM, \
+        HandleSetSearchElementInfoByAccessibilityIdResultByAshmem)\
 
 namespace OHOS {
 namespace Accessibility {
@@ -49,40 +53,100 @@ namespace Accessibility {
 constexpr int32_t SINGLE_TRANSMIT = -2;
 constexpr int32_t MULTI_TRANSMIT_FINISH = -1;
 constexpr int32_t ERR_CODE_DEFAULT = -1000;
+constexpr int32_t MAX_ASHMEM_TRANSMIT_SIZE = 128 * 1024 * 1024; // keep the same with the sender
 
-void StoreElementData::WriteData(std::vector<AccessibilityElementInfo> &infos)
+bool StoreElementData::WriteData(const int32_t requestId, std::vector<AccessibilityElementInfo> &infos,
+    const bool isFirst)
 {
-    HILOG_DEBUG();
+    HILOG_DEBUG("requestId %{public}d, isFirst %{public}d", requestId, isFirst);
     std::lock_guard<ffrt::mutex> lock(mutex_);
-    storeData_.insert(storeData_.end(), infos.begin(), infos.end());
+    auto now = std::chrono::steady_clock::now();
+    if (isFirst) {
+        RemoveExpiredLocked(now);
+        storeData_[requestId] = Transfer {};
+    }
+
+    Transfer &transfer = storeData_[requestId];
+    transfer.updateTime = now;
+    if (transfer.failed) {
+        HILOG_WARN("drop the chunk of failed requestId %{public}d", requestId);
+        return false;
+    }
+    if (transfer.data.empty()) {
+        transfer.data = std::move(infos);
+    } else {
+        transfer.data.insert(transfer.data.end(), std::make_move_iterator(infos.begin()),
+            std::make_move_iterator(infos.end()));
+    }
+    return true;
 }
 
-void StoreElementData::Clear()
+std::vector<AccessibilityElementInfo> StoreElementData::ReadData(const int32_t requestId)
 {
-    HILOG_DEBUG();
+    HILOG_DEBUG("requestId %{public}d", requestId);
     std::lock_guard<ffrt::mutex> lock(mutex_);
-    storeData_.clear();
+    auto iter = storeData_.find(requestId);
+    if (iter == storeData_.end()) {
+        return {};
+    }
+    std::vector<AccessibilityElementInfo> infos = std::move(iter->second.data);
+    storeData_.erase(iter);
+    return infos;
 }
 
-std::vector<AccessibilityElementInfo> StoreElementData::ReadData()
+bool StoreElementData::MarkFailed(const int32_t requestId)
 {
-    HILOG_DEBUG();
+    HILOG_DEBUG("requestId %{public}d", requestId);
     std::lock_guard<ffrt::mutex> lock(mutex_);
-    return storeData_;
+    Transfer &transfer = storeData_[requestId];
+    transfer.data.clear();
+    transfer.updateTime = std::chrono::steady_clock::now();
+    if (transfer.failed) {
+        return false;
+    }
+    transfer.failed = true;
+    return true;
 }
 
-size_t StoreElementData::Size()
+size_t StoreElementData::Size(const int32_t requestId)
 {
     HILOG_DEBUG();
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto iter = storeData_.find(requestId);
+    if (iter == storeData_.end()) {
+        return 0;
+    }
+    return iter->second.data.size();
+}
+
+size_t StoreElementData::TransferCount()
+{
     std::lock_guard<ffrt::mutex> lock(mutex_);
     return storeData_.size();
 }
 
-AccessibilityElementOperatorCallbackStub::AccessibilityElementOperatorCallbackStub()
+void StoreElementData::Clear(const int32_t requestId)
 {
+    HILOG_DEBUG("requestId %{public}d", requestId);
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    storeData_.erase(requestId);
 }
 
-StoreElementData AccessibilityElementOperatorCallbackStub::storeElementData;
+void StoreElementData::RemoveExpiredLocked(const std::chrono::steady_clock::time_point &now)
+{
+    for (auto iter = storeData_.begin(); iter != storeData_.end();) {
+        if (now - iter->second.updateTime > std::chrono::milliseconds(STORE_DATA_EXPIRE_TIME)) {
+            HILOG_WARN("drop expired transfer of requestId %{public}d", iter->first);
+            iter = storeData_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+AccessibilityElementOperatorCallbackStub::AccessibilityElementOperatorCallbackStub()
+{
+}
 
 AccessibilityElementOperatorCallbackStub::~AccessibilityElementOperatorCallbackStub()
 {
@@ -112,43 +176,143 @@ int AccessibilityElementOperatorCallbackStub::OnRemoteRequest(uint32_t code, Mes
     return IPCObjectStub::OnRemoteRequest(code, data, reply, option);
 }
 
+void AccessibilityElementOperatorCallbackStub::OnSearchElementInfoByAccessibilityIdResult(
+    std::vector<AccessibilityElementInfo> &&infos, const int32_t requestId)
+{
+    SetSearchElementInfoByAccessibilityIdResult(infos, requestId);
+}
+
 ErrCode AccessibilityElementOperatorCallbackStub::HandleSetSearchElementInfoByAccessibilityIdResult(
     MessageParcel &data, MessageParcel &reply)
 {
     HILOG_DEBUG();
     int32_t flag = data.ReadInt32();
-    if (flag == SINGLE_TRANSMIT || flag == 0) {
-        storeElementData.Clear();
-    }
-
+    int32_t requestId = data.ReadInt32();
     int32_t accessibilityInfosize = data.ReadInt32();
     std::vector<AccessibilityElementInfo> tmpData;
     bool verifyResult = ContainerSecurityVerify(data, accessibilityInfosize, tmpData.max_size());
     if (!verifyResult || accessibilityInfosize < 0 || accessibilityInfosize > INT32_MAX) {
+        FailSearchElementInfoTransfer(flag, requestId);
+        reply.WriteInt32(RET_ERR_FAILED);
         return TRANSACTION_ERR;
     }
+    tmpData.reserve(accessibilityInfosize);
     for (int32_t i = 0; i < accessibilityInfosize; i++) {
         sptr<AccessibilityElementInfoParcel> accessibilityInfo =
             data.ReadStrongParcelable<AccessibilityElementInfoParcel>();
         if (!accessibilityInfo) {
-            HILOG_ERROR("ReadStrongParcelable<accessibilityInfo> failed");
-            storeElementData.Clear();
+            HILOG_ERROR("ReadStrongParcelable<accessibilityInfo> failed, requestId %{public}d", requestId);
+            FailSearchElementInfoTransfer(flag, requestId);
             reply.WriteInt32(RET_ERR_FAILED);
             return TRANSACTION_ERR;
         }
-        tmpData.push_back(*accessibilityInfo);
+        tmpData.emplace_back(std::move(static_cast<AccessibilityElementInfo &>(*accessibilityInfo)));
     }
 
-    storeElementData.WriteData(tmpData); // get all data and push once
-    int32_t requestId = data.ReadInt32();
-    if (flag == SINGLE_TRANSMIT || flag == MULTI_TRANSMIT_FINISH) {
-        reply.WriteInt32(0);
-        HILOG_DEBUG("infos size %{public}zu, requestId %{public}d", storeElementData.Size(), requestId);
-        SetSearchElementInfoByAccessibilityIdResult(storeElementData.ReadData(), requestId);
+    reply.WriteInt32(0);
+    if (flag == SINGLE_TRANSMIT) {
+        HILOG_DEBUG("infos size %{public}zu, requestId %{public}d", tmpData.size(), requestId);
+        OnSearchElementInfoByAccessibilityIdResult(std::move(tmpData), requestId);
         return NO_ERROR;
     }
 
-    reply.WriteInt32(0);
+    bool isKept = storeElementData_.WriteData(requestId, tmpData, flag == 0);
+    if (flag == MULTI_TRANSMIT_FINISH) {
+        std::vector<AccessibilityElementInfo> infos = storeElementData_.ReadData(requestId);
+        if (!isKept) {
+            // the empty result of the failed transfer is already delivered
+            return NO_ERROR;
+        }
+        HILOG_DEBUG("infos size %{public}zu, requestId %{public}d", infos.size(), requestId);
+        OnSearchElementInfoByAccessibilityIdResult(std::move(infos), requestId);
+    }
+    return NO_ERROR;
+}
+
+void AccessibilityElementOperatorCallbackStub::FailSearchElementInfoTransfer(const int32_t flag,
+    const int32_t requestId)
+{
+    // The sender stops after a failed chunk, so answer the request with an empty result now instead of a
+    // truncated tree. The mark drops any later chunk of the transfer until it finishes or expires.
+    bool isFirstFailure = storeElementData_.MarkFailed(requestId);
+    if (flag == SINGLE_TRANSMIT || flag == MULTI_TRANSMIT_FINISH) {
+        storeElementData_.Clear(requestId);
+    }
+    if (isFirstFailure) {
+        OnSearchElementInfoByAccessibilityIdResult(std::vector<AccessibilityElementInfo> {}, requestId);
+    }
+}
+
+ErrCode AccessibilityElementOperatorCallbackStub::HandleSetSearchElementInfoByAccessibilityIdResultByAshmem(
+    MessageParcel &data, MessageParcel &reply)
+{
+    HILOG_DEBUG();
+    // The call is async, so every failure still answers the request with an empty result as the parcel path
+    // does, otherwise the caller waits out its timeout.
+    int32_t accessibilityInfosize = data.ReadInt32();
+    int32_t payloadSize = data.ReadInt32();
+    sptr<Ashmem> ashmem = data.ReadAshmem();
+    int32_t requestId = data.ReadInt32();
+    if (!ashmem) {
+        HILOG_ERROR("ReadAshmem failed, requestId %{public}d", requestId);
+        FailSearchElementInfoTransfer(SINGLE_TRANSMIT, requestId);
+        return TRANSACTION_ERR;
+    }
+    if (accessibilityInfosize < 0 || payloadSize <= 0 || payloadSize > MAX_ASHMEM_TRANSMIT_SIZE ||
+        payloadSize > ashmem->GetAshmemSize() || !ashmem->MapReadOnlyAshmem()) {
+        HILOG_ERROR("invalid ashmem, size %{public}d, requestId %{public}d", payloadSize, requestId);
+        ashmem->CloseAshmem();
+        FailSearchElementInfoTransfer(SINGLE_TRANSMIT, requestId);
+        return TRANSACTION_ERR;
+    }
+
+    // copy out of the shared region first, so the sender can not modify the data while it is parsed
+    const void *buffer = ashmem->ReadFromAshmem(payloadSize, 0);
+    void *payloadData = buffer ? malloc(payloadSize) : nullptr;
+    if (!payloadData) {
+        HILOG_ERROR("read ashmem failed, requestId %{public}d", requestId);
+        ashmem->UnmapAshmem();
+        ashmem->CloseAshmem();
+        FailSearchElementInfoTransfer(SINGLE_TRANSMIT, requestId);
+        return TRANSACTION_ERR;
+    }
+    errno_t copyResult = memcpy_s(payloadData, payloadSize, buffer, payloadSize);
+    ashmem->UnmapAshmem();
+    ashmem->CloseAshmem();
+    if (copyResult != EOK) {
+        HILOG_ERROR("copy ashmem failed, requestId %{public}d", requestId);
+        free(payloadData);
+        FailSearchElementInfoTransfer(SINGLE_TRANSMIT, requestId);
+        return TRANSACTION_ERR;
+    }
+
+    Parcel payload;
+    payload.SetMaxCapacity(MAX_ASHMEM_TRANSMIT_SIZE);
+    if (!payload.ParseFrom(reinterpret_cast<uintptr_t>(payloadData), payloadSize)) {
+        free(payloadData);
+        FailSearchElementInfoTransfer(SINGLE_TRANSMIT, requestId);
+        return TRANSACTION_ERR;
+    }
+
+    std::vector<AccessibilityElementInfo> infos;
+    if (!ContainerSecurityVerify(payload, accessibilityInfosize, infos.max_size())) {
+        FailSearchElementInfoTransfer(SINGLE_TRANSMIT, requestId);
+        return TRANSACTION_ERR;
+    }
+    infos.reserve(accessibilityInfosize);
+    for (int32_t i = 0; i < accessibilityInfosize; i++) {
+        sptr<AccessibilityElementInfoParcel> accessibilityInfo =
+            payload.ReadStrongParcelable<AccessibilityElementInfoParcel>();
+        if (!accessibilityInfo) {
+            HILOG_ERROR("ReadStrongParcelable<accessibilityInfo> failed, index %{public}d", i);
+            FailSearchElementInfoTransfer(SINGLE_TRANSMIT, requestId);
+            return TRANSACTION_ERR;
+        }
+        infos.emplace_back(std::move(static_cast<AccessibilityElementInfo &>(*accessibilityInfo)));
+    }
+
+    HILOG_DEBUG("infos size %{public}zu, requestId %{public}d", infos.size(), requestId);
+    OnSearchElementInfoByAccessibilityIdResult(std::move(infos), requestId);
     return NO_ERROR;
 }
 
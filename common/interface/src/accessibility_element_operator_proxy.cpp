@@ -93,6 +93,11 @@ void AccessibilityElementOperatorProxy::SearchElementInfoByAccessibilityId(const
         return;
     }
 
+    if (!data.WriteUint32(callback->GetFieldMask())) {
+        HILOG_ERROR("connection write parcelable fieldMask failed");
+        return;
+    }
+
     if (!SendTransactCmd(AccessibilityInterfaceCode::SEARCH_BY_ACCESSIBILITY_ID,
         data, reply, option)) {
         HILOG_ERROR("search element info by accessibility id failed");
@@ -137,6 +142,11 @@ void AccessibilityElementOperatorProxy::SearchElementInfosByText(const int64_t e
         return;
     }
 
+    if (!data.WriteUint32(callback->GetFieldMask())) {
+        HILOG_ERROR("connection write fieldMask failed");
+        return;
+    }
+
     if (!SendTransactCmd(AccessibilityInterfaceCode::SEARCH_BY_TEXT, data, reply, option)) {
         HILOG_ERROR("search element infos by text failed");
         return;
@@ -180,6 +190,11 @@ void AccessibilityElementOperatorProxy::FindFocusedElementInfo(const int64_t ele
         return;
     }
 
+    if (!data.WriteUint32(callback->GetFieldMask())) {
+        HILOG_ERROR("connection write fieldMask failed");
+        return;
+    }
+
     if (!SendTransactCmd(AccessibilityInterfaceCode::FIND_FOCUSED_INFO, data, reply, option)) {
         HILOG_ERROR("find focused element info failed");
         return;
@@ -100,6 +100,9 @@ ErrCode AccessibilityElementOperatorStub::HandleSearchElementInfoByAccessibility
     }
     int32_t mode = data.ReadInt32();
     bool isFilter = data.ReadBool();
+    uint32_t fieldMask = ELEMENT_FIELD_ALL; // the peers without field mask request every field
+    data.ReadUint32(fieldMask);
+    callback->SetFieldMask(fieldMask);
     SearchElementInfoByAccessibilityId(elementId, requestId, callback, mode, isFilter);
     return NO_ERROR;
 }
@@ -123,6 +126,9 @@ ErrCode AccessibilityElementOperatorStub::HandleSearchElementInfosByText(Message
         HILOG_ERROR("callback is nullptr");
         return ERR_INVALID_VALUE;
     }
+    uint32_t fieldMask = ELEMENT_FIELD_ALL;
+    data.ReadUint32(fieldMask);
+    callback->SetFieldMask(fieldMask);
     SearchElementInfosByText(elementId, text, requestId, callback);
     return NO_ERROR;
 }
@@ -146,6 +152,9 @@ ErrCode AccessibilityElementOperatorStub::HandleFindFocusedElementInfo(MessagePa
         HILOG_ERROR("callback is nullptr");
         return ERR_INVALID_VALUE;
     }
+    uint32_t fieldMask = ELEMENT_FIELD_ALL;
+    data.ReadUint32(fieldMask);
+    callback->SetFieldMask(fieldMask);
     FindFocusedElementInfo(elementId, focusType, requestId, callback);
     return NO_ERROR;
 }
@@ -104,6 +104,10 @@ RetError AccessibleAbilityChannelProxy::SearchElementInfoByAccessibilityId(const
         HILOG_ERROR("isFilter write error: %{public}d, ", isFilter);
         return RET_ERR_IPC_FAILED;
     }
+    if (!data.WriteUint32(callback->GetFieldMask())) {
+        HILOG_ERROR("fieldMask write error");
+        return RET_ERR_IPC_FAILED;
+    }
     if (!SendTransactCmd(AccessibilityInterfaceCode::SEARCH_ELEMENTINFO_BY_ACCESSIBILITY_ID,
         data, reply, option)) {
         HILOG_ERROR("fail to find elementInfo by elementId");
@@ -150,6 +154,10 @@ RetError AccessibleAbilityChannelProxy::SearchElementInfosByText(const int32_t a
         HILOG_ERROR("callback write error");
         return RET_ERR_IPC_FAILED;
     }
+    if (!data.WriteUint32(callback->GetFieldMask())) {
+        HILOG_ERROR("fieldMask write error");
+        return RET_ERR_IPC_FAILED;
+    }
 
     if (!SendTransactCmd(AccessibilityInterfaceCode::SEARCH_ELEMENTINFOS_BY_TEXT,
         data, reply, option)) {
@@ -196,6 +204,10 @@ RetError AccessibleAbilityChannelProxy::FindFocusedElementInfo(const int32_t acc
         HILOG_ERROR("callback write error");
         return RET_ERR_IPC_FAILED;
     }
+    if (!data.WriteUint32(callback->GetFieldMask())) {
+        HILOG_ERROR("fieldMask write error");
+        return RET_ERR_IPC_FAILED;
+    }
 
     if (!SendTransactCmd(AccessibilityInterfaceCode::FIND_FOCUSED_ELEMENTINFO, data, reply, option)) {
         HILOG_ERROR("fail to gain focus");
@@ -125,6 +125,9 @@ ErrCode AccessibleAbilityChannelStub::HandleSearchElementInfoByAccessibilityId(M
         mode = PREFETCH_RECURSIVE_CHILDREN;
     }
     bool isFilter = data.ReadBool();
+    uint32_t fieldMask = ELEMENT_FIELD_ALL; // the peers without field mask request every field
+    data.ReadUint32(fieldMask);
+    callback->SetFieldMask(fieldMask);
     RetError result = SearchElementInfoByAccessibilityId(elementBasicInfo, requestId, callback, mode,
         isFilter);
     HILOG_DEBUG("SearchElementInfoByAccessibilityId ret = %{public}d", result);
@@ -154,6 +157,9 @@ ErrCode AccessibleAbilityChannelStub::HandleSearchElementInfosByText(MessageParc
         HILOG_ERROR("callback is nullptr.");
         return ERR_INVALID_VALUE;
     }
+    uint32_t fieldMask = ELEMENT_FIELD_ALL;
+    data.ReadUint32(fieldMask);
+    callback->SetFieldMask(fieldMask);
 
     RetError result = SearchElementInfosByText(accessibilityWindowId, elementId, text, requestId, callback);
     HILOG_DEBUG("SearchElementInfosByText ret = %{public}d", result);
@@ -182,6 +188,9 @@ ErrCode AccessibleAbilityChannelStub::HandleFindFocusedElementInfo(MessageParcel
         HILOG_ERROR("callback is nullptr.");
         return ERR_INVALID_VALUE;
     }
+    uint32_t fieldMask = ELEMENT_FIELD_ALL;
+    data.ReadUint32(fieldMask);
+    callback->SetFieldMask(fieldMask);
 
     RetError result = FindFocusedElementInfo(accessibilityWindowId, elementId, focusType, requestId, callback);
     HILOG_DEBUG("FindFocusedElementInfo ret = %{public}d", result);
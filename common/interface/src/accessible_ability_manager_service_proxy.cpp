@@ -25,6 +25,7 @@ namespace Accessibility {
 
 const int32_t ABILITY_SIZE_MAX = 10000;
 const int32_t TREE_ID_MAX = 0x00001FFF;
+const size_t SEND_EVENTS_MAX_SIZE = 64;
 
 AccessibleAbilityManagerServiceProxy::AccessibleAbilityManagerServiceProxy(const sptr<IRemoteObject> &impl)
     : IRemoteProxy<IAccessibleAbilityManagerService>(impl)
@@ -91,6 +92,44 @@ RetError AccessibleAbilityManagerServiceProxy::SendEvent(const AccessibilityEven
     return RET_OK;
 }
 
+RetError AccessibleAbilityManagerServiceProxy::SendEvents(const std::vector<AccessibilityEventInfo> &uiEvents,
+    const int32_t flag)
+{
+    HILOG_DEBUG("size[%{public}zu]", uiEvents.size());
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option(MessageOption::TF_ASYNC);
+
+    if (uiEvents.empty() || uiEvents.size() > SEND_EVENTS_MAX_SIZE) {
+        HILOG_ERROR("invalid event batch size %{public}zu", uiEvents.size());
+        return RET_ERR_INVALID_PARAM;
+    }
+
+    if (!WriteInterfaceToken(data)) {
+        HILOG_ERROR("fail, connection write Token");
+        return RET_ERR_IPC_FAILED;
+    }
+
+    if (!data.WriteInt32(static_cast<int32_t>(uiEvents.size()))) {
+        HILOG_ERROR("fail, connection write event size error");
+        return RET_ERR_IPC_FAILED;
+    }
+
+    for (auto &uiEvent : uiEvents) {
+        AccessibilityEventInfoParcel eventInfoParcel(uiEvent);
+        if (!data.WriteParcelable(&eventInfoParcel)) {
+            HILOG_ERROR("fail, connection write parcelable AccessibilityEventInfo error");
+            return RET_ERR_IPC_FAILED;
+        }
+    }
+
+    if (!SendTransactCmd(AccessibilityInterfaceCode::SEND_EVENTS, data, reply, option)) {
+        HILOG_ERROR("SendEvents fail");
+        return RET_ERR_IPC_FAILED;
+    }
+    return RET_OK;
+}
+
 RetError AccessibleAbilityManagerServiceProxy::SetCaptionProperty(const AccessibilityConfig::CaptionProperty &caption)
 {
     HILOG_DEBUG();
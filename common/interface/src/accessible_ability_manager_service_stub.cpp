@@ -84,6 +84,7 @@
     SWITCH_CASE(AccessibilityInterfaceCode::GET_SCENE_BOARD_INNER_WINDOW_ID, HandleGetSceneBoardInnerWinId)\
     SWITCH_CASE(AccessibilityInterfaceCode::GET_SHORTKEY_MULTI_TARGET, HandleGetShortkeyMultiTarget)\
     SWITCH_CASE(AccessibilityInterfaceCode::SEND_EVENT, HandleSendEvent)\
+    SWITCH_CASE(AccessibilityInterfaceCode::SEND_EVENTS, HandleSendEvents)\
     SWITCH_CASE(AccessibilityInterfaceCode::REGISTER_STATE_CALLBACK, HandleRegisterStateCallback)\
     SWITCH_CASE(AccessibilityInterfaceCode::GET_ABILITYLIST, HandleGetAbilityList)\
     SWITCH_CASE(AccessibilityInterfaceCode::REGISTER_INTERACTION_CONNECTION, HandleRegisterAccessibilityElementOperator)\
@@ -116,6 +117,7 @@ namespace Accessibility {
 using namespace Security::AccessToken;
 constexpr int32_t IS_EXTERNAL = 1;
 constexpr int32_t ERR_CODE_DEFAULT = -1000;
+constexpr int32_t SEND_EVENTS_MAX_SIZE = 64;
 
 AccessibleAbilityManagerServiceStub::AccessibleAbilityManagerServiceStub()
 {
@@ -213,6 +215,30 @@ ErrCode AccessibleAbilityManagerServiceStub::HandleSendEvent(MessageParcel &data
     return NO_ERROR;
 }
 
+ErrCode AccessibleAbilityManagerServiceStub::HandleSendEvents(MessageParcel &data, MessageParcel &reply)
+{
+    HILOG_DEBUG();
+
+    int32_t eventSize = data.ReadInt32();
+    if (eventSize <= 0 || eventSize > SEND_EVENTS_MAX_SIZE) {
+        HILOG_ERROR("eventSize is invalid, eventSize: %{public}d", eventSize);
+        return TRANSACTION_ERR;
+    }
+    std::vector<AccessibilityEventInfo> uiEvents;
+    uiEvents.reserve(eventSize);
+    for (int32_t i = 0; i < eventSize; i++) {
+        sptr<AccessibilityEventInfoParcel> uiEvent = data.ReadStrongParcelable<AccessibilityEventInfoParcel>();
+        if (!uiEvent) {
+            HILOG_ERROR("ReadStrongParcelable<AccessibilityEventInfoParcel> failed");
+            return TRANSACTION_ERR;
+        }
+        uiEvents.emplace_back(*uiEvent);
+    }
+    SendEvents(uiEvents, IS_EXTERNAL);
+
+    return NO_ERROR;
+}
+
 ErrCode AccessibleAbilityManagerServiceStub::HandleRegisterStateCallback(
     MessageParcel &data, MessageParcel &reply)
 {
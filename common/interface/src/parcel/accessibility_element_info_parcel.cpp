@@ -19,12 +19,98 @@
 
 namespace OHOS {
 namespace Accessibility {
+namespace {
+    // The first OPTIONAL_STRING_COUNT bits of the presence mask gate the optional strings.
+    constexpr uint32_t PRESENCE_CHILD_IDS = 1U << 16;
+    constexpr uint32_t PRESENCE_OPERATIONS = 1U << 17;
+    constexpr uint32_t PRESENCE_RANGE_INFO = 1U << 18;
+    constexpr uint32_t PRESENCE_GRID_INFO = 1U << 19;
+    constexpr uint32_t PRESENCE_GRID_ITEM_INFO = 1U << 20;
+    constexpr uint32_t PRESENCE_TREE_INFO = 1U << 21;
+    constexpr uint32_t PRESENCE_TEXT_INFO = 1U << 22;
+    constexpr uint32_t PRESENCE_STYLE_INFO = 1U << 23;
+    constexpr uint32_t PRESENCE_EXTRA_INFO = 1U << 24;
+    constexpr uint32_t PRESENCE_SPAN_LIST = 1U << 25;
+    constexpr uint32_t GRID_ITEM_HEADING = 1U << 0;
+    constexpr uint32_t GRID_ITEM_SELECTED = 1U << 1;
+
+    const AccessibilityElementInfo &GetDefaultElementInfo()
+    {
+        static const AccessibilityElementInfo defaultInfo;
+        return defaultInfo;
+    }
+} // namespace
+
 /* AccessibilityElementInfoParcel       Parcel struct                 */
+std::atomic<int32_t> AccessibilityElementInfoParcel::marshallingVersion_ = ELEMENT_INFO_PARCEL_VERSION_COMPACT;
+
 AccessibilityElementInfoParcel::AccessibilityElementInfoParcel(const AccessibilityElementInfo &elementInfo)
     : AccessibilityElementInfo(elementInfo)
 {
 }
 
+AccessibilityElementInfoParcel::AccessibilityElementInfoParcel(const AccessibilityElementInfo &elementInfo,
+    const uint32_t fieldMask) : AccessibilityElementInfo(elementInfo)
+{
+    if (fieldMask != ELEMENT_FIELD_ALL) {
+        ProjectFields(fieldMask);
+    }
+}
+
+void AccessibilityElementInfoParcel::ProjectFields(const uint32_t fieldMask)
+{
+    const AccessibilityElementInfo &defaultInfo = GetDefaultElementInfo();
+    if (!(fieldMask & ELEMENT_FIELD_DESCRIPTION)) {
+        hintText_.clear();
+        accessibilityText_.clear();
+        contentDescription_.clear();
+        error_.clear();
+        accessibilityLevel_ = defaultInfo.GetAccessibilityLevel();
+        labeled_ = defaultInfo.GetLabeledAccessibilityId();
+    }
+    if (!(fieldMask & ELEMENT_FIELD_PAGE)) {
+        bundleName_.clear();
+        pagePath_.clear();
+        inspectorKey_.clear();
+        resourceName_.clear();
+        pageId_ = defaultInfo.GetPageId();
+    }
+    if (!(fieldMask & ELEMENT_FIELD_ACTIONS)) {
+        operations_.clear();
+    }
+    if (!(fieldMask & ELEMENT_FIELD_VALUE)) {
+        textType_.clear();
+        rangeInfo_ = defaultInfo.GetRange();
+        grid_ = defaultInfo.GetGrid();
+        gridItem_ = defaultInfo.GetGridItem();
+        textMoveStep_ = defaultInfo.GetTextMovementStep();
+        textLengthLimit_ = defaultInfo.GetTextLengthLimit();
+        currentIndex_ = defaultInfo.GetCurrentIndex();
+        beginIndex_ = defaultInfo.GetBeginIndex();
+        endIndex_ = defaultInfo.GetEndIndex();
+        beginSelected_ = defaultInfo.GetSelectedBegin();
+        endSelected_ = defaultInfo.GetSelectedEnd();
+        inputType_ = defaultInfo.GetInputType();
+        itemCounts_ = defaultInfo.GetItemCounts();
+        offset_ = defaultInfo.GetOffset();
+    }
+    if (!(fieldMask & ELEMENT_FIELD_STYLE)) {
+        backgroundColor_.clear();
+        backgroundImage_.clear();
+        blur_.clear();
+        hitTestBehavior_.clear();
+        liveRegion_ = defaultInfo.GetLiveRegion();
+        zIndex_ = defaultInfo.GetZIndex();
+        opacity_ = defaultInfo.GetOpacity();
+    }
+    if (!(fieldMask & ELEMENT_FIELD_EXTRA)) {
+        extraElementInfo_ = defaultInfo.GetExtraElement();
+        spanList_.clear();
+        contentList_.clear();
+        latestContent_.clear();
+    }
+}
+
 bool AccessibilityElementInfoParcel::ReadFromParcelFirstPart(Parcel &parcel)
 {
     READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, pageId_);
@@ -170,6 +256,21 @@ bool AccessibilityElementInfoParcel::ReadFromParcelFourthPart(Parcel &parcel)
 }
 
 bool AccessibilityElementInfoParcel::ReadFromParcel(Parcel &parcel)
+{
+    int32_t version = 0;
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, version);
+    switch (version) {
+        case ELEMENT_INFO_PARCEL_VERSION_LEGACY:
+            return ReadFromParcelLegacy(parcel);
+        case ELEMENT_INFO_PARCEL_VERSION_COMPACT:
+            return ReadFromParcelCompact(parcel);
+        default:
+            HILOG_ERROR("unknown element info parcel version %{public}d", version);
+            return false;
+    }
+}
+
+bool AccessibilityElementInfoParcel::ReadFromParcelLegacy(Parcel &parcel)
 {
     if (!ReadFromParcelFirstPart(parcel)) {
         return false;
@@ -287,6 +388,21 @@ bool AccessibilityElementInfoParcel::MarshallingThirdPart(Parcel &parcel) const
 }
 
 bool AccessibilityElementInfoParcel::Marshalling(Parcel &parcel) const
+{
+    int32_t version = marshallingVersion_.load();
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, version);
+    if (version == ELEMENT_INFO_PARCEL_VERSION_COMPACT) {
+        return MarshallingCompact(parcel);
+    }
+    return MarshallingLegacy(parcel);
+}
+
+void AccessibilityElementInfoParcel::SetMarshallingVersion(const ElementInfoParcelVersion version)
+{
+    marshallingVersion_.store(version);
+}
+
+bool AccessibilityElementInfoParcel::MarshallingLegacy(Parcel &parcel) const
 {
     if (!MarshallingFirstPart(parcel)) {
         return false;
@@ -300,6 +416,388 @@ bool AccessibilityElementInfoParcel::Marshalling(Parcel &parcel) const
     return true;
 }
 
+template<typename Info>
+auto AccessibilityElementInfoParcel::GetPackedBools(Info &info)
+    -> std::array<decltype(&info.checkable_), PACKED_BOOL_COUNT>
+{
+    return { &info.checkable_, &info.checked_, &info.focusable_, &info.focused_, &info.visible_,
+        &info.accessibilityFocused_, &info.selected_, &info.clickable_, &info.longClickable_, &info.enable_,
+        &info.isPassword_, &info.scrollable_, &info.editable_, &info.popupSupported_, &info.multiLine_,
+        &info.deletable_, &info.hint_, &info.isEssential_, &info.contentInvalid_, &info.validElement_,
+        &info.accessibilityGroup_ };
+}
+
+template<typename Info>
+auto AccessibilityElementInfoParcel::GetOptionalStrings(Info &info)
+    -> std::array<decltype(&info.text_), OPTIONAL_STRING_COUNT>
+{
+    return { &info.bundleName_, &info.componentType_, &info.text_, &info.hintText_, &info.accessibilityText_,
+        &info.contentDescription_, &info.resourceName_, &info.textType_, &info.error_, &info.inspectorKey_,
+        &info.pagePath_, &info.accessibilityLevel_, &info.backgroundColor_, &info.backgroundImage_, &info.blur_,
+        &info.hitTestBehavior_ };
+}
+
+uint32_t AccessibilityElementInfoParcel::GetPresenceMask() const
+{
+    const AccessibilityElementInfo &defaultInfo = GetDefaultElementInfo();
+    uint32_t presenceMask = 0;
+    auto strings = GetOptionalStrings(*this);
+    for (size_t i = 0; i < strings.size(); i++) {
+        if (!strings[i]->empty()) {
+            presenceMask |= 1U << i;
+        }
+    }
+    presenceMask |= childNodeIds_.empty() ? 0 : PRESENCE_CHILD_IDS;
+    presenceMask |= operations_.empty() ? 0 : PRESENCE_OPERATIONS;
+    const RangeInfo &range = defaultInfo.GetRange();
+    if (rangeInfo_.GetMin() != range.GetMin() || rangeInfo_.GetMax() != range.GetMax() ||
+        rangeInfo_.GetCurrent() != range.GetCurrent()) {
+        presenceMask |= PRESENCE_RANGE_INFO;
+    }
+    const GridInfo &grid = defaultInfo.GetGrid();
+    if (grid_.GetRowCount() != grid.GetRowCount() || grid_.GetColumnCount() != grid.GetColumnCount() ||
+        grid_.GetSelectionMode() != grid.GetSelectionMode()) {
+        presenceMask |= PRESENCE_GRID_INFO;
+    }
+    const GridItemInfo &gridItem = defaultInfo.GetGridItem();
+    if (gridItem_.GetColumnIndex() != gridItem.GetColumnIndex() || gridItem_.GetRowIndex() != gridItem.GetRowIndex() ||
+        gridItem_.GetColumnSpan() != gridItem.GetColumnSpan() || gridItem_.GetRowSpan() != gridItem.GetRowSpan() ||
+        gridItem_.IsHeading() != gridItem.IsHeading() || gridItem_.IsSelected() != gridItem.IsSelected()) {
+        presenceMask |= PRESENCE_GRID_ITEM_INFO;
+    }
+    if (belongTreeId_ != defaultInfo.GetBelongTreeId() || childTreeId_ != defaultInfo.GetChildTreeId() ||
+        childWindowId_ != defaultInfo.GetChildWindowId() || parentWindowId_ != defaultInfo.GetParentWindowId() ||
+        navDestinationId_ != defaultInfo.GetNavDestinationId()) {
+        presenceMask |= PRESENCE_TREE_INFO;
+    }
+    if (textMoveStep_ != defaultInfo.GetTextMovementStep() || textLengthLimit_ != defaultInfo.GetTextLengthLimit() ||
+        currentIndex_ != defaultInfo.GetCurrentIndex() || beginIndex_ != defaultInfo.GetBeginIndex() ||
+        endIndex_ != defaultInfo.GetEndIndex() || beginSelected_ != defaultInfo.GetSelectedBegin() ||
+        endSelected_ != defaultInfo.GetSelectedEnd() || inputType_ != defaultInfo.GetInputType() ||
+        itemCounts_ != defaultInfo.GetItemCounts() || offset_ != defaultInfo.GetOffset()) {
+        presenceMask |= PRESENCE_TEXT_INFO;
+    }
+    if (liveRegion_ != defaultInfo.GetLiveRegion() || labeled_ != defaultInfo.GetLabeledAccessibilityId() ||
+        zIndex_ != defaultInfo.GetZIndex() || opacity_ != defaultInfo.GetOpacity()) {
+        presenceMask |= PRESENCE_STYLE_INFO;
+    }
+    if (!extraElementInfo_.GetExtraElementInfoValueStr().empty() ||
+        !extraElementInfo_.GetExtraElementInfoValueInt().empty()) {
+        presenceMask |= PRESENCE_EXTRA_INFO;
+    }
+    presenceMask |= spanList_.empty() ? 0 : PRESENCE_SPAN_LIST;
+    return presenceMask;
+}
+
+bool AccessibilityElementInfoParcel::MarshallingCompact(Parcel &parcel) const
+{
+    uint32_t presenceMask = GetPresenceMask();
+    uint32_t boolFlags = 0;
+    auto bools = GetPackedBools(*this);
+    for (size_t i = 0; i < bools.size(); i++) {
+        if (*bools[i]) {
+            boolFlags |= 1U << i;
+        }
+    }
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Uint32, parcel, presenceMask);
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Uint32, parcel, boolFlags);
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, pageId_);
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, windowId_);
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int64, parcel, elementId_);
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int64, parcel, parentId_);
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, childCount_);
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, bounds_.GetLeftTopXScreenPostion());
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, bounds_.GetLeftTopYScreenPostion());
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, bounds_.GetRightBottomXScreenPostion());
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, bounds_.GetRightBottomYScreenPostion());
+    auto strings = GetOptionalStrings(*this);
+    for (size_t i = 0; i < strings.size(); i++) {
+        if (presenceMask & (1U << i)) {
+            WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, *strings[i]);
+        }
+    }
+    if (!MarshallingCompactNested(parcel, presenceMask)) {
+        return false;
+    }
+    if (!MarshallingCompactGroups(parcel, presenceMask)) {
+        return false;
+    }
+    return MarshallingCompactContainers(parcel, presenceMask);
+}
+
+bool AccessibilityElementInfoParcel::MarshallingCompactNested(Parcel &parcel, const uint32_t presenceMask) const
+{
+    if (presenceMask & PRESENCE_RANGE_INFO) {
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Double, parcel, rangeInfo_.GetMin());
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Double, parcel, rangeInfo_.GetMax());
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Double, parcel, rangeInfo_.GetCurrent());
+    }
+    if (presenceMask & PRESENCE_GRID_INFO) {
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, grid_.GetRowCount());
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, grid_.GetColumnCount());
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, grid_.GetSelectionMode());
+    }
+    if (presenceMask & PRESENCE_GRID_ITEM_INFO) {
+        uint32_t gridItemFlags = (gridItem_.IsHeading() ? GRID_ITEM_HEADING : 0) |
+            (gridItem_.IsSelected() ? GRID_ITEM_SELECTED : 0);
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Uint32, parcel, gridItemFlags);
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, gridItem_.GetColumnIndex());
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, gridItem_.GetRowIndex());
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, gridItem_.GetColumnSpan());
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, gridItem_.GetRowSpan());
+    }
+    return true;
+}
+
+bool AccessibilityElementInfoParcel::MarshallingCompactGroups(Parcel &parcel, const uint32_t presenceMask) const
+{
+    if (presenceMask & PRESENCE_TREE_INFO) {
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, belongTreeId_);
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, childTreeId_);
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, childWindowId_);
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, parentWindowId_);
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int64, parcel, navDestinationId_);
+    }
+    if (presenceMask & PRESENCE_TEXT_INFO) {
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, static_cast<int32_t>(textMoveStep_));
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, textLengthLimit_);
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, currentIndex_);
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, beginIndex_);
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, endIndex_);
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, beginSelected_);
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, endSelected_);
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, inputType_);
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, itemCounts_);
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Float, parcel, offset_);
+    }
+    if (presenceMask & PRESENCE_STYLE_INFO) {
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, liveRegion_);
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int64, parcel, labeled_);
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, zIndex_);
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Float, parcel, opacity_);
+    }
+    return true;
+}
+
+bool AccessibilityElementInfoParcel::MarshallingCompactContainers(Parcel &parcel, const uint32_t presenceMask) const
+{
+    if (presenceMask & PRESENCE_CHILD_IDS) {
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int64Vector, parcel, childNodeIds_);
+    }
+    if (presenceMask & PRESENCE_OPERATIONS) {
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, operations_.size());
+        for (auto &operation : operations_) {
+            WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, static_cast<int32_t>(operation.GetActionType()));
+            WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, operation.GetDescriptionInfo());
+        }
+    }
+    if (presenceMask & PRESENCE_EXTRA_INFO) {
+        const auto &valueStr = extraElementInfo_.GetExtraElementInfoValueStr();
+        const auto &valueInt = extraElementInfo_.GetExtraElementInfoValueInt();
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, valueStr.size());
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, valueInt.size());
+        for (auto &value : valueStr) {
+            WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, value.first);
+            WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, value.second);
+        }
+        for (auto &value : valueInt) {
+            WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, value.first);
+            WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, value.second);
+        }
+    }
+    if (presenceMask & PRESENCE_SPAN_LIST) {
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, spanList_.size());
+        for (auto &span : spanList_) {
+            WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, span.GetSpanId());
+            WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, span.GetSpanText());
+            WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, span.GetAccessibilityText());
+            WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, span.GetAccessibilityDescription());
+            WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, span.GetAccessibilityLevel());
+        }
+    }
+    return true;
+}
+
+bool AccessibilityElementInfoParcel::ReadFromParcelCompact(Parcel &parcel)
+{
+    uint32_t presenceMask = 0;
+    uint32_t boolFlags = 0;
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Uint32, parcel, presenceMask);
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Uint32, parcel, boolFlags);
+    auto bools = GetPackedBools(*this);
+    for (size_t i = 0; i < bools.size(); i++) {
+        *bools[i] = (boolFlags & (1U << i)) != 0;
+    }
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, pageId_);
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, windowId_);
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int64, parcel, elementId_);
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int64, parcel, parentId_);
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, childCount_);
+    int32_t leftTopX = 0;
+    int32_t leftTopY = 0;
+    int32_t rightBottomX = 0;
+    int32_t rightBottomY = 0;
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, leftTopX);
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, leftTopY);
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, rightBottomX);
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, rightBottomY);
+    bounds_.SetLeftTopScreenPostion(leftTopX, leftTopY);
+    bounds_.SetRightBottomScreenPostion(rightBottomX, rightBottomY);
+    auto strings = GetOptionalStrings(*this);
+    for (size_t i = 0; i < strings.size(); i++) {
+        if (presenceMask & (1U << i)) {
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, *strings[i]);
+        } else {
+            strings[i]->clear();
+        }
+    }
+    if (!ReadFromParcelCompactNested(parcel, presenceMask)) {
+        return false;
+    }
+    if (!ReadFromParcelCompactGroups(parcel, presenceMask)) {
+        return false;
+    }
+    return ReadFromParcelCompactContainers(parcel, presenceMask);
+}
+
+bool AccessibilityElementInfoParcel::ReadFromParcelCompactNested(Parcel &parcel, const uint32_t presenceMask)
+{
+    if (presenceMask & PRESENCE_RANGE_INFO) {
+        double min = 0;
+        double max = 0;
+        double current = 0;
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Double, parcel, min);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Double, parcel, max);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Double, parcel, current);
+        rangeInfo_ = RangeInfo(min, max, current);
+    }
+    if (presenceMask & PRESENCE_GRID_INFO) {
+        int32_t rowCount = 0;
+        int32_t columnCount = 0;
+        int32_t selectionMode = 0;
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, rowCount);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, columnCount);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, selectionMode);
+        grid_.SetGrid(rowCount, columnCount, selectionMode);
+    }
+    if (presenceMask & PRESENCE_GRID_ITEM_INFO) {
+        uint32_t gridItemFlags = 0;
+        int32_t columnIndex = 0;
+        int32_t rowIndex = 0;
+        int32_t columnSpan = 0;
+        int32_t rowSpan = 0;
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Uint32, parcel, gridItemFlags);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, columnIndex);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, rowIndex);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, columnSpan);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, rowSpan);
+        gridItem_.SetGridItemInfo(rowIndex, rowSpan, columnIndex, columnSpan,
+            (gridItemFlags & GRID_ITEM_HEADING) != 0, (gridItemFlags & GRID_ITEM_SELECTED) != 0);
+    }
+    return true;
+}
+
+bool AccessibilityElementInfoParcel::ReadFromParcelCompactGroups(Parcel &parcel, const uint32_t presenceMask)
+{
+    if (presenceMask & PRESENCE_TREE_INFO) {
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, belongTreeId_);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, childTreeId_);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, childWindowId_);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, parentWindowId_);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int64, parcel, navDestinationId_);
+    }
+    if (presenceMask & PRESENCE_TEXT_INFO) {
+        int32_t textMoveStep = STEP_CHARACTER;
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, textMoveStep);
+        textMoveStep_ = static_cast<TextMoveUnit>(textMoveStep);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, textLengthLimit_);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, currentIndex_);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, beginIndex_);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, endIndex_);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, beginSelected_);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, endSelected_);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, inputType_);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, itemCounts_);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Float, parcel, offset_);
+    }
+    if (presenceMask & PRESENCE_STYLE_INFO) {
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, liveRegion_);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int64, parcel, labeled_);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, zIndex_);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Float, parcel, opacity_);
+    }
+    return true;
+}
+
+bool AccessibilityElementInfoParcel::ReadFromParcelCompactContainers(Parcel &parcel, const uint32_t presenceMask)
+{
+    if (presenceMask & PRESENCE_CHILD_IDS) {
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int64Vector, parcel, &childNodeIds_);
+    }
+    if (presenceMask & PRESENCE_OPERATIONS) {
+        int32_t operationsSize = 0;
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, operationsSize);
+        if (operationsSize < 0 || !ContainerSecurityVerify(parcel, operationsSize, operations_.max_size())) {
+            return false;
+        }
+        operations_.reserve(operationsSize);
+        for (int32_t i = 0; i < operationsSize; i++) {
+            int32_t type = ActionType::ACCESSIBILITY_ACTION_INVALID;
+            std::string description;
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, type);
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, description);
+            operations_.emplace_back(static_cast<ActionType>(type), description);
+        }
+    }
+    if (presenceMask & PRESENCE_EXTRA_INFO) {
+        int32_t mapValueStr = 0;
+        int32_t mapValueInt = 0;
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, mapValueStr);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, mapValueInt);
+        std::map<std::string, std::string> valueStr;
+        std::map<std::string, int32_t> valueInt;
+        if (mapValueStr < 0 || !ContainerSecurityVerify(parcel, mapValueStr, valueStr.max_size())) {
+            return false;
+        }
+        for (int32_t i = 0; i < mapValueStr; i++) {
+            std::string key;
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, key);
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, valueStr[key]);
+        }
+        if (mapValueInt < 0 || !ContainerSecurityVerify(parcel, mapValueInt, valueInt.max_size())) {
+            return false;
+        }
+        for (int32_t i = 0; i < mapValueInt; i++) {
+            std::string key;
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, key);
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, valueInt[key]);
+        }
+        extraElementInfo_ = ExtraElementInfo(valueStr, valueInt);
+    }
+    if (presenceMask & PRESENCE_SPAN_LIST) {
+        int32_t spanListSize = 0;
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, spanListSize);
+        if (spanListSize < 0 || !ContainerSecurityVerify(parcel, spanListSize, spanList_.max_size())) {
+            return false;
+        }
+        spanList_.reserve(spanListSize);
+        for (int32_t i = 0; i < spanListSize; i++) {
+            int32_t spanId = 0;
+            std::string spanText;
+            std::string accessibilityText;
+            std::string accessibilityDescription;
+            std::string accessibilityLevel;
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, spanId);
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, spanText);
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, accessibilityText);
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, accessibilityDescription);
+            READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, accessibilityLevel);
+            spanList_.emplace_back(spanId, spanText, accessibilityText, accessibilityDescription, accessibilityLevel);
+        }
+    }
+    return true;
+}
+
 sptr<AccessibilityElementInfoParcel> AccessibilityElementInfoParcel::Unmarshalling(Parcel& parcel)
 {
     sptr<AccessibilityElementInfoParcel> accessibilityInfo = new(std::nothrow) AccessibilityElementInfoParcel();
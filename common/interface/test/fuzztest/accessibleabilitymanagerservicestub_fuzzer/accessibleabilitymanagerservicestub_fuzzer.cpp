@@ -41,6 +41,9 @@ public:
 
     RetError SendEvent(const AccessibilityEventInfo &uiEvent, const int32_t flag) override {return RET_OK;}
 
+    RetError SendEvents(const std::vector<AccessibilityEventInfo> &uiEvents,
+        const int32_t flag) override {return RET_OK;}
+
     uint32_t RegisterStateObserver(const sptr<IAccessibleAbilityManagerStateObserver> &callback) override {return 0;}
 
     uint32_t RegisterCaptionObserver(const sptr<IAccessibleAbilityManagerCaptionObserver>
@@ -353,5 +353,126 @@ HWTEST_F(AccessibilityElementInfoParcelTest, Extra_Element_Info_Parcel__002, Tes
     EXPECT_EQ(true, extraElementInfoParcel == nullptr);
     GTEST_LOG_(INFO) << "Extra_Element_Info_Parcel__002 end";
 }
+/**
+ * @tc.number: Element_Info_Compact_001
+ * @tc.name: Element_Info_Compact
+ * @tc.desc: Test the compact wire format keeps every field
+ */
+HWTEST_F(AccessibilityElementInfoParcelTest, Element_Info_Compact_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "Element_Info_Compact_001 start";
+    AccessibilityElementInfo info;
+    info.SetAccessibilityId(1);
+    info.SetParent(0);
+    info.SetContent("content");
+    info.SetVisible(true);
+    info.SetContentInvalid(false);
+    info.AddChild(2);
+    Rect rect(1, 2, 3, 4);
+    info.SetRectInScreen(rect);
+    RangeInfo rangeInfo(0, 10, 5);
+    info.SetRange(rangeInfo);
+    info.SetGridItem(GridItemInfo(1, 1, 2, 1, true, false));
+    info.SetSelectedBegin(3);
+    AccessibleAction action(ACCESSIBILITY_ACTION_CLICK, "click");
+    info.AddAction(action);
+
+    AccessibilityElementInfoParcel::SetMarshallingVersion(ELEMENT_INFO_PARCEL_VERSION_COMPACT);
+    AccessibilityElementInfoParcel infoParcel(info);
+    Parcel parcel;
+    EXPECT_TRUE(infoParcel.Marshalling(parcel));
+    sptr<AccessibilityElementInfoParcel> result = AccessibilityElementInfoParcel::Unmarshalling(parcel);
+    ASSERT_TRUE(result != nullptr);
+    EXPECT_EQ(result->GetAccessibilityId(), 1);
+    EXPECT_EQ(result->GetContent(), "content");
+    EXPECT_TRUE(result->IsVisible());
+    EXPECT_FALSE(result->GetContentInvalid());
+    EXPECT_TRUE(result->IsValidElement());
+    EXPECT_EQ(result->GetChildIds().size(), 1);
+    EXPECT_EQ(result->GetRectInScreen().GetRightBottomYScreenPostion(), 4);
+    EXPECT_EQ(result->GetRange().GetCurrent(), 5);
+    EXPECT_TRUE(result->GetGridItem().IsHeading());
+    EXPECT_EQ(result->GetSelectedBegin(), 3);
+    EXPECT_EQ(result->GetActionList().size(), 1);
+    EXPECT_EQ(result->GetAccessibilityLevel(), "auto");
+    EXPECT_EQ(result->GetTextLengthLimit(), -1);
+    GTEST_LOG_(INFO) << "Element_Info_Compact_001 end";
+}
+
+/**
+ * @tc.number: Element_Info_Compact_002
+ * @tc.name: Element_Info_Compact
+ * @tc.desc: Test the compact wire format is smaller and the legacy format is still readable
+ */
+HWTEST_F(AccessibilityElementInfoParcelTest, Element_Info_Compact_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "Element_Info_Compact_002 start";
+    AccessibilityElementInfo info;
+    info.SetAccessibilityId(1);
+    info.SetContent("content");
+    AccessibilityElementInfoParcel infoParcel(info);
+
+    AccessibilityElementInfoParcel::SetMarshallingVersion(ELEMENT_INFO_PARCEL_VERSION_LEGACY);
+    Parcel legacyParcel;
+    EXPECT_TRUE(infoParcel.Marshalling(legacyParcel));
+    AccessibilityElementInfoParcel::SetMarshallingVersion(ELEMENT_INFO_PARCEL_VERSION_COMPACT);
+    Parcel compactParcel;
+    EXPECT_TRUE(infoParcel.Marshalling(compactParcel));
+    EXPECT_LT(compactParcel.GetDataSize(), legacyParcel.GetDataSize());
+
+    sptr<AccessibilityElementInfoParcel> result = AccessibilityElementInfoParcel::Unmarshalling(legacyParcel);
+    ASSERT_TRUE(result != nullptr);
+    EXPECT_EQ(result->GetAccessibilityId(), 1);
+    EXPECT_EQ(result->GetContent(), "content");
+
+    Parcel invalidParcel;
+    invalidParcel.WriteInt32(0);
+    EXPECT_TRUE(AccessibilityElementInfoParcel::Unmarshalling(invalidParcel) == nullptr);
+    GTEST_LOG_(INFO) << "Element_Info_Compact_002 end";
+}
+
+/**
+ * @tc.number: Element_Info_Projection_001
+ * @tc.name: Element_Info_Projection
+ * @tc.desc: Test the field groups absent from the mask are not written and read back as default values
+ */
+HWTEST_F(AccessibilityElementInfoParcelTest, Element_Info_Projection_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "Element_Info_Projection_001 start";
+    AccessibilityElementInfo info;
+    info.SetAccessibilityId(1);
+    info.SetWindowId(2);
+    info.SetContent("content");
+    info.AddChild(3);
+    info.SetHint("hint");
+    info.SetDescriptionInfo("description");
+    info.SetBundleName("bundleName");
+    info.SetPageId(4);
+    AccessibleAction action(ACCESSIBILITY_ACTION_CLICK, "click");
+    info.AddAction(action);
+    info.SetBackgroundColor("red");
+
+    Parcel fullParcel;
+    AccessibilityElementInfoParcel fullInfoParcel(info, ELEMENT_FIELD_ALL);
+    EXPECT_TRUE(fullInfoParcel.Marshalling(fullParcel));
+    Parcel basicParcel;
+    AccessibilityElementInfoParcel basicInfoParcel(info, ELEMENT_FIELD_BASIC | ELEMENT_FIELD_ACTIONS);
+    EXPECT_TRUE(basicInfoParcel.Marshalling(basicParcel));
+    EXPECT_LT(basicParcel.GetDataSize(), fullParcel.GetDataSize());
+
+    sptr<AccessibilityElementInfoParcel> result = AccessibilityElementInfoParcel::Unmarshalling(basicParcel);
+    ASSERT_TRUE(result != nullptr);
+    EXPECT_EQ(result->GetAccessibilityId(), 1);
+    EXPECT_EQ(result->GetWindowId(), 2);
+    EXPECT_EQ(result->GetContent(), "content");
+    EXPECT_EQ(result->GetChildIds().size(), 1);
+    EXPECT_EQ(result->GetActionList().size(), 1);
+    EXPECT_EQ(result->GetHint(), "");
+    EXPECT_EQ(result->GetDescriptionInfo(), "");
+    EXPECT_EQ(result->GetBundleName(), "");
+    EXPECT_EQ(result->GetPageId(), -1);
+    EXPECT_EQ(result->GetBackgroundColor(), "");
+    GTEST_LOG_(INFO) << "Element_Info_Projection_001 end";
+}
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
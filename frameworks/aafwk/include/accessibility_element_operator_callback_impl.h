@@ -85,6 +85,15 @@ public:
      */
     virtual void SetCursorPositionResult(const int32_t cursorPosition, const int32_t requestId) override;
 
+protected:
+    /**
+     * @brief Take over the reassembled elements information without copying it.
+     * @param infos The elements info searched by accessibility id.
+     * @param requestId The request id from AA, it is used to match with request and response.
+     */
+    virtual void OnSearchElementInfoByAccessibilityIdResult(std::vector<AccessibilityElementInfo> &&infos,
+        const int32_t requestId) override;
+
 private:
     ffrt::promise<void> promise_;
     bool executeActionResult_ = false;
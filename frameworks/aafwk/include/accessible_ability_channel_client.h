@@ -57,10 +57,11 @@ public:
      *                  FOCUS_TYPE_ACCESSIBILITY: accessibility focus
      *                  FOCUS_TYPE_INPUT: text input focus
      * @param elementInfo[out] The components information matched conditions searched.
+     * @param fieldMask The groups of fields to be returned, refer to ElementFieldMask.
      * @return Return RET_OK if finds focus element info successfully, otherwise refer to the RetError for the failure.
      */
     RetError FindFocusedElementInfo(int32_t accessibilityWindowId, int64_t elementId,
-        int32_t focusType, AccessibilityElementInfo &elementInfo);
+        int32_t focusType, AccessibilityElementInfo &elementInfo, uint32_t fieldMask = ELEMENT_FIELD_ALL);
 
     /**
      * @brief Send simulate gesture to aams.
@@ -119,10 +120,12 @@ public:
      *              PREFETCH_CHILDREN: Need to make the child node info also.
      *              otherwise: Make the node information by elementId only.
      * @param elementInfos[out] The components information matched conditions searched.
+     * @param fieldMask The groups of fields to be returned, refer to ElementFieldMask.
      * @return Return RET_OK if search element info successfully, otherwise refer to the RetError for the failure.
      */
     RetError SearchElementInfosByAccessibilityId(int32_t accessibilityWindowId, int64_t elementId,
-        int32_t mode, std::vector<AccessibilityElementInfo> &elementInfos, int32_t treeId, bool isFilter = false);
+        int32_t mode, std::vector<AccessibilityElementInfo> &elementInfos, int32_t treeId, bool isFilter = false,
+        uint32_t fieldMask = ELEMENT_FIELD_ALL);
 
     /**
      * @brief Get the window information related with the event
@@ -153,10 +156,12 @@ public:
      * @param elementId: The unique id of the component ID.
      * @param text The filter text.
      * @param elementInfos[out] The components information matched conditions searched.
+     * @param fieldMask The groups of fields to be returned, refer to ElementFieldMask.
      * @return Return RET_OK if search element info successfully, otherwise refer to the RetError for the failure.
      */
     RetError SearchElementInfosByText(int32_t accessibilityWindowId, int64_t elementId,
-        const std::string &text, std::vector<AccessibilityElementInfo> &elementInfos);
+        const std::string &text, std::vector<AccessibilityElementInfo> &elementInfos,
+        uint32_t fieldMask = ELEMENT_FIELD_ALL);
 
     /**
      * @brief Find the node information by focus move direction.
@@ -17,8 +17,9 @@
 #define ACCESSIBLE_ABILITY_CLIENT_IMPL_H
 
 #include <atomic>
-#include <deque>
+#include <list>
 #include <memory>
+#include <unordered_map>
 #include "accessible_ability_channel_client.h"
 #include "accessible_ability_client.h"
 #include "accessible_ability_client_stub.h"
@@ -35,7 +36,15 @@ namespace Accessibility {
 constexpr int32_t SCENE_BOARD_WINDOW_ID = 1; // default scene board window id 1
 constexpr int32_t INVALID_SCENE_BOARD_INNER_WINDOW_ID = -1; // invalid scene board window id -1
 constexpr int64_t INVALID_SCENE_BOARD_ELEMENT_ID = -1; // invalid scene board element id -1
-constexpr int32_t MAX_CACHE_WINDOW_SIZE = 5;
+constexpr uint64_t DEFAULT_CACHE_MEMORY_BUDGET = 32 * 1024 * 1024; // 32M bytes
+
+// The smallest region of the element cache made stale by an event.
+enum CacheInvalidationScope : int32_t {
+    INVALIDATE_NONE = 0,
+    INVALIDATE_NODE, // the source node itself
+    INVALIDATE_SUBTREE, // the subtree of the source node and the child list of its parent
+    INVALIDATE_WINDOW, // the whole window
+};
 
 class AccessibleAbilityClientImpl : public AccessibleAbilityClient, public AccessibleAbilityClientStub {
 public:
@@ -304,6 +313,27 @@ public:
      */
     virtual RetError SetCacheMode(const int32_t cacheMode) override;
 
+    /**
+     * @brief Set the groups of element info fields to be fetched.
+     * @param fieldMask The field mask, refer to ElementFieldMask.
+     * @return Return RET_OK if sets field mask successfully, otherwise refer to the RetError for the failure.
+     */
+    virtual RetError SetElementFieldMask(const uint32_t fieldMask) override;
+
+    /**
+     * @brief Set the memory budget of the element cache.
+     * @param budgetBytes The memory budget in bytes.
+     * @return Return RET_OK if sets memory budget successfully, otherwise refer to the RetError for the failure.
+     */
+    virtual RetError SetCacheMemoryBudget(const uint64_t budgetBytes) override;
+
+    /**
+     * @brief Get the hit, miss and eviction counters and the memory usage of the element cache.
+     * @param statistics[out] The statistics of the element cache.
+     * @return Return RET_OK if gets statistics successfully, otherwise refer to the RetError for the failure.
+     */
+    virtual RetError GetCacheStatistics(ElementCacheStatistics &statistics) override;
+
     /**
      * @brief Clean data.
      * @param remote The object access to AAMS.
@@ -363,9 +393,12 @@ public:
         uint32_t mode, std::vector<AccessibilityElementInfo> &elementInfos, const std::string text, int32_t treeId,
         bool isFilter = false);
     void RemoveCacheData(const AccessibilityEventInfo &eventInfo);
-    void AddCacheByWMS(int32_t windowId, int64_t elementId, std::vector<AccessibilityElementInfo>& elementInfos);
-    void AddCacheByAce(int32_t windowId, int64_t elementId, std::vector<AccessibilityElementInfo>& elementInfos);
-    void SortElementInfosIfNecessary(std::vector<AccessibilityElementInfo> &elementInfos);
+    static CacheInvalidationScope GetCacheInvalidationScope(const EventType type);
+    void AddCacheByWMS(int32_t windowId, int64_t elementId, std::vector<AccessibilityElementInfo>& elementInfos,
+        const uint32_t fieldMask = ELEMENT_FIELD_ALL);
+    void AddCacheByAce(int32_t windowId, int64_t elementId, std::vector<AccessibilityElementInfo>& elementInfos,
+        const uint32_t fieldMask = ELEMENT_FIELD_ALL);
+    static void SortElementInfosIfNecessary(std::vector<AccessibilityElementInfo> &elementInfos);
 
     bool LoadAccessibilityService();
     void LoadSystemAbilitySuccess(const sptr<IRemoteObject> &remoteObject);
@@ -378,16 +411,44 @@ private:
     public:
         ElementCacheInfo() = default;
         ~ElementCacheInfo() = default;
-        void RemoveElementByWindowId(const int32_t windowId);
+        bool InvalidateElements(const int32_t windowId, const int64_t elementId,
+            const CacheInvalidationScope scope, int64_t& parentElementId);
+        void UpdateElements(const int32_t windowId, const std::vector<AccessibilityElementInfo>& elementInfos,
+            const uint32_t fieldMask = ELEMENT_FIELD_ALL);
         bool GetElementByWindowId(const int32_t windowId, const int64_t elementId,
-            std::vector<AccessibilityElementInfo>& elementInfos);
-        bool GetElementByWindowIdBFS(const int64_t elementId, std::vector<AccessibilityElementInfo>& elementInfos,
-            std::map<int32_t, std::shared_ptr<AccessibilityElementInfo>>& cache);
-        void AddElementCache(int32_t windowId, const std::vector<AccessibilityElementInfo>& elementInfos);
+            std::vector<AccessibilityElementInfo>& elementInfos, const uint32_t fieldMask = ELEMENT_FIELD_ALL);
+        void AddElementCache(int32_t windowId, const std::vector<AccessibilityElementInfo>& elementInfos,
+            const uint32_t fieldMask = ELEMENT_FIELD_ALL);
         bool IsExistWindowId(int32_t windowId);
+        void SetMemoryBudget(const uint64_t budgetBytes);
+        void GetStatistics(ElementCacheStatistics &statistics);
     private:
-        std::map<int32_t, std::map<int32_t, std::shared_ptr<AccessibilityElementInfo>>> elementCache_;
-        std::deque<int32_t> windowIdSet_;
+        struct WindowCache {
+            std::unordered_map<int64_t, std::shared_ptr<AccessibilityElementInfo>> elements;
+            int64_t rootElementId = -1;
+            uint64_t bytes = 0;
+            // the fields fetched for every element of the window, a request for more fields misses the cache
+            uint32_t fieldMask = ELEMENT_FIELD_ALL;
+            std::list<int32_t>::iterator lruIter;
+        };
+        bool GetElementByWindowIdBFS(const int64_t elementId, std::vector<AccessibilityElementInfo>& elementInfos,
+            const WindowCache& cache);
+        void EraseWindow(std::unordered_map<int32_t, WindowCache>::iterator iter);
+        uint32_t EraseSubtree(WindowCache& cache, const int64_t elementId, const bool withChildren = true);
+        void CountInvalidation(const CacheInvalidationScope scope, const uint32_t count);
+        void EvictIfNecessary();
+
+        std::unordered_map<int32_t, WindowCache> elementCache_;
+        // window ids from the most recently used to the least
+        std::list<int32_t> lruWindowIds_;
+        uint64_t usedBytes_ = 0;
+        uint64_t budgetBytes_ = DEFAULT_CACHE_MEMORY_BUDGET;
+        uint64_t hitCount_ = 0;
+        uint64_t missCount_ = 0;
+        uint64_t evictionCount_ = 0;
+        uint64_t nodeEventInvalidatedCount_ = 0;
+        uint64_t subtreeEventInvalidatedCount_ = 0;
+        uint64_t windowEventInvalidatedCount_ = 0;
         ffrt::mutex elementCacheMutex_;
     };
 
@@ -438,11 +499,15 @@ private:
     bool GetCacheElementInfo(const int32_t windowId,
         const int64_t elementId, AccessibilityElementInfo &elementInfo) const;
     void SetCacheElementInfo(const int32_t windowId,
-        const std::vector<OHOS::Accessibility::AccessibilityElementInfo> &elementInfos);
+        const std::vector<OHOS::Accessibility::AccessibilityElementInfo> &elementInfos,
+        const uint32_t fieldMask = ELEMENT_FIELD_ALL);
     RetError SearchElementInfoByElementId(const int32_t windowId, const int64_t elementId,
         const uint32_t mode, AccessibilityElementInfo &info, int32_t treeId);
     RetError SearchElementInfoFromAce(const int32_t windowId, const int64_t elementId,
         const uint32_t mode, AccessibilityElementInfo &info);
+    void RefreshCacheData(const int32_t windowId, const int32_t cacheWindowId, const int64_t elementId,
+        const int64_t parentElementId, const CacheInvalidationScope scope);
+    void FlushCacheRefresh(const int32_t cacheWindowId);
     bool InitAccessibilityServiceProxy();
     static void OnParameterChanged(const char *key, const char *value, void *context);
     sptr<Accessibility::IAccessibleAbilityManagerService> GetServiceProxy();
@@ -453,12 +518,23 @@ private:
     std::shared_ptr<AccessibleAbilityListener> listener_ = nullptr;
     std::shared_ptr<AccessibleAbilityChannelClient> channelClient_ = nullptr;
     uint32_t cacheMode_ = 0;
+    uint32_t fieldMask_ = ELEMENT_FIELD_ALL;
+    // the fields fetched for cacheElementInfos_, a request for more fields misses the cache
+    uint32_t cacheFieldMask_ = ELEMENT_FIELD_ALL;
     int32_t cacheWindowId_ = -1;
     std::map<int64_t, AccessibilityElementInfo> cacheElementInfos_;
     ffrt::mutex mutex_;
     std::atomic<bool> isConnected_ = false;
     // used for query element info in batch
     ElementCacheInfo elementCacheInfo_;
+    // A region dropped by an event, refetched when its window is queried next.
+    struct CacheRefreshRegion {
+        int32_t windowId = 0;
+        int32_t mode = 0;
+    };
+    // cache window id -> element id -> region, so a burst of events costs one fetch per region
+    std::map<int32_t, std::map<int64_t, CacheRefreshRegion>> pendingRefreshes_;
+    ffrt::mutex refreshMutex_;
     SceneBoardWindowElementMap windowElementMap_;
 
     ffrt::condition_variable proxyConVar_;
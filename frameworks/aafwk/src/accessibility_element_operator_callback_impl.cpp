@@ -42,6 +42,14 @@ void AccessibilityElementOperatorCallbackImpl::SetSearchElementInfoByAccessibili
     promise_.set_value();
 }
 
+void AccessibilityElementOperatorCallbackImpl::OnSearchElementInfoByAccessibilityIdResult(
+    std::vector<AccessibilityElementInfo> &&infos, const int32_t requestId)
+{
+    HILOG_DEBUG("Response[elementInfoSize:%{public}zu] [requestId:%{public}d]", infos.size(), requestId);
+    elementInfosResult_ = std::move(infos);
+    promise_.set_value();
+}
+
 void AccessibilityElementOperatorCallbackImpl::SetFocusMoveSearchResult(const AccessibilityElementInfo &info,
     const int32_t requestId)
 {
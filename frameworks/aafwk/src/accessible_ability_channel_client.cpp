@@ -51,7 +51,7 @@ void AccessibleAbilityChannelClient::SetOnKeyPressEventResult(const bool handled
 }
 
 RetError AccessibleAbilityChannelClient::FindFocusedElementInfo(int32_t accessibilityWindowId,
-    int64_t elementId, int32_t focusType, AccessibilityElementInfo &elementInfo)
+    int64_t elementId, int32_t focusType, AccessibilityElementInfo &elementInfo, uint32_t fieldMask)
 {
     HILOG_DEBUG("[channelId:%{public}d]", channelId_);
     HITRACE_METER_NAME(HITRACE_TAG_ACCESSIBILITY_MANAGER, "FindFocusedElement");
@@ -68,6 +68,7 @@ RetError AccessibleAbilityChannelClient::FindFocusedElementInfo(int32_t accessib
         HILOG_ERROR("FindFocusedElementInfo Failed to create elementOperator.");
         return RET_ERR_NULLPTR;
     }
+    elementOperator->SetFieldMask(fieldMask);
     ffrt::future<void> promiseFuture = elementOperator->promise_.get_future();
 
     int32_t windowId = accessibilityWindowId;
@@ -220,7 +221,7 @@ RetError AccessibleAbilityChannelClient::EnableScreenCurtain(bool isEnable)
 
 RetError AccessibleAbilityChannelClient::SearchElementInfosByAccessibilityId(int32_t accessibilityWindowId,
     int64_t elementId, int32_t mode, std::vector<AccessibilityElementInfo> &elementInfos, int32_t treeId,
-    bool isFilter)
+    bool isFilter, uint32_t fieldMask)
 {
     int32_t requestId = GenerateRequestId();
     HILOG_DEBUG("channelId:%{public}d, elementId:%{public}" PRId64 ", windowId:%{public}d, requestId:%{public}d",
@@ -238,6 +239,7 @@ RetError AccessibleAbilityChannelClient::SearchElementInfosByAccessibilityId(int
         HILOG_ERROR("SearchElementInfosByAccessibilityId Failed to create elementOperator.");
         return RET_ERR_NULLPTR;
     }
+    elementOperator->SetFieldMask(fieldMask);
     ffrt::future<void> promiseFuture = elementOperator->promise_.get_future();
     ElementBasicInfo elementBasicInfo {};
     elementBasicInfo.windowId = accessibilityWindowId;
@@ -265,7 +267,7 @@ RetError AccessibleAbilityChannelClient::SearchElementInfosByAccessibilityId(int
         }
     }
     HILOG_DEBUG("Get result successfully from ace. size[%{public}zu]", elementOperator->elementInfosResult_.size());
-    elementInfos = elementOperator->elementInfosResult_;
+    elementInfos = std::move(elementOperator->elementInfosResult_);
     return RET_OK;
 }
 
@@ -306,7 +308,8 @@ RetError AccessibleAbilityChannelClient::GetWindows(const uint64_t displayId,
 }
 
 RetError AccessibleAbilityChannelClient::SearchElementInfosByText(int32_t accessibilityWindowId,
-    int64_t elementId, const std::string &text, std::vector<AccessibilityElementInfo> &elementInfos)
+    int64_t elementId, const std::string &text, std::vector<AccessibilityElementInfo> &elementInfos,
+    uint32_t fieldMask)
 {
     HILOG_DEBUG("[channelId:%{public}d]", channelId_);
     HITRACE_METER_NAME(HITRACE_TAG_ACCESSIBILITY_MANAGER, "SearchElementByText");
@@ -323,6 +326,7 @@ RetError AccessibleAbilityChannelClient::SearchElementInfosByText(int32_t access
         HILOG_ERROR("SearchElementInfosByText Failed to create elementOperator.");
         return RET_ERR_NULLPTR;
     }
+    elementOperator->SetFieldMask(fieldMask);
     ffrt::future<void> promiseFuture = elementOperator->promise_.get_future();
 
     RetError ret = proxy_->SearchElementInfosByText(accessibilityWindowId,
@@ -345,7 +349,7 @@ RetError AccessibleAbilityChannelClient::SearchElementInfosByText(int32_t access
         }
     }
     HILOG_INFO("Get result successfully from ace. size[%{public}zu]", elementOperator->elementInfosResult_.size());
-    elementInfos = elementOperator->elementInfosResult_;
+    elementInfos = std::move(elementOperator->elementInfosResult_);
     return RET_OK;
 }
 
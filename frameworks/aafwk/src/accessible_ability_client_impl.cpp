@@ -42,6 +42,25 @@ namespace {
     ffrt::mutex g_Mutex;
     sptr<AccessibleAbilityClientImpl> g_Instance = nullptr;
     constexpr int32_t SA_CONNECT_TIMEOUT = 500; // ms
+    constexpr int32_t GET_ELEMENT_ONLY_MODE = 0;
+
+    // The estimated bytes held by one cached element, the object itself plus its strings and lists.
+    uint64_t GetElementCacheBytes(const AccessibilityElementInfo &info)
+    {
+        uint64_t bytes = sizeof(AccessibilityElementInfo);
+        bytes += info.GetBundleName().size() + info.GetComponentType().size() + info.GetContent().size() +
+            info.GetHint().size() + info.GetDescriptionInfo().size() + info.GetComponentResourceId().size() +
+            info.GetInspectorKey().size() + info.GetPagePath().size() + info.GetError().size() +
+            info.GetLatestContent().size() + info.GetAccessibilityText().size() + info.GetTextType().size();
+        bytes += info.GetChildIds().size() * sizeof(int64_t);
+        for (auto &action : info.GetActionList()) {
+            bytes += sizeof(AccessibleAction) + action.GetDescriptionInfo().size();
+        }
+        for (auto &span : info.GetSpanList()) {
+            bytes += sizeof(SpanInfo) + span.GetSpanText().size() + span.GetAccessibilityText().size();
+        }
+        return bytes;
+    }
 } // namespace
 
 sptr<AccessibleAbilityClient> AccessibleAbilityClient::GetInstance()
@@ -345,7 +364,7 @@ RetError AccessibleAbilityClientImpl::GetFocus(const int32_t focusType, Accessib
         return RET_ERR_NO_CONNECTION;
     }
 
-    return channelClient_->FindFocusedElementInfo(ANY_WINDOW_ID, ROOT_NODE_ID, focusType, elementInfo);
+    return channelClient_->FindFocusedElementInfo(ANY_WINDOW_ID, ROOT_NODE_ID, focusType, elementInfo, fieldMask_);
 }
 
 RetError AccessibleAbilityClientImpl::GetFocusByElementInfo(const AccessibilityElementInfo &sourceInfo,
@@ -373,7 +392,7 @@ RetError AccessibleAbilityClientImpl::GetFocusByElementInfo(const AccessibilityE
     HILOG_DEBUG("windowId[%{public}d], elementId[%{public}" PRId64 "], focusType[%{public}d]",
         windowId, elementId, focusType);
 
-    return channelClient_->FindFocusedElementInfo(windowId, elementId, focusType, elementInfo);
+    return channelClient_->FindFocusedElementInfo(windowId, elementId, focusType, elementInfo, fieldMask_);
 }
 
 RetError AccessibleAbilityClientImpl::InjectGesture(const std::shared_ptr<AccessibilityGestureInjectPath> &gesturePath)
@@ -518,52 +537,57 @@ RetError AccessibleAbilityClientImpl::GetRootBatch(std::vector<AccessibilityElem
 void AccessibleAbilityClientImpl::SortElementInfosIfNecessary(std::vector<AccessibilityElementInfo> &elementInfos)
 {
     HILOG_DEBUG();
-    std::map<int64_t, std::shared_ptr<AccessibilityElementInfo>> elementInfosMap;
-    std::vector<AccessibilityElementInfo> sortedElementInfos;
-    int64_t nodeId = NODE_ID_MAX;
-    int32_t count = 1;
-    AccessibilityElementInfo virtualRoot = elementInfos.front();
-    if (virtualRoot.GetAccessibilityId() != NODE_ID_MAX) {
+    if (elementInfos.empty() || elementInfos.front().GetAccessibilityId() != NODE_ID_MAX) {
         return;
     }
-    elementInfos.erase(elementInfos.begin());
-    for (auto &element : elementInfos) {
+    AccessibilityElementInfo &virtualRoot = elementInfos.front();
+    std::unordered_map<int64_t, size_t> elementIndexes;
+    elementIndexes.reserve(elementInfos.size());
+    int32_t count = 1;
+    for (size_t index = 1; index < elementInfos.size(); index++) {
+        AccessibilityElementInfo &element = elementInfos[index];
         if (element.GetAccessibilityId() == NODE_ID_MAX) {
-            nodeId = NODE_ID_MAX - count;
+            int64_t nodeId = NODE_ID_MAX - count;
             element.SetAccessibilityId(nodeId);
             element.SetParent(NODE_ID_MAX);
             virtualRoot.AddChild(nodeId);
             count += 1;
         }
-        nodeId = element.GetAccessibilityId();
-        elementInfosMap[nodeId] = std::make_shared<AccessibilityElementInfo>(element);
-    }
-    elementInfosMap[NODE_ID_MAX] = std::make_shared<AccessibilityElementInfo>(virtualRoot);
-
-    std::vector<int64_t> elementList;
-    elementList.push_back(NODE_ID_MAX);
-    uint32_t index = 0;
-    while (index < elementList.size()) {
-        auto iter = elementInfosMap.find(elementList[index]);
-        if (iter == elementInfosMap.end()) {
-            sortedElementInfos.clear();
-            elementInfos.insert(elementInfos.begin(), virtualRoot);
-            return;
-        }
-        sortedElementInfos.push_back(*(iter->second));
-        std::vector<int64_t> childNodeIds = iter->second->GetChildIds();
-        for (auto &id : childNodeIds) {
-            if (std::find(elementList.begin(), elementList.end(), id) == elementList.end()) {
-                elementList.push_back(id);
+        // the last element wins if an id is duplicated
+        elementIndexes[element.GetAccessibilityId()] = index;
+    }
+    elementIndexes[NODE_ID_MAX] = 0;
+
+    // Breadth first from the virtual root. A node reached again through a cycle or a shared child is
+    // visited only once, a dangling child id leaves the list unsorted, and orphans are dropped.
+    std::vector<size_t> sortedIndexes;
+    sortedIndexes.reserve(elementInfos.size());
+    std::vector<bool> visited(elementInfos.size(), false);
+    sortedIndexes.push_back(0);
+    visited[0] = true;
+    for (size_t index = 0; index < sortedIndexes.size(); index++) {
+        for (auto &childId : elementInfos[sortedIndexes[index]].GetChildIds()) {
+            auto iter = elementIndexes.find(childId);
+            if (iter == elementIndexes.end()) {
+                HILOG_WARN("child %{public}" PRId64 " is not found, keep the elements unsorted", childId);
+                return;
+            }
+            if (!visited[iter->second]) {
+                visited[iter->second] = true;
+                sortedIndexes.push_back(iter->second);
             }
         }
-        index++;
+    }
+    if (sortedIndexes.size() < elementInfos.size()) {
+        HILOG_DEBUG("drop %{public}zu orphan elements", elementInfos.size() - sortedIndexes.size());
     }
 
-    if (static_cast<int32_t>(sortedElementInfos.size()) > 0) {
-        elementInfos = sortedElementInfos;
+    std::vector<AccessibilityElementInfo> sortedElementInfos;
+    sortedElementInfos.reserve(sortedIndexes.size());
+    for (auto index : sortedIndexes) {
+        sortedElementInfos.push_back(std::move(elementInfos[index]));
     }
-    elementInfosMap.clear();
+    elementInfos.swap(sortedElementInfos);
 }
 
 RetError AccessibleAbilityClientImpl::GetRootByWindowBatch(const AccessibilityWindowInfo &windowInfo,
@@ -706,10 +730,10 @@ RetError AccessibleAbilityClientImpl::GetChildren(const AccessibilityElementInfo
         std::vector<AccessibilityElementInfo> elementInfos {};
         if (parent.GetChildWindowId() > 0 && (parent.GetChildWindowId() != windowId)) {
             ret = channelClient_->SearchElementInfosByAccessibilityId(parent.GetChildWindowId(), ROOT_NONE_ID,
-            GET_SOURCE_MODE, elementInfos, ROOT_TREE_ID);
+            GET_SOURCE_MODE, elementInfos, ROOT_TREE_ID, false, fieldMask_);
         } else if (parent.GetChildTreeId() > 0) {
             ret = channelClient_->SearchElementInfosByAccessibilityId(parent.GetWindowId(), ROOT_NONE_ID,
-            GET_SOURCE_MODE, elementInfos, parent.GetChildTreeId());
+            GET_SOURCE_MODE, elementInfos, parent.GetChildTreeId(), false, fieldMask_);
         }
 
         if (ret != RET_OK) {
@@ -773,7 +797,7 @@ RetError AccessibleAbilityClientImpl::GetByContent(const AccessibilityElementInf
     HILOG_DEBUG("windowId %{public}d, elementId %{public}" PRId64 ", text %{public}s",
         windowId, elementId, text.c_str());
     if (text != "") { // find element condition is null, so we will search all element info
-        RetError ret = channelClient_->SearchElementInfosByText(windowId, elementId, text, elementInfos);
+        RetError ret = channelClient_->SearchElementInfosByText(windowId, elementId, text, elementInfos, fieldMask_);
         if (ret != RET_OK) {
             HILOG_ERROR("SearchElementInfosByText failed ret:%{public}d, windowId:%{public}d, text:%{public}s",
                 ret, windowId, text.c_str());
@@ -824,7 +848,7 @@ RetError AccessibleAbilityClientImpl::SearchElementInfoRecursiveByContent(const
             info.GetChildWindowId());
         if (info.GetParentNodeId() == ROOT_PARENT_ELEMENT_ID) {
             ret = channelClient_->SearchElementInfosByText(windowId, info.GetAccessibilityId(),
-                text, vecTextElementInfos);
+                text, vecTextElementInfos, fieldMask_);
             if (ret != RET_OK) {
                 HILOG_ERROR("SearchElementInfosByText WindowId %{public}d} ret:%{public}d text:%{public}s",
                     windowId, ret, text.c_str());
@@ -1091,6 +1115,28 @@ RetError AccessibleAbilityClientImpl::SetCacheMode(const int32_t cacheMode)
     return RET_OK;
 }
 
+RetError AccessibleAbilityClientImpl::SetElementFieldMask(const uint32_t fieldMask)
+{
+    HILOG_DEBUG("set field mask: [0x%{public}x]", fieldMask);
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    fieldMask_ = fieldMask;
+    return RET_OK;
+}
+
+RetError AccessibleAbilityClientImpl::SetCacheMemoryBudget(const uint64_t budgetBytes)
+{
+    HILOG_DEBUG("set cache memory budget: [%{public}" PRIu64 "]", budgetBytes);
+    elementCacheInfo_.SetMemoryBudget(budgetBytes);
+    return RET_OK;
+}
+
+RetError AccessibleAbilityClientImpl::GetCacheStatistics(ElementCacheStatistics &statistics)
+{
+    HILOG_DEBUG();
+    elementCacheInfo_.GetStatistics(statistics);
+    return RET_OK;
+}
+
 bool AccessibleAbilityClientImpl::GetCacheElementInfo(const int32_t windowId,
     const int64_t elementId, AccessibilityElementInfo &elementInfo) const
 {
@@ -1100,6 +1146,12 @@ bool AccessibleAbilityClientImpl::GetCacheElementInfo(const int32_t windowId,
         return false;
     }
 
+    if ((fieldMask_ & ~cacheFieldMask_) != 0) {
+        HILOG_DEBUG("cached fields[0x%{public}x] miss the requested fields[0x%{public}x]",
+            cacheFieldMask_, fieldMask_);
+        return false;
+    }
+
     auto iter = cacheElementInfos_.find(elementId);
     if (iter == cacheElementInfos_.end()) {
         HILOG_DEBUG("the element id[%{public}" PRId64 "] is not in cache", elementId);
@@ -1111,11 +1163,13 @@ bool AccessibleAbilityClientImpl::GetCacheElementInfo(const int32_t windowId,
 }
 
 void AccessibleAbilityClientImpl::SetCacheElementInfo(const int32_t windowId,
-    const std::vector<OHOS::Accessibility::AccessibilityElementInfo> &elementInfos)
+    const std::vector<OHOS::Accessibility::AccessibilityElementInfo> &elementInfos, const uint32_t fieldMask)
 {
-    HILOG_DEBUG("windowId[%{public}d], elementInfos size[%{public}zu]", windowId, elementInfos.size());
+    HILOG_DEBUG("windowId[%{public}d], elementInfos size[%{public}zu], fieldMask[0x%{public}x]",
+        windowId, elementInfos.size(), fieldMask);
     cacheElementInfos_.clear();
     cacheWindowId_ = windowId;
+    cacheFieldMask_ = fieldMask;
     for (auto &elementInfo : elementInfos) {
         cacheElementInfos_.insert(std::make_pair(elementInfo.GetAccessibilityId(), elementInfo));
     }
@@ -1132,7 +1186,7 @@ RetError AccessibleAbilityClientImpl::SearchElementInfoByElementId(const int32_t
     HILOG_INFO("windowId %{public}d}, elementId %{public}" PRId64 "", windowId, elementId);
     std::vector<AccessibilityElementInfo> elementInfos {};
     RetError ret = channelClient_->SearchElementInfosByAccessibilityId(
-        windowId, elementId, static_cast<int32_t>(mode), elementInfos, treeId);
+        windowId, elementId, static_cast<int32_t>(mode), elementInfos, treeId, false, fieldMask_);
     if (ret != RET_OK) {
         HILOG_ERROR("SearchElementInfosByAccessibilityId failed. windowId[%{public}d] ", windowId);
         return ret;
@@ -1143,7 +1197,7 @@ RetError AccessibleAbilityClientImpl::SearchElementInfoByElementId(const int32_t
     }
 
     HILOG_DEBUG("element [elementSize:%{public}zu]", elementInfos.size());
-    SetCacheElementInfo(windowId, elementInfos);
+    SetCacheElementInfo(windowId, elementInfos, fieldMask_);
     info = elementInfos.front();
     return RET_OK;
 }
@@ -1162,7 +1216,7 @@ RetError AccessibleAbilityClientImpl::SearchElementInfoFromAce(const int32_t win
         treeId = (static_cast<uint64_t>(elementId) >> ELEMENT_MOVE_BIT);
     }
     RetError ret = channelClient_->SearchElementInfosByAccessibilityId(windowId, elementId,
-        static_cast<int32_t>(mode), elementInfos, treeId);
+        static_cast<int32_t>(mode), elementInfos, treeId, false, fieldMask_);
     if (ret != RET_OK) {
         HILOG_ERROR("search element info failed. windowId[%{public}d] elementId[%{public}" PRId64 "] mode[%{public}d]",
             windowId, elementId, mode);
@@ -1170,7 +1224,7 @@ RetError AccessibleAbilityClientImpl::SearchElementInfoFromAce(const int32_t win
     }
     if (!elementInfos.empty()) {
         HILOG_DEBUG("element [elementSize:%{public}zu]", elementInfos.size());
-        SetCacheElementInfo(windowId, elementInfos);
+        SetCacheElementInfo(windowId, elementInfos, fieldMask_);
         info = elementInfos.front();
         HILOG_DEBUG("elementId:%{public}" PRId64 ", windowId:%{public}d, treeId:%{public}d",
             info.GetAccessibilityId(), info.GetWindowId(), info.GetBelongTreeId());
@@ -1317,21 +1371,29 @@ void AccessibleAbilityClientImpl::AddWindowElementMapByAce(int32_t windowId, int
 RetError AccessibleAbilityClientImpl::GetElementInfoFromCache(int32_t windowId, int64_t elementId,
     std::vector<AccessibilityElementInfo> &elementInfos)
 {
+    uint32_t fieldMask = ELEMENT_FIELD_ALL;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        fieldMask = fieldMask_;
+    }
     if (windowId == SCENE_BOARD_WINDOW_ID) { // sceneboard window id
-        if (elementCacheInfo_.GetElementByWindowId(windowId, elementId, elementInfos)) {
+        FlushCacheRefresh(windowId);
+        if (elementCacheInfo_.GetElementByWindowId(windowId, elementId, elementInfos, fieldMask)) {
             HILOG_DEBUG("get element info from cache");
             return RET_OK;
         }
 
         std::vector<int32_t> windowsList = windowElementMap_.GetWindowIdList();
         for (auto tmpWindowId : windowsList) {
-            if (elementCacheInfo_.GetElementByWindowId(tmpWindowId, elementId, elementInfos)) {
+            FlushCacheRefresh(tmpWindowId);
+            if (elementCacheInfo_.GetElementByWindowId(tmpWindowId, elementId, elementInfos, fieldMask)) {
                 HILOG_DEBUG("get element info from cache");
                 return RET_OK;
             }
         }
     } else {
-        if (elementCacheInfo_.GetElementByWindowId(windowId, elementId, elementInfos)) {
+        FlushCacheRefresh(windowId);
+        if (elementCacheInfo_.GetElementByWindowId(windowId, elementId, elementInfos, fieldMask)) {
             HILOG_DEBUG("get element info from cache");
             return RET_OK;
         }
@@ -1413,53 +1475,151 @@ RetError AccessibleAbilityClientImpl::SearchElementInfoRecursiveByWinid(const in
     return RET_OK;
 }
 
+CacheInvalidationScope AccessibleAbilityClientImpl::GetCacheInvalidationScope(const EventType type)
+{
+    switch (type) {
+        case TYPE_VIEW_TEXT_UPDATE_EVENT:
+        case TYPE_VIEW_TEXT_SELECTION_UPDATE_EVENT:
+            return INVALIDATE_NODE;
+        case TYPE_PAGE_CONTENT_UPDATE:
+            return INVALIDATE_SUBTREE;
+        case TYPE_PAGE_STATE_UPDATE:
+        case TYPE_NOTIFICATION_UPDATE_EVENT:
+        case TYPE_WINDOW_UPDATE:
+            return INVALIDATE_WINDOW;
+        default:
+            return INVALIDATE_NONE;
+    }
+}
+
 void AccessibleAbilityClientImpl::RemoveCacheData(const AccessibilityEventInfo& eventInfo)
 {
-    EventType type = eventInfo.GetEventType();
-    if (type == TYPE_VIEW_TEXT_UPDATE_EVENT || type == TYPE_PAGE_STATE_UPDATE ||
-        type == TYPE_NOTIFICATION_UPDATE_EVENT || type == TYPE_PAGE_CONTENT_UPDATE ||
-        type == TYPE_VIEW_TEXT_SELECTION_UPDATE_EVENT || type == TYPE_WINDOW_UPDATE) {
-        int32_t windowId = eventInfo.GetWindowId();
-        HILOG_DEBUG("RemoveCacheData windowId %{public}d", windowId);
+    CacheInvalidationScope scope = GetCacheInvalidationScope(eventInfo.GetEventType());
+    if (scope == INVALIDATE_NONE) {
+        return;
+    }
+    int32_t windowId = eventInfo.GetWindowId();
+    int64_t elementId = eventInfo.GetAccessibilityId();
+    HILOG_DEBUG("RemoveCacheData windowId %{public}d, elementId %{public}" PRId64 ", scope %{public}d",
+        windowId, elementId, scope);
+    int64_t parentElementId = ROOT_NONE_ID;
+    if (scope != INVALIDATE_WINDOW) {
+        std::vector<int32_t> cacheWindowIds = { windowId };
         if (windowId == SCENE_BOARD_WINDOW_ID) {
-            elementCacheInfo_.RemoveElementByWindowId(windowId);
-            windowElementMap_.RemovePairByWindowId(windowId);
-
-            auto windowList = windowElementMap_.GetWindowIdList();
-            windowElementMap_.RemovePairByWindowIdList(windowList);
-            for (auto window: windowList) {
-                elementCacheInfo_.RemoveElementByWindowId(window);
+            std::vector<int32_t> innerWindowIds = windowElementMap_.GetWindowIdList();
+            cacheWindowIds.insert(cacheWindowIds.end(), innerWindowIds.begin(), innerWindowIds.end());
+        }
+        for (auto cacheWindowId : cacheWindowIds) {
+            if (elementCacheInfo_.InvalidateElements(cacheWindowId, elementId, scope, parentElementId)) {
+                RefreshCacheData(windowId, cacheWindowId, elementId, parentElementId, scope);
+                return;
             }
-        } else {
-            elementCacheInfo_.RemoveElementByWindowId(windowId);
-            windowElementMap_.RemovePairByWindowId(windowId);
+        }
+        // the source is not cached, so the stale region can not be located
+        HILOG_DEBUG("elementId %{public}" PRId64 " is not cached, invalidate the window", elementId);
+    }
+
+    std::lock_guard<ffrt::mutex> lock(refreshMutex_);
+    if (windowId == SCENE_BOARD_WINDOW_ID) {
+        elementCacheInfo_.InvalidateElements(windowId, elementId, INVALIDATE_WINDOW, parentElementId);
+        windowElementMap_.RemovePairByWindowId(windowId);
+        pendingRefreshes_.erase(windowId);
+
+        auto windowList = windowElementMap_.GetWindowIdList();
+        windowElementMap_.RemovePairByWindowIdList(windowList);
+        for (auto window: windowList) {
+            elementCacheInfo_.InvalidateElements(window, elementId, INVALIDATE_WINDOW, parentElementId);
+            pendingRefreshes_.erase(window);
+        }
+    } else {
+        elementCacheInfo_.InvalidateElements(windowId, elementId, INVALIDATE_WINDOW, parentElementId);
+        windowElementMap_.RemovePairByWindowId(windowId);
+        pendingRefreshes_.erase(windowId);
+    }
+}
+
+void AccessibleAbilityClientImpl::RefreshCacheData(const int32_t windowId, const int32_t cacheWindowId,
+    const int64_t elementId, const int64_t parentElementId, const CacheInvalidationScope scope)
+{
+    // The refetch is deferred to the next query of the window, so the event path never waits for ace.
+    std::lock_guard<ffrt::mutex> lock(refreshMutex_);
+    std::map<int64_t, CacheRefreshRegion>& regions = pendingRefreshes_[cacheWindowId];
+    // a region already queued for its subtree keeps that mode
+    CacheRefreshRegion& region = regions.emplace(elementId,
+        CacheRefreshRegion { windowId, GET_ELEMENT_ONLY_MODE }).first->second;
+    region.windowId = windowId;
+    if (scope == INVALIDATE_SUBTREE) {
+        region.mode = PREFETCH_RECURSIVE_CHILDREN;
+    }
+    if (parentElementId == ROOT_NONE_ID) {
+        return;
+    }
+
+    // the child list of the parent changes with the subtree
+    CacheRefreshRegion& parentRegion = regions.emplace(parentElementId,
+        CacheRefreshRegion { windowId, GET_ELEMENT_ONLY_MODE }).first->second;
+    parentRegion.windowId = windowId;
+}
+
+void AccessibleAbilityClientImpl::FlushCacheRefresh(const int32_t cacheWindowId)
+{
+    std::map<int64_t, CacheRefreshRegion> regions;
+    {
+        std::lock_guard<ffrt::mutex> lock(refreshMutex_);
+        auto iter = pendingRefreshes_.find(cacheWindowId);
+        if (iter == pendingRefreshes_.end()) {
+            return;
+        }
+        regions.swap(iter->second);
+        pendingRefreshes_.erase(iter);
+    }
+
+    std::shared_ptr<AccessibleAbilityChannelClient> channel = nullptr;
+    uint32_t fieldMask = ELEMENT_FIELD_ALL;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        channel = channelClient_;
+        fieldMask = fieldMask_;
+    }
+    if (channel == nullptr) {
+        HILOG_DEBUG("The channel is invalid, the regions are fetched on a cache miss.");
+        return;
+    }
+
+    HILOG_DEBUG("refresh %{public}zu regions of windowId %{public}d", regions.size(), cacheWindowId);
+    for (auto& region : regions) {
+        std::vector<AccessibilityElementInfo> elementInfos {};
+        int32_t treeId = static_cast<int32_t>(static_cast<uint64_t>(region.first) >> ELEMENT_MOVE_BIT);
+        if (channel->SearchElementInfosByAccessibilityId(region.second.windowId, region.first, region.second.mode,
+            elementInfos, treeId, false, fieldMask) == RET_OK) {
+            elementCacheInfo_.UpdateElements(cacheWindowId, elementInfos, fieldMask);
         }
     }
 }
 
 void AccessibleAbilityClientImpl::AddCacheByWMS(int32_t windowId, int64_t elementId,
-    std::vector<AccessibilityElementInfo>& elementInfos)
+    std::vector<AccessibilityElementInfo>& elementInfos, const uint32_t fieldMask)
 {
-    HILOG_DEBUG("elementSize %{public}zu", elementInfos.size());
+    HILOG_DEBUG("elementSize %{public}zu, fieldMask[0x%{public}x]", elementInfos.size(), fieldMask);
     AddWindowElementMapByWMS(windowId, elementId);
-    elementCacheInfo_.AddElementCache(windowId, elementInfos);
+    elementCacheInfo_.AddElementCache(windowId, elementInfos, fieldMask);
 }
 
 void AccessibleAbilityClientImpl::AddCacheByAce(int32_t windowId, int64_t elementId,
-    std::vector<AccessibilityElementInfo>& elementInfos)
+    std::vector<AccessibilityElementInfo>& elementInfos, const uint32_t fieldMask)
 {
     AddWindowElementMapByAce(windowId, elementId);
-    HILOG_DEBUG("elementSize %{public}zu", elementInfos.size());
+    HILOG_DEBUG("elementSize %{public}zu, fieldMask[0x%{public}x]", elementInfos.size(), fieldMask);
     if (windowId == SCENE_BOARD_WINDOW_ID) {
         windowId = windowElementMap_.GetWindowIdByElementId(elementId);
         HILOG_DEBUG("windowId convert to %{public}d", windowId);
         if (windowId == INVALID_SCENE_BOARD_INNER_WINDOW_ID) {
-            elementCacheInfo_.AddElementCache(SCENE_BOARD_WINDOW_ID, elementInfos);
+            elementCacheInfo_.AddElementCache(SCENE_BOARD_WINDOW_ID, elementInfos, fieldMask);
         } else {
-            elementCacheInfo_.AddElementCache(windowId, elementInfos);
+            elementCacheInfo_.AddElementCache(windowId, elementInfos, fieldMask);
         }
     } else {
-        elementCacheInfo_.AddElementCache(windowId, elementInfos);
+        elementCacheInfo_.AddElementCache(windowId, elementInfos, fieldMask);
     }
 }
 
@@ -1503,47 +1663,78 @@ RetError AccessibleAbilityClientImpl::SearchElementInfoByAccessibilityId(const i
 }
 
 void AccessibleAbilityClientImpl::ElementCacheInfo::AddElementCache(const int32_t windowId,
-    const std::vector<AccessibilityElementInfo>& elementInfos)
+    const std::vector<AccessibilityElementInfo>& elementInfos, const uint32_t fieldMask)
 {
     std::lock_guard<ffrt::mutex> lock(elementCacheMutex_);
-    if (windowIdSet_.size() >= MAX_CACHE_WINDOW_SIZE) {
-        auto winId = windowIdSet_.front();
-        windowIdSet_.pop_front();
-        elementCache_.erase(winId);
+    auto iter = elementCache_.find(windowId);
+    if (iter != elementCache_.end()) {
+        EraseWindow(iter);
     }
 
-    elementCache_.erase(windowId);
-
-    std::map<int32_t, std::shared_ptr<AccessibilityElementInfo>> cache;
+    WindowCache cache;
+    cache.fieldMask = fieldMask;
+    cache.elements.reserve(elementInfos.size());
     for (auto& elementInfo : elementInfos) {
         int64_t elementId = elementInfo.GetAccessibilityId();
-        cache[elementId] = std::make_shared<AccessibilityElementInfo>(elementInfo);
+        if (cache.rootElementId == ROOT_NONE_ID && elementInfo.GetComponentType() == "root") {
+            cache.rootElementId = elementId;
+        }
+        cache.bytes += GetElementCacheBytes(elementInfo);
+        cache.elements[elementId] = std::make_shared<AccessibilityElementInfo>(elementInfo);
+    }
+    if (cache.bytes > budgetBytes_) {
+        HILOG_WARN("windowId %{public}d needs %{public}" PRIu64 " bytes, over the budget %{public}" PRIu64 "",
+            windowId, cache.bytes, budgetBytes_);
+        evictionCount_++;
+        return;
     }
 
-    elementCache_[windowId] = std::move(cache);
-    windowIdSet_.push_back(windowId);
+    usedBytes_ += cache.bytes;
+    lruWindowIds_.push_front(windowId);
+    cache.lruIter = lruWindowIds_.begin();
+    elementCache_.emplace(windowId, std::move(cache));
+    EvictIfNecessary();
+}
+
+void AccessibleAbilityClientImpl::ElementCacheInfo::EraseWindow(
+    std::unordered_map<int32_t, WindowCache>::iterator iter)
+{
+    usedBytes_ -= iter->second.bytes;
+    lruWindowIds_.erase(iter->second.lruIter);
+    elementCache_.erase(iter);
+}
+
+void AccessibleAbilityClientImpl::ElementCacheInfo::EvictIfNecessary()
+{
+    while (usedBytes_ > budgetBytes_ && !lruWindowIds_.empty()) {
+        auto iter = elementCache_.find(lruWindowIds_.back());
+        if (iter == elementCache_.end()) {
+            lruWindowIds_.pop_back();
+            continue;
+        }
+        HILOG_DEBUG("evict windowId %{public}d, bytes %{public}" PRIu64 "", iter->first, iter->second.bytes);
+        EraseWindow(iter);
+        evictionCount_++;
+    }
 }
 
 bool AccessibleAbilityClientImpl::ElementCacheInfo::GetElementByWindowIdBFS(const int64_t realElementId,
-    std::vector<AccessibilityElementInfo>& elementInfos,
-    std::map<int32_t, std::shared_ptr<AccessibilityElementInfo>>& cache)
+    std::vector<AccessibilityElementInfo>& elementInfos, const WindowCache& cache)
 {
     std::vector<int64_t> elementList;
     elementList.push_back(realElementId);
     uint32_t index = 0;
     while (index < elementList.size()) {
-        auto iter = cache.find(elementList[index]);
-        if (iter == cache.end()) {
+        auto iter = cache.elements.find(elementList[index]);
+        if (iter == cache.elements.end()) {
             elementInfos.clear();
             HILOG_DEBUG("element data abnormal, clear elementInfos");
             return false;
         }
 
         elementInfos.push_back(*(iter->second));
-        std::vector<int64_t> childrenNode = iter->second->GetChildIds();
-        for (auto& node : childrenNode) {
-            elementList.push_back(node);
-        }
+        const std::vector<int64_t>& childrenNode = iter->second->GetChildIds();
+        elementList.insert(elementList.end(), childrenNode.begin(), childrenNode.end());
         index++;
     }
     return true;
@@ -1551,75 +1742,202 @@ bool AccessibleAbilityClientImpl::ElementCacheInfo::GetElementByWindowIdBFS(cons
 
 // window id is true, element id is true
 bool AccessibleAbilityClientImpl::ElementCacheInfo::GetElementByWindowId(const int32_t windowId,
-    const int64_t elementId, std::vector<AccessibilityElementInfo>& elementInfos)
+    const int64_t elementId, std::vector<AccessibilityElementInfo>& elementInfos, const uint32_t fieldMask)
 {
     elementInfos.clear(); // clear
     std::lock_guard<ffrt::mutex> lock(elementCacheMutex_);
-    if (elementCache_.find(windowId) == elementCache_.end()) {
+    auto windowIter = elementCache_.find(windowId);
+    if (windowIter == elementCache_.end()) {
         HILOG_DEBUG("windowId %{public}d is not existed", windowId);
+        missCount_++;
         return false;
     }
 
-    auto& cache = elementCache_.find(windowId)->second;
-    if (cache.size() == 0) {
+    auto& cache = windowIter->second;
+    if (cache.elements.size() == 0) {
         HILOG_DEBUG("windowId %{public}d element is null", windowId);
+        missCount_++;
         return false;
     }
 
-    if (cache.find(elementId) == cache.end() && elementId != ROOT_NONE_ID) {
-        HILOG_DEBUG("elementId %{public}" PRId64 " is not existed", elementId);
+    if ((fieldMask & ~cache.fieldMask) != 0) {
+        HILOG_DEBUG("windowId %{public}d cached fields[0x%{public}x] miss the requested fields[0x%{public}x]",
+            windowId, cache.fieldMask, fieldMask);
+        missCount_++;
         return false;
     }
 
-    int64_t realElementId = elementId;
-    if (realElementId == ROOT_NONE_ID) {
-        for (auto iter = cache.begin(); iter != cache.end(); iter++) {
-            if (iter->second->GetComponentType() == "root") {
-                realElementId = iter->first;
-                HILOG_DEBUG("find realElementId %{public}" PRId64 "", realElementId);
-                break;
-            }
-        }
+    if (cache.elements.find(elementId) == cache.elements.end() && elementId != ROOT_NONE_ID) {
+        HILOG_DEBUG("elementId %{public}" PRId64 " is not existed", elementId);
+        missCount_++;
+        return false;
     }
 
+    int64_t realElementId = (elementId == ROOT_NONE_ID) ? cache.rootElementId : elementId;
     if (realElementId == ROOT_NONE_ID) {
         HILOG_ERROR("elementId %{public}" PRId64 " is not existed", realElementId);
+        missCount_++;
         return false;
     }
 
     if (!GetElementByWindowIdBFS(realElementId, elementInfos, cache)) {
         HILOG_DEBUG("get window element fail");
+        missCount_++;
         return false;
     }
 
+    hitCount_++;
+    lruWindowIds_.splice(lruWindowIds_.begin(), lruWindowIds_, cache.lruIter);
     HILOG_DEBUG("get element info success, element size %{public}zu", elementInfos.size());
     return true;
 }
 
-void AccessibleAbilityClientImpl::ElementCacheInfo::RemoveElementByWindowId(const int32_t windowId)
+bool AccessibleAbilityClientImpl::ElementCacheInfo::InvalidateElements(const int32_t windowId,
+    const int64_t elementId, const CacheInvalidationScope scope, int64_t& parentElementId)
 {
     std::lock_guard<ffrt::mutex> lock(elementCacheMutex_);
-    HILOG_DEBUG("erase windowId %{public}d cache", windowId);
-    for (auto iter = windowIdSet_.begin(); iter != windowIdSet_.end(); iter++) {
-        if (*iter == windowId) {
-            windowIdSet_.erase(iter);
-            break;
+    parentElementId = ROOT_NONE_ID;
+    auto windowIter = elementCache_.find(windowId);
+    if (windowIter == elementCache_.end()) {
+        return false;
+    }
+    WindowCache& cache = windowIter->second;
+    if (scope == INVALIDATE_WINDOW) {
+        HILOG_DEBUG("erase windowId %{public}d cache", windowId);
+        CountInvalidation(scope, static_cast<uint32_t>(cache.elements.size()));
+        EraseWindow(windowIter);
+        return true;
+    }
+
+    auto iter = cache.elements.find(elementId);
+    if (iter == cache.elements.end()) {
+        return false;
+    }
+    uint32_t count = 0;
+    if (scope == INVALIDATE_NODE) {
+        uint64_t bytes = GetElementCacheBytes(*(iter->second));
+        cache.bytes -= bytes;
+        usedBytes_ -= bytes;
+        cache.elements.erase(iter);
+        count = 1;
+    } else {
+        int64_t parentId = iter->second->GetParentNodeId();
+        count = EraseSubtree(cache, elementId);
+        if (cache.elements.find(parentId) != cache.elements.end()) {
+            count += EraseSubtree(cache, parentId, false);
+            parentElementId = parentId;
         }
     }
+    HILOG_DEBUG("windowId %{public}d, elementId %{public}" PRId64 ", invalidate %{public}u elements",
+        windowId, elementId, count);
+    CountInvalidation(scope, count);
+    return true;
+}
 
-    elementCache_.erase(windowId);
+uint32_t AccessibleAbilityClientImpl::ElementCacheInfo::EraseSubtree(WindowCache& cache, const int64_t elementId,
+    const bool withChildren)
+{
+    uint32_t count = 0;
+    std::vector<int64_t> elementList;
+    elementList.push_back(elementId);
+    for (size_t index = 0; index < elementList.size(); index++) {
+        auto iter = cache.elements.find(elementList[index]);
+        if (iter == cache.elements.end()) {
+            // an erased node is never visited again, so a cycle stops here
+            continue;
+        }
+        if (withChildren) {
+            const std::vector<int64_t>& childrenNode = iter->second->GetChildIds();
+            elementList.insert(elementList.end(), childrenNode.begin(), childrenNode.end());
+        }
+        uint64_t bytes = GetElementCacheBytes(*(iter->second));
+        cache.bytes -= bytes;
+        usedBytes_ -= bytes;
+        cache.elements.erase(iter);
+        count++;
+    }
+    return count;
 }
 
-bool AccessibleAbilityClientImpl::ElementCacheInfo::IsExistWindowId(int32_t windowId)
+void AccessibleAbilityClientImpl::ElementCacheInfo::CountInvalidation(const CacheInvalidationScope scope,
+    const uint32_t count)
+{
+    switch (scope) {
+        case INVALIDATE_NODE:
+            nodeEventInvalidatedCount_ += count;
+            break;
+        case INVALIDATE_SUBTREE:
+            subtreeEventInvalidatedCount_ += count;
+            break;
+        case INVALIDATE_WINDOW:
+            windowEventInvalidatedCount_ += count;
+            break;
+        default:
+            break;
+    }
+}
+
+void AccessibleAbilityClientImpl::ElementCacheInfo::UpdateElements(const int32_t windowId,
+    const std::vector<AccessibilityElementInfo>& elementInfos, const uint32_t fieldMask)
 {
     std::lock_guard<ffrt::mutex> lock(elementCacheMutex_);
-    for (auto iter = windowIdSet_.begin(); iter != windowIdSet_.end(); iter++) {
-        if (*iter == windowId) {
-            return true;
+    auto windowIter = elementCache_.find(windowId);
+    if (windowIter == elementCache_.end()) {
+        HILOG_DEBUG("windowId %{public}d is evicted", windowId);
+        return;
+    }
+    WindowCache& cache = windowIter->second;
+    // the window now mixes elements of both fetches, only the fields common to them are known
+    cache.fieldMask &= fieldMask;
+    for (auto& elementInfo : elementInfos) {
+        int64_t elementId = elementInfo.GetAccessibilityId();
+        auto iter = cache.elements.find(elementId);
+        if (iter != cache.elements.end()) {
+            uint64_t oldBytes = GetElementCacheBytes(*(iter->second));
+            cache.bytes -= oldBytes;
+            usedBytes_ -= oldBytes;
+        }
+        if (elementInfo.GetComponentType() == "root") {
+            cache.rootElementId = elementId;
         }
+        uint64_t bytes = GetElementCacheBytes(elementInfo);
+        cache.bytes += bytes;
+        usedBytes_ += bytes;
+        cache.elements[elementId] = std::make_shared<AccessibilityElementInfo>(elementInfo);
     }
+    EvictIfNecessary();
+}
 
-    return false;
+bool AccessibleAbilityClientImpl::ElementCacheInfo::IsExistWindowId(int32_t windowId)
+{
+    std::lock_guard<ffrt::mutex> lock(elementCacheMutex_);
+    return elementCache_.find(windowId) != elementCache_.end();
+}
+
+void AccessibleAbilityClientImpl::ElementCacheInfo::SetMemoryBudget(const uint64_t budgetBytes)
+{
+    std::lock_guard<ffrt::mutex> lock(elementCacheMutex_);
+    budgetBytes_ = budgetBytes;
+    EvictIfNecessary();
+}
+
+void AccessibleAbilityClientImpl::ElementCacheInfo::GetStatistics(ElementCacheStatistics &statistics)
+{
+    std::lock_guard<ffrt::mutex> lock(elementCacheMutex_);
+    statistics.hitCount = hitCount_;
+    statistics.missCount = missCount_;
+    statistics.evictionCount = evictionCount_;
+    statistics.windowCount = static_cast<uint32_t>(elementCache_.size());
+    uint32_t elementCount = 0;
+    for (auto& window : elementCache_) {
+        elementCount += static_cast<uint32_t>(window.second.elements.size());
+    }
+    statistics.elementCount = elementCount;
+    statistics.usedBytes = usedBytes_;
+    statistics.budgetBytes = budgetBytes_;
+    statistics.nodeEventInvalidatedCount = nodeEventInvalidatedCount_;
+    statistics.subtreeEventInvalidatedCount = subtreeEventInvalidatedCount_;
+    statistics.windowEventInvalidatedCount = windowEventInvalidatedCount_;
 }
 
 bool AccessibleAbilityClientImpl::SceneBoardWindowElementMap::IsExistWindowId(int32_t windowId)
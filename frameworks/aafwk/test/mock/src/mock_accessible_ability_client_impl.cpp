@@ -272,6 +272,27 @@ RetError AccessibleAbilityClientImpl::SetCacheMode(const int32_t cacheMode)
     return RET_OK;
 }
 
+RetError AccessibleAbilityClientImpl::SetElementFieldMask(const uint32_t fieldMask)
+{
+    HILOG_DEBUG();
+    (void)fieldMask;
+    return RET_OK;
+}
+
+RetError AccessibleAbilityClientImpl::SetCacheMemoryBudget(const uint64_t budgetBytes)
+{
+    HILOG_DEBUG();
+    (void)budgetBytes;
+    return RET_OK;
+}
+
+RetError AccessibleAbilityClientImpl::GetCacheStatistics(ElementCacheStatistics &statistics)
+{
+    HILOG_DEBUG();
+    (void)statistics;
+    return RET_OK;
+}
+
 RetError AccessibleAbilityClientImpl::Connect()
 {
     HILOG_DEBUG();
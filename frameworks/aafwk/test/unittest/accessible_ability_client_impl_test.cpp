@@ -34,6 +34,8 @@ namespace {
     constexpr int INVALID_ID = -1;
     constexpr int32_t WINDOW_ID = 2;
     constexpr int64_t ELEMENT_ID = 1;
+    constexpr int64_t TREE_ELEMENT_ID = (static_cast<int64_t>(1) << 40) + 1;
+    constexpr int64_t VIRTUAL_ROOT_ID = 0x7FFFFFFE;
 } // namespace
 
 class AccessibleAbilityClientImplTest : public ::testing::Test {
@@ -1052,6 +1054,192 @@ HWTEST_F(AccessibleAbilityClientImplTest, AddCacheByAce_001, TestSize.Level1)
     GTEST_LOG_(INFO) << "AddCacheByAce_001 end";
 }
 
+/**
+ * @tc.number: AddCacheByAce_002
+ * @tc.name: AddCacheByAce
+ * @tc.desc: Test the cache fetched with a narrower field mask misses a request for more fields
+ */
+HWTEST_F(AccessibleAbilityClientImplTest, AddCacheByAce_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AddCacheByAce_002 start";
+    AccessibilityElementInfo elementInfo;
+    elementInfo.SetAccessibilityId(ELEMENT_ID);
+    std::vector<AccessibilityElementInfo> info;
+    info.push_back(elementInfo);
+    instance_->AddCacheByAce(WINDOW_ID, ELEMENT_ID, info, ELEMENT_FIELD_BASIC);
+    std::vector<AccessibilityElementInfo> result;
+    EXPECT_EQ(instance_->SetElementFieldMask(ELEMENT_FIELD_BASIC), RET_OK);
+    EXPECT_EQ(instance_->GetElementInfoFromCache(WINDOW_ID, ELEMENT_ID, result), RET_OK);
+    EXPECT_EQ(result.size(), 1);
+
+    EXPECT_EQ(instance_->SetElementFieldMask(ELEMENT_FIELD_DESCRIPTION), RET_OK);
+    EXPECT_EQ(instance_->GetElementInfoFromCache(WINDOW_ID, ELEMENT_ID, result), RET_ERR_FAILED);
+    EXPECT_EQ(result.size(), 0);
+
+    instance_->AddCacheByAce(WINDOW_ID, ELEMENT_ID, info, ELEMENT_FIELD_DESCRIPTION);
+    EXPECT_EQ(instance_->GetElementInfoFromCache(WINDOW_ID, ELEMENT_ID, result), RET_OK);
+    EXPECT_EQ(result.size(), 1);
+    GTEST_LOG_(INFO) << "AddCacheByAce_002 end";
+}
+
+/**
+ * @tc.number: SetCacheMemoryBudget_001
+ * @tc.name: SetCacheMemoryBudget
+ * @tc.desc: Test the element cache keeps 64-bit element ids and evicts the least recently used window
+ */
+HWTEST_F(AccessibleAbilityClientImplTest, SetCacheMemoryBudget_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SetCacheMemoryBudget_001 start";
+    AccessibilityElementInfo elementInfo;
+    elementInfo.SetAccessibilityId(TREE_ELEMENT_ID);
+    std::vector<AccessibilityElementInfo> info;
+    info.push_back(elementInfo);
+    instance_->AddCacheByAce(WINDOW_ID, TREE_ELEMENT_ID, info);
+    std::vector<AccessibilityElementInfo> result;
+    EXPECT_EQ(instance_->GetElementInfoFromCache(WINDOW_ID, TREE_ELEMENT_ID, result), RET_OK);
+    EXPECT_EQ(result.size(), 1);
+    EXPECT_EQ(instance_->GetElementInfoFromCache(WINDOW_ID, ELEMENT_ID, result), RET_ERR_FAILED);
+
+    ElementCacheStatistics statistics;
+    EXPECT_EQ(instance_->GetCacheStatistics(statistics), RET_OK);
+    EXPECT_EQ(statistics.hitCount, 1);
+    EXPECT_EQ(statistics.missCount, 1);
+    EXPECT_EQ(statistics.windowCount, 1);
+
+    // only one window fits in the budget, adding another one evicts the first
+    EXPECT_EQ(instance_->SetCacheMemoryBudget(statistics.usedBytes), RET_OK);
+    instance_->AddCacheByAce(WINDOW_ID + 1, TREE_ELEMENT_ID, info);
+    EXPECT_EQ(instance_->GetElementInfoFromCache(WINDOW_ID, TREE_ELEMENT_ID, result), RET_ERR_FAILED);
+    EXPECT_EQ(instance_->GetElementInfoFromCache(WINDOW_ID + 1, TREE_ELEMENT_ID, result), RET_OK);
+    EXPECT_EQ(instance_->GetCacheStatistics(statistics), RET_OK);
+    EXPECT_EQ(statistics.evictionCount, 1);
+    EXPECT_EQ(statistics.windowCount, 1);
+    EXPECT_LE(statistics.usedBytes, statistics.budgetBytes);
+    GTEST_LOG_(INFO) << "SetCacheMemoryBudget_001 end";
+}
+
+/**
+ * @tc.number: RemoveCacheData_001
+ * @tc.name: RemoveCacheData
+ * @tc.desc: Test a text update event invalidates the source node only
+ */
+HWTEST_F(AccessibleAbilityClientImplTest, RemoveCacheData_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "RemoveCacheData_001 start";
+    std::vector<AccessibilityElementInfo> infos;
+    AccessibilityElementInfo rootInfo;
+    rootInfo.SetAccessibilityId(TREE_ELEMENT_ID);
+    rootInfo.AddChild(TREE_ELEMENT_ID + 1);
+    rootInfo.AddChild(TREE_ELEMENT_ID + 2);
+    infos.push_back(rootInfo);
+    for (int64_t childId = TREE_ELEMENT_ID + 1; childId <= TREE_ELEMENT_ID + 2; childId++) {
+        AccessibilityElementInfo childInfo;
+        childInfo.SetAccessibilityId(childId);
+        childInfo.SetParent(TREE_ELEMENT_ID);
+        infos.push_back(childInfo);
+    }
+    instance_->AddCacheByAce(WINDOW_ID, TREE_ELEMENT_ID, infos);
+
+    AccessibilityEventInfo eventInfo;
+    eventInfo.SetEventType(TYPE_VIEW_TEXT_UPDATE_EVENT);
+    eventInfo.SetWindowId(WINDOW_ID);
+    eventInfo.SetSource(TREE_ELEMENT_ID + 1);
+    instance_->RemoveCacheData(eventInfo);
+
+    std::vector<AccessibilityElementInfo> result;
+    EXPECT_EQ(instance_->GetElementInfoFromCache(WINDOW_ID, TREE_ELEMENT_ID + 1, result), RET_ERR_FAILED);
+    EXPECT_EQ(instance_->GetElementInfoFromCache(WINDOW_ID, TREE_ELEMENT_ID + 2, result), RET_OK);
+    ElementCacheStatistics statistics;
+    EXPECT_EQ(instance_->GetCacheStatistics(statistics), RET_OK);
+    EXPECT_EQ(statistics.nodeEventInvalidatedCount, 1);
+    EXPECT_EQ(statistics.windowEventInvalidatedCount, 0);
+    EXPECT_EQ(statistics.windowCount, 1);
+    GTEST_LOG_(INFO) << "RemoveCacheData_001 end";
+}
+
+/**
+ * @tc.number: RemoveCacheData_002
+ * @tc.name: RemoveCacheData
+ * @tc.desc: Test a page content update event invalidates the source subtree and the parent only
+ */
+HWTEST_F(AccessibleAbilityClientImplTest, RemoveCacheData_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "RemoveCacheData_002 start";
+    std::vector<AccessibilityElementInfo> infos;
+    AccessibilityElementInfo rootInfo;
+    rootInfo.SetAccessibilityId(TREE_ELEMENT_ID);
+    rootInfo.AddChild(TREE_ELEMENT_ID + 1);
+    rootInfo.AddChild(TREE_ELEMENT_ID + 2);
+    infos.push_back(rootInfo);
+    AccessibilityElementInfo sourceInfo;
+    sourceInfo.SetAccessibilityId(TREE_ELEMENT_ID + 1);
+    sourceInfo.SetParent(TREE_ELEMENT_ID);
+    sourceInfo.AddChild(TREE_ELEMENT_ID + 3);
+    infos.push_back(sourceInfo);
+    AccessibilityElementInfo siblingInfo;
+    siblingInfo.SetAccessibilityId(TREE_ELEMENT_ID + 2);
+    siblingInfo.SetParent(TREE_ELEMENT_ID);
+    infos.push_back(siblingInfo);
+    AccessibilityElementInfo grandChildInfo;
+    grandChildInfo.SetAccessibilityId(TREE_ELEMENT_ID + 3);
+    grandChildInfo.SetParent(TREE_ELEMENT_ID + 1);
+    infos.push_back(grandChildInfo);
+    instance_->AddCacheByAce(WINDOW_ID, TREE_ELEMENT_ID, infos);
+
+    AccessibilityEventInfo eventInfo;
+    eventInfo.SetEventType(TYPE_PAGE_CONTENT_UPDATE);
+    eventInfo.SetWindowId(WINDOW_ID);
+    eventInfo.SetSource(TREE_ELEMENT_ID + 1);
+    instance_->RemoveCacheData(eventInfo);
+
+    // without a channel the dropped regions are not refetched, so they miss until the next search
+    std::vector<AccessibilityElementInfo> result;
+    EXPECT_EQ(instance_->GetElementInfoFromCache(WINDOW_ID, TREE_ELEMENT_ID + 1, result), RET_ERR_FAILED);
+    EXPECT_EQ(instance_->GetElementInfoFromCache(WINDOW_ID, TREE_ELEMENT_ID + 3, result), RET_ERR_FAILED);
+    EXPECT_EQ(instance_->GetElementInfoFromCache(WINDOW_ID, TREE_ELEMENT_ID, result), RET_ERR_FAILED);
+    EXPECT_EQ(instance_->GetElementInfoFromCache(WINDOW_ID, TREE_ELEMENT_ID + 2, result), RET_OK);
+    ElementCacheStatistics statistics;
+    EXPECT_EQ(instance_->GetCacheStatistics(statistics), RET_OK);
+    EXPECT_EQ(statistics.subtreeEventInvalidatedCount, 3);
+    EXPECT_EQ(statistics.windowEventInvalidatedCount, 0);
+    EXPECT_EQ(statistics.windowCount, 1);
+    EXPECT_EQ(statistics.elementCount, 1);
+    GTEST_LOG_(INFO) << "RemoveCacheData_002 end";
+}
+
+/**
+ * @tc.number: SortElementInfosIfNecessary_001
+ * @tc.name: SortElementInfosIfNecessary
+ * @tc.desc: Test the element infos are sorted breadth first and a cycle is visited once
+ */
+HWTEST_F(AccessibleAbilityClientImplTest, SortElementInfosIfNecessary_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SortElementInfosIfNecessary_001 start";
+    std::vector<AccessibilityElementInfo> infos;
+    AccessibilityElementInfo virtualRoot;
+    virtualRoot.SetAccessibilityId(VIRTUAL_ROOT_ID);
+    virtualRoot.AddChild(ELEMENT_ID);
+    infos.push_back(virtualRoot);
+    AccessibilityElementInfo grandChild;
+    grandChild.SetAccessibilityId(ELEMENT_ID + 1);
+    grandChild.AddChild(ELEMENT_ID);
+    infos.push_back(grandChild);
+    AccessibilityElementInfo orphan;
+    orphan.SetAccessibilityId(ELEMENT_ID + 2);
+    infos.push_back(orphan);
+    AccessibilityElementInfo child;
+    child.SetAccessibilityId(ELEMENT_ID);
+    child.AddChild(ELEMENT_ID + 1);
+    infos.push_back(child);
+
+    AccessibleAbilityClientImpl::SortElementInfosIfNecessary(infos);
+    ASSERT_EQ(infos.size(), 3);
+    EXPECT_EQ(infos[0].GetAccessibilityId(), VIRTUAL_ROOT_ID);
+    EXPECT_EQ(infos[1].GetAccessibilityId(), ELEMENT_ID);
+    EXPECT_EQ(infos[2].GetAccessibilityId(), ELEMENT_ID + 1);
+    GTEST_LOG_(INFO) << "SortElementInfosIfNecessary_001 end";
+}
+
 /**
  * @tc.number: GetByContent_003
  * @tc.name: GetByContent
@@ -16,6 +16,7 @@
 #ifndef ACCESSIBILITY_CONFIG_IMPL_H
 #define ACCESSIBILITY_CONFIG_IMPL_H
 
+#include <atomic>
 #include "accessibility_config.h"
 #include "accessibility_enable_ability_lists_observer_stub.h"
 #include "accessible_ability_manager_caption_observer_stub.h"
@@ -299,6 +300,27 @@ private:
     void OnIgnoreRepeatClickStateChanged(const uint32_t stateType);
     bool CheckSaStatus();
 
+    /**
+     * @brief Check whether the getter of the config can be served from the local values.
+     *        The caller should hold mutex_.
+     * @param id The config id.
+     * @return True: the local value is current; otherwise the service has to be asked.
+     */
+    bool IsConfigCached(const CONFIG_ID id) const;
+
+    /**
+     * @brief Mark the config as changed by this process and not confirmed by the service yet.
+     *        The caller should hold mutex_.
+     * @param id The config id.
+     */
+    void InvalidateConfigCache(const CONFIG_ID id);
+
+    /**
+     * @brief Mark the config as confirmed by the config observer. The caller should hold mutex_.
+     * @param id The config id.
+     */
+    void ValidateConfigCache(const CONFIG_ID id);
+
     sptr<Accessibility::IAccessibleAbilityManagerService> serviceProxy_ = nullptr;
     sptr<AccessibleAbilityManagerCaptionObserverImpl> captionObserver_ = nullptr;
     sptr<AccessibleAbilityManagerConfigObserverImpl> configObserver_ = nullptr;
@@ -325,6 +347,12 @@ private:
     bool ignoreRepeatClickState_ = false;
     CaptionProperty captionProperty_ = {};
 
+    // The local config values are served by the getters only while configCacheVersion_ matches
+    // serviceVersion_, which changes every time the service dies.
+    std::atomic<uint32_t> serviceVersion_ = 1;
+    std::atomic<uint32_t> configCacheVersion_ = 0;
+    uint32_t staleConfigs_ = 0; // bit (1 << CONFIG_ID) is set while a set request awaits its notification
+
     sptr<IRemoteObject::DeathRecipient> deathRecipient_ = nullptr;
 
     std::vector<std::string> shortkeyMultiTarget_ {};
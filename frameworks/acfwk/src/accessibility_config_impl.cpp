@@ -219,6 +219,8 @@ bool AccessibilityConfig::Impl::RegisterToService()
         uint32_t ret = serviceProxy_->RegisterCaptionObserver(captionObserver_);
         if (ret != 0) {
             HILOG_ERROR("Register captionObserver failed.");
+            // an unregistered observer gets no change, so the configs must not be served from the cache
+            captionObserver_ = nullptr;
             return false;
         }
     }
@@ -241,6 +243,7 @@ bool AccessibilityConfig::Impl::RegisterToService()
         uint32_t ret = serviceProxy_->RegisterConfigObserver(configObserver_);
         if (ret != 0) {
             HILOG_ERROR("Register configObserver failed.");
+            configObserver_ = nullptr;
             return false;
         }
     }
@@ -270,11 +273,31 @@ void AccessibilityConfig::Impl::ResetService(const wptr<IRemoteObject> &remote)
             enableAbilityListsObserver_ = nullptr;
             configObserver_ = nullptr;
             isInitialized_ = false;
+            // The cached configs belong to the dead service; they are reloaded on reconnection.
+            serviceVersion_++;
             HILOG_INFO("ResetService ok");
         }
     }
 }
 
+bool AccessibilityConfig::Impl::IsConfigCached(const CONFIG_ID id) const
+{
+    if (configCacheVersion_.load() != serviceVersion_.load()) {
+        return false;
+    }
+    return (staleConfigs_ & (1u << static_cast<uint32_t>(id))) == 0;
+}
+
+void AccessibilityConfig::Impl::InvalidateConfigCache(const CONFIG_ID id)
+{
+    staleConfigs_ |= (1u << static_cast<uint32_t>(id));
+}
+
+void AccessibilityConfig::Impl::ValidateConfigCache(const CONFIG_ID id)
+{
+    staleConfigs_ &= ~(1u << static_cast<uint32_t>(id));
+}
+
 bool AccessibilityConfig::Impl::CheckSaStatus()
 {
     std::vector<int> dependentSa = {
@@ -323,6 +346,10 @@ Accessibility::RetError AccessibilityConfig::Impl::DisableAbility(const std::str
 Accessibility::RetError AccessibilityConfig::Impl::GetCaptionsState(bool &state)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (IsConfigCached(CONFIG_CAPTION_STATE)) {
+        state = captionState_;
+        return Accessibility::RET_OK;
+    }
     if (!GetServiceProxy()) {
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
@@ -335,6 +362,10 @@ Accessibility::RetError AccessibilityConfig::Impl::GetCaptionsState(bool &state)
 Accessibility::RetError AccessibilityConfig::Impl::GetCaptionsProperty(CaptionProperty &caption)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (IsConfigCached(CONFIG_CAPTION_STYLE)) {
+        caption = captionProperty_;
+        return Accessibility::RET_OK;
+    }
     if (!GetServiceProxy()) {
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
@@ -352,7 +383,9 @@ Accessibility::RetError AccessibilityConfig::Impl::SetCaptionsProperty(const Cap
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
     }
-    return GetServiceProxy()->SetCaptionProperty(caption);
+    Accessibility::RetError ret = GetServiceProxy()->SetCaptionProperty(caption);
+    InvalidateConfigCache(CONFIG_CAPTION_STYLE);
+    return ret;
 }
 
 Accessibility::RetError AccessibilityConfig::Impl::SetCaptionsState(const bool state)
@@ -363,7 +396,9 @@ Accessibility::RetError AccessibilityConfig::Impl::SetCaptionsState(const bool s
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
     }
-    return GetServiceProxy()->SetCaptionState(state);
+    Accessibility::RetError ret = GetServiceProxy()->SetCaptionState(state);
+    InvalidateConfigCache(CONFIG_CAPTION_STATE);
+    return ret;
 }
 
 void AccessibilityConfig::Impl::NotifyCaptionStateChanged(
@@ -447,6 +482,7 @@ void AccessibilityConfig::Impl::OnAccessibleAbilityManagerCaptionPropertyChanged
     std::vector<std::shared_ptr<AccessibilityConfigObserver>> observers;
     {
         std::lock_guard<ffrt::mutex> lock(mutex_);
+        ValidateConfigCache(CONFIG_CAPTION_STYLE);
         if (captionProperty_.GetFontScale() == property.GetFontScale() &&
             captionProperty_.GetFontColor() == property.GetFontColor() &&
             !strcmp(captionProperty_.GetFontFamily().c_str(), property.GetFontFamily().c_str()) &&
@@ -475,7 +511,9 @@ Accessibility::RetError AccessibilityConfig::Impl::SetScreenMagnificationState(c
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
     }
-    return GetServiceProxy()->SetScreenMagnificationState(state);
+    Accessibility::RetError ret = GetServiceProxy()->SetScreenMagnificationState(state);
+    InvalidateConfigCache(CONFIG_SCREEN_MAGNIFICATION);
+    return ret;
 }
 
 Accessibility::RetError AccessibilityConfig::Impl::SetShortKeyState(const bool state)
@@ -486,7 +524,9 @@ Accessibility::RetError AccessibilityConfig::Impl::SetShortKeyState(const bool s
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
     }
-    return GetServiceProxy()->SetShortKeyState(state);
+    Accessibility::RetError ret = GetServiceProxy()->SetShortKeyState(state);
+    InvalidateConfigCache(CONFIG_SHORT_KEY);
+    return ret;
 }
 
 Accessibility::RetError AccessibilityConfig::Impl::SetMouseKeyState(const bool state)
@@ -497,12 +537,18 @@ Accessibility::RetError AccessibilityConfig::Impl::SetMouseKeyState(const bool s
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
     }
-    return GetServiceProxy()->SetMouseKeyState(state);
+    Accessibility::RetError ret = GetServiceProxy()->SetMouseKeyState(state);
+    InvalidateConfigCache(CONFIG_MOUSE_KEY);
+    return ret;
 }
 
 Accessibility::RetError AccessibilityConfig::Impl::GetScreenMagnificationState(bool &state)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (IsConfigCached(CONFIG_SCREEN_MAGNIFICATION)) {
+        state = screenMagnifier_;
+        return Accessibility::RET_OK;
+    }
     if (!GetServiceProxy()) {
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
@@ -516,6 +562,10 @@ Accessibility::RetError AccessibilityConfig::Impl::GetScreenMagnificationState(b
 Accessibility::RetError AccessibilityConfig::Impl::GetShortKeyState(bool &state)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (IsConfigCached(CONFIG_SHORT_KEY)) {
+        state = shortkey_;
+        return Accessibility::RET_OK;
+    }
     if (!GetServiceProxy()) {
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
@@ -529,6 +579,10 @@ Accessibility::RetError AccessibilityConfig::Impl::GetShortKeyState(bool &state)
 Accessibility::RetError AccessibilityConfig::Impl::GetMouseKeyState(bool &state)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (IsConfigCached(CONFIG_MOUSE_KEY)) {
+        state = mouseKey_;
+        return Accessibility::RET_OK;
+    }
     if (!GetServiceProxy()) {
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
@@ -544,6 +598,7 @@ void AccessibilityConfig::Impl::UpdateCaptionEnabled(const bool enabled)
     std::vector<std::shared_ptr<AccessibilityConfigObserver>> observers;
     {
         std::lock_guard<ffrt::mutex> lock(mutex_);
+        ValidateConfigCache(CONFIG_CAPTION_STATE);
         if (captionState_ == enabled) {
             return;
         }
@@ -563,6 +618,7 @@ void AccessibilityConfig::Impl::UpdateScreenMagnificationEnabled(const bool enab
     std::vector<std::shared_ptr<AccessibilityConfigObserver>> observers;
     {
         std::lock_guard<ffrt::mutex> lock(mutex_);
+        ValidateConfigCache(CONFIG_SCREEN_MAGNIFICATION);
         if (screenMagnifier_ == enabled) {
             return;
         }
@@ -582,6 +638,7 @@ void AccessibilityConfig::Impl::UpdateShortKeyEnabled(const bool enabled)
     std::vector<std::shared_ptr<AccessibilityConfigObserver>> observers;
     {
         std::lock_guard<ffrt::mutex> lock(mutex_);
+        ValidateConfigCache(CONFIG_SHORT_KEY);
         if (shortkey_ == enabled) {
             return;
         }
@@ -601,6 +658,7 @@ void AccessibilityConfig::Impl::UpdateMouseKeyEnabled(const bool enabled)
     std::vector<std::shared_ptr<AccessibilityConfigObserver>> observers;
     {
         std::lock_guard<ffrt::mutex> lock(mutex_);
+        ValidateConfigCache(CONFIG_MOUSE_KEY);
         if (mouseKey_ == enabled) {
             return;
         }
@@ -620,6 +678,7 @@ void AccessibilityConfig::Impl::UpdateAudioMonoEnabled(const bool enabled)
     std::vector<std::shared_ptr<AccessibilityConfigObserver>> observers;
     {
         std::lock_guard<ffrt::mutex> lock(mutex_);
+        ValidateConfigCache(CONFIG_AUDIO_MONO);
         if (audioMono_ == enabled) {
             return;
         }
@@ -639,6 +698,7 @@ void AccessibilityConfig::Impl::UpdateAnimationOffEnabled(const bool enabled)
     std::vector<std::shared_ptr<AccessibilityConfigObserver>> observers;
     {
         std::lock_guard<ffrt::mutex> lock(mutex_);
+        ValidateConfigCache(CONFIG_ANIMATION_OFF);
         if (animationOff_ == enabled) {
             return;
         }
@@ -659,6 +719,7 @@ void AccessibilityConfig::Impl::UpdateInvertColorEnabled(const bool enabled)
     std::vector<std::shared_ptr<AccessibilityConfigObserver>> observers;
     {
         std::lock_guard<ffrt::mutex> lock(mutex_);
+        ValidateConfigCache(CONFIG_INVERT_COLOR);
         if (invertColor_ == enabled) {
             return;
         }
@@ -679,6 +740,7 @@ void AccessibilityConfig::Impl::UpdateHighContrastTextEnabled(const bool enabled
     std::vector<std::shared_ptr<AccessibilityConfigObserver>> observers;
     {
         std::lock_guard<ffrt::mutex> lock(mutex_);
+        ValidateConfigCache(CONFIG_HIGH_CONTRAST_TEXT);
         if (highContrastText_ == enabled) {
             return;
         }
@@ -699,6 +761,7 @@ void AccessibilityConfig::Impl::UpdateDaltonizationStateEnabled(const bool enabl
     std::vector<std::shared_ptr<AccessibilityConfigObserver>> observers;
     {
         std::lock_guard<ffrt::mutex> lock(mutex_);
+        ValidateConfigCache(CONFIG_DALTONIZATION_STATE);
         if (daltonizationState_ == enabled) {
             return;
         }
@@ -725,6 +788,7 @@ void AccessibilityConfig::Impl::UpdateIgnoreRepeatClickStateEnabled(const bool e
     std::vector<std::shared_ptr<AccessibilityConfigObserver>> observers;
     {
         std::lock_guard<ffrt::mutex> lock(mutex_);
+        ValidateConfigCache(CONFIG_IGNORE_REPEAT_CLICK_STATE);
         if (ignoreRepeatClickState_ == enabled) {
             return;
         }
@@ -867,7 +931,9 @@ Accessibility::RetError AccessibilityConfig::Impl::SetMouseAutoClick(const int32
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
     }
-    return GetServiceProxy()->SetMouseAutoClick(time);
+    Accessibility::RetError ret = GetServiceProxy()->SetMouseAutoClick(time);
+    InvalidateConfigCache(CONFIG_MOUSE_AUTOCLICK);
+    return ret;
 }
 
 Accessibility::RetError AccessibilityConfig::Impl::SetShortkeyTarget(const std::string& name)
@@ -878,7 +944,9 @@ Accessibility::RetError AccessibilityConfig::Impl::SetShortkeyTarget(const std::
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
     }
-    return GetServiceProxy()->SetShortkeyTarget(name);
+    Accessibility::RetError ret = GetServiceProxy()->SetShortkeyTarget(name);
+    InvalidateConfigCache(CONFIG_SHORT_KEY_TARGET);
+    return ret;
 }
 
 Accessibility::RetError AccessibilityConfig::Impl::SetShortkeyMultiTarget(const std::vector<std::string>& name)
@@ -889,12 +957,18 @@ Accessibility::RetError AccessibilityConfig::Impl::SetShortkeyMultiTarget(const
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
     }
-    return GetServiceProxy()->SetShortkeyMultiTarget(name);
+    Accessibility::RetError ret = GetServiceProxy()->SetShortkeyMultiTarget(name);
+    InvalidateConfigCache(CONFIG_SHORT_KEY_MULTI_TARGET);
+    return ret;
 }
 
 Accessibility::RetError AccessibilityConfig::Impl::GetMouseAutoClick(int32_t &time)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (IsConfigCached(CONFIG_MOUSE_AUTOCLICK)) {
+        time = mouseAutoClick_;
+        return Accessibility::RET_OK;
+    }
     if (!GetServiceProxy()) {
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
@@ -908,6 +982,10 @@ Accessibility::RetError AccessibilityConfig::Impl::GetMouseAutoClick(int32_t &ti
 Accessibility::RetError AccessibilityConfig::Impl::GetShortkeyTarget(std::string &name)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (IsConfigCached(CONFIG_SHORT_KEY_TARGET)) {
+        name = shortkeyTarget_;
+        return Accessibility::RET_OK;
+    }
     if (!GetServiceProxy()) {
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
@@ -921,6 +999,10 @@ Accessibility::RetError AccessibilityConfig::Impl::GetShortkeyTarget(std::string
 Accessibility::RetError AccessibilityConfig::Impl::GetShortkeyMultiTarget(std::vector<std::string> &name)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (IsConfigCached(CONFIG_SHORT_KEY_MULTI_TARGET)) {
+        name = shortkeyMultiTarget_;
+        return Accessibility::RET_OK;
+    }
     if (!GetServiceProxy()) {
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
@@ -1095,7 +1177,9 @@ Accessibility::RetError AccessibilityConfig::Impl::SetHighContrastTextState(cons
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
     }
-    return GetServiceProxy()->SetHighContrastTextState(state);
+    Accessibility::RetError ret = GetServiceProxy()->SetHighContrastTextState(state);
+    InvalidateConfigCache(CONFIG_HIGH_CONTRAST_TEXT);
+    return ret;
 }
 
 Accessibility::RetError AccessibilityConfig::Impl::SetInvertColorState(const bool state)
@@ -1106,7 +1190,9 @@ Accessibility::RetError AccessibilityConfig::Impl::SetInvertColorState(const boo
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
     }
-    return GetServiceProxy()->SetInvertColorState(state);
+    Accessibility::RetError ret = GetServiceProxy()->SetInvertColorState(state);
+    InvalidateConfigCache(CONFIG_INVERT_COLOR);
+    return ret;
 }
 
 Accessibility::RetError AccessibilityConfig::Impl::SetDaltonizationState(const bool state)
@@ -1117,7 +1203,9 @@ Accessibility::RetError AccessibilityConfig::Impl::SetDaltonizationState(const b
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
     }
-    return GetServiceProxy()->SetDaltonizationState(state);
+    Accessibility::RetError ret = GetServiceProxy()->SetDaltonizationState(state);
+    InvalidateConfigCache(CONFIG_DALTONIZATION_STATE);
+    return ret;
 }
 
 Accessibility::RetError AccessibilityConfig::Impl::SetDaltonizationColorFilter(const DALTONIZATION_TYPE type)
@@ -1128,7 +1216,9 @@ Accessibility::RetError AccessibilityConfig::Impl::SetDaltonizationColorFilter(c
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
     }
-    return GetServiceProxy()->SetDaltonizationColorFilter(type);
+    Accessibility::RetError ret = GetServiceProxy()->SetDaltonizationColorFilter(type);
+    InvalidateConfigCache(CONFIG_DALTONIZATION_COLOR_FILTER);
+    return ret;
 }
 
 Accessibility::RetError AccessibilityConfig::Impl::SetContentTimeout(const uint32_t timer)
@@ -1139,7 +1229,9 @@ Accessibility::RetError AccessibilityConfig::Impl::SetContentTimeout(const uint3
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
     }
-    return GetServiceProxy()->SetContentTimeout(timer);
+    Accessibility::RetError ret = GetServiceProxy()->SetContentTimeout(timer);
+    InvalidateConfigCache(CONFIG_CONTENT_TIMEOUT);
+    return ret;
 }
 
 Accessibility::RetError AccessibilityConfig::Impl::SetAnimationOffState(const bool state)
@@ -1150,7 +1242,9 @@ Accessibility::RetError AccessibilityConfig::Impl::SetAnimationOffState(const bo
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
     }
-    return GetServiceProxy()->SetAnimationOffState(state);
+    Accessibility::RetError ret = GetServiceProxy()->SetAnimationOffState(state);
+    InvalidateConfigCache(CONFIG_ANIMATION_OFF);
+    return ret;
 }
 
 Accessibility::RetError AccessibilityConfig::Impl::SetBrightnessDiscount(const float brightness)
@@ -1161,7 +1255,9 @@ Accessibility::RetError AccessibilityConfig::Impl::SetBrightnessDiscount(const f
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
     }
-    return GetServiceProxy()->SetBrightnessDiscount(brightness);
+    Accessibility::RetError ret = GetServiceProxy()->SetBrightnessDiscount(brightness);
+    InvalidateConfigCache(CONFIG_BRIGHTNESS_DISCOUNT);
+    return ret;
 }
 
 Accessibility::RetError AccessibilityConfig::Impl::SetAudioMonoState(const bool state)
@@ -1172,7 +1268,9 @@ Accessibility::RetError AccessibilityConfig::Impl::SetAudioMonoState(const bool
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
     }
-    return GetServiceProxy()->SetAudioMonoState(state);
+    Accessibility::RetError ret = GetServiceProxy()->SetAudioMonoState(state);
+    InvalidateConfigCache(CONFIG_AUDIO_MONO);
+    return ret;
 }
 
 Accessibility::RetError AccessibilityConfig::Impl::SetAudioBalance(const float balance)
@@ -1183,7 +1281,9 @@ Accessibility::RetError AccessibilityConfig::Impl::SetAudioBalance(const float b
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
     }
-    return GetServiceProxy()->SetAudioBalance(balance);
+    Accessibility::RetError ret = GetServiceProxy()->SetAudioBalance(balance);
+    InvalidateConfigCache(CONFIG_AUDIO_BALANCE);
+    return ret;
 }
 
 Accessibility::RetError AccessibilityConfig::Impl::SetClickResponseTime(const CLICK_RESPONSE_TIME time)
@@ -1194,7 +1294,9 @@ Accessibility::RetError AccessibilityConfig::Impl::SetClickResponseTime(const CL
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
     }
-    return GetServiceProxy()->SetClickResponseTime(time);
+    Accessibility::RetError ret = GetServiceProxy()->SetClickResponseTime(time);
+    InvalidateConfigCache(CONIFG_CLICK_RESPONSE_TIME);
+    return ret;
 }
 
 Accessibility::RetError AccessibilityConfig::Impl::SetIgnoreRepeatClickState(const bool state)
@@ -1205,7 +1307,9 @@ Accessibility::RetError AccessibilityConfig::Impl::SetIgnoreRepeatClickState(con
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
     }
-    return GetServiceProxy()->SetIgnoreRepeatClickState(state);
+    Accessibility::RetError ret = GetServiceProxy()->SetIgnoreRepeatClickState(state);
+    InvalidateConfigCache(CONFIG_IGNORE_REPEAT_CLICK_STATE);
+    return ret;
 }
 
 Accessibility::RetError AccessibilityConfig::Impl::SetIgnoreRepeatClickTime(const IGNORE_REPEAT_CLICK_TIME time)
@@ -1216,12 +1320,18 @@ Accessibility::RetError AccessibilityConfig::Impl::SetIgnoreRepeatClickTime(cons
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
     }
-    return GetServiceProxy()->SetIgnoreRepeatClickTime(time);
+    Accessibility::RetError ret = GetServiceProxy()->SetIgnoreRepeatClickTime(time);
+    InvalidateConfigCache(CONFIG_IGNORE_REPEAT_CLICK_TIME);
+    return ret;
 }
 
 Accessibility::RetError AccessibilityConfig::Impl::GetInvertColorState(bool &state)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (IsConfigCached(CONFIG_INVERT_COLOR)) {
+        state = invertColor_;
+        return Accessibility::RET_OK;
+    }
     if (!GetServiceProxy()) {
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
@@ -1235,6 +1345,10 @@ Accessibility::RetError AccessibilityConfig::Impl::GetInvertColorState(bool &sta
 Accessibility::RetError AccessibilityConfig::Impl::GetHighContrastTextState(bool &state)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (IsConfigCached(CONFIG_HIGH_CONTRAST_TEXT)) {
+        state = highContrastText_;
+        return Accessibility::RET_OK;
+    }
     if (!GetServiceProxy()) {
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
@@ -1248,6 +1362,10 @@ Accessibility::RetError AccessibilityConfig::Impl::GetHighContrastTextState(bool
 Accessibility::RetError AccessibilityConfig::Impl::GetDaltonizationState(bool &state)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (IsConfigCached(CONFIG_DALTONIZATION_STATE)) {
+        state = daltonizationState_;
+        return Accessibility::RET_OK;
+    }
     if (!GetServiceProxy()) {
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
@@ -1261,6 +1379,10 @@ Accessibility::RetError AccessibilityConfig::Impl::GetDaltonizationState(bool &s
 Accessibility::RetError AccessibilityConfig::Impl::GetDaltonizationColorFilter(DALTONIZATION_TYPE &type)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (IsConfigCached(CONFIG_DALTONIZATION_COLOR_FILTER)) {
+        type = static_cast<DALTONIZATION_TYPE>(daltonizationColorFilter_);
+        return Accessibility::RET_OK;
+    }
     if (!GetServiceProxy()) {
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
@@ -1276,6 +1398,10 @@ Accessibility::RetError AccessibilityConfig::Impl::GetDaltonizationColorFilter(D
 Accessibility::RetError AccessibilityConfig::Impl::GetContentTimeout(uint32_t &timer)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (IsConfigCached(CONFIG_CONTENT_TIMEOUT)) {
+        timer = contentTimeout_;
+        return Accessibility::RET_OK;
+    }
     if (!GetServiceProxy()) {
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
@@ -1289,6 +1415,10 @@ Accessibility::RetError AccessibilityConfig::Impl::GetContentTimeout(uint32_t &t
 Accessibility::RetError AccessibilityConfig::Impl::GetAnimationOffState(bool &state)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (IsConfigCached(CONFIG_ANIMATION_OFF)) {
+        state = animationOff_;
+        return Accessibility::RET_OK;
+    }
     if (!GetServiceProxy()) {
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
@@ -1302,6 +1432,10 @@ Accessibility::RetError AccessibilityConfig::Impl::GetAnimationOffState(bool &st
 Accessibility::RetError AccessibilityConfig::Impl::GetBrightnessDiscount(float &brightness)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (IsConfigCached(CONFIG_BRIGHTNESS_DISCOUNT)) {
+        brightness = brightnessDiscount_;
+        return Accessibility::RET_OK;
+    }
     if (!GetServiceProxy()) {
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
@@ -1315,6 +1449,10 @@ Accessibility::RetError AccessibilityConfig::Impl::GetBrightnessDiscount(float &
 Accessibility::RetError AccessibilityConfig::Impl::GetAudioMonoState(bool &state)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (IsConfigCached(CONFIG_AUDIO_MONO)) {
+        state = audioMono_;
+        return Accessibility::RET_OK;
+    }
     if (!GetServiceProxy()) {
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
@@ -1328,6 +1466,10 @@ Accessibility::RetError AccessibilityConfig::Impl::GetAudioMonoState(bool &state
 Accessibility::RetError AccessibilityConfig::Impl::GetAudioBalance(float &balance)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (IsConfigCached(CONFIG_AUDIO_BALANCE)) {
+        balance = audioBalance_;
+        return Accessibility::RET_OK;
+    }
     if (!GetServiceProxy()) {
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
@@ -1341,6 +1483,10 @@ Accessibility::RetError AccessibilityConfig::Impl::GetAudioBalance(float &balanc
 Accessibility::RetError AccessibilityConfig::Impl::GetClickResponseTime(CLICK_RESPONSE_TIME &time)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (IsConfigCached(CONIFG_CLICK_RESPONSE_TIME)) {
+        time = static_cast<CLICK_RESPONSE_TIME>(clickResponseTime_);
+        return Accessibility::RET_OK;
+    }
     if (!GetServiceProxy()) {
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
@@ -1356,6 +1502,10 @@ Accessibility::RetError AccessibilityConfig::Impl::GetClickResponseTime(CLICK_RE
 Accessibility::RetError AccessibilityConfig::Impl::GetIgnoreRepeatClickState(bool &state)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (IsConfigCached(CONFIG_IGNORE_REPEAT_CLICK_STATE)) {
+        state = ignoreRepeatClickState_;
+        return Accessibility::RET_OK;
+    }
     if (!GetServiceProxy()) {
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
@@ -1369,6 +1519,10 @@ Accessibility::RetError AccessibilityConfig::Impl::GetIgnoreRepeatClickState(boo
 Accessibility::RetError AccessibilityConfig::Impl::GetIgnoreRepeatClickTime(IGNORE_REPEAT_CLICK_TIME &time)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (IsConfigCached(CONFIG_IGNORE_REPEAT_CLICK_TIME)) {
+        time = static_cast<IGNORE_REPEAT_CLICK_TIME>(ignoreRepeatClickTime_);
+        return Accessibility::RET_OK;
+    }
     if (!GetServiceProxy()) {
         HILOG_ERROR("Failed to get accessibility service");
         return Accessibility::RET_ERR_SAMGR;
@@ -1519,6 +1673,7 @@ void AccessibilityConfig::Impl::OnAccessibleAbilityManagerAudioBalanceChanged(co
     std::vector<std::shared_ptr<AccessibilityConfigObserver>> observers;
     {
         std::lock_guard<ffrt::mutex> lock(mutex_);
+        ValidateConfigCache(CONFIG_AUDIO_BALANCE);
         if (audioBalance_ == audioBalance) {
             return;
         }
@@ -1541,6 +1696,7 @@ void AccessibilityConfig::Impl::OnAccessibleAbilityManagerBrightnessDiscountChan
     std::vector<std::shared_ptr<AccessibilityConfigObserver>> observers;
     {
         std::lock_guard<ffrt::mutex> lock(mutex_);
+        ValidateConfigCache(CONFIG_BRIGHTNESS_DISCOUNT);
         if (brightnessDiscount_ == brightnessDiscount) {
             return;
         }
@@ -1562,6 +1718,7 @@ void AccessibilityConfig::Impl::OnAccessibleAbilityManagerContentTimeoutChanged(
     std::vector<std::shared_ptr<AccessibilityConfigObserver>> observers;
     {
         std::lock_guard<ffrt::mutex> lock(mutex_);
+        ValidateConfigCache(CONFIG_CONTENT_TIMEOUT);
         if (contentTimeout_ == contentTimeout) {
             return;
         }
@@ -1583,6 +1740,7 @@ void AccessibilityConfig::Impl::OnAccessibleAbilityManagerDaltonizationColorFilt
     std::vector<std::shared_ptr<AccessibilityConfigObserver>> observers;
     {
         std::lock_guard<ffrt::mutex> lock(mutex_);
+        ValidateConfigCache(CONFIG_DALTONIZATION_COLOR_FILTER);
         if (daltonizationColorFilter_ == filterType) {
             HILOG_DEBUG("filterType[%{public}u]", daltonizationColorFilter_);
             return;
@@ -1605,6 +1763,7 @@ void AccessibilityConfig::Impl::OnAccessibleAbilityManagerMouseAutoClickChanged(
     std::vector<std::shared_ptr<AccessibilityConfigObserver>> observers;
     {
         std::lock_guard<ffrt::mutex> lock(mutex_);
+        ValidateConfigCache(CONFIG_MOUSE_AUTOCLICK);
         if (mouseAutoClick_ == mouseAutoClick) {
             return;
         }
@@ -1626,6 +1785,7 @@ void AccessibilityConfig::Impl::OnAccessibleAbilityManagerShortkeyTargetChanged(
     std::vector<std::shared_ptr<AccessibilityConfigObserver>> observers;
     {
         std::lock_guard<ffrt::mutex> lock(mutex_);
+        ValidateConfigCache(CONFIG_SHORT_KEY_TARGET);
         if (shortkeyTarget_.length() > 0 && shortkeyTarget.length() > 0 &&
             !std::strcmp(shortkeyTarget_.c_str(), shortkeyTarget.c_str())) {
             return;
@@ -1649,6 +1809,7 @@ void AccessibilityConfig::Impl::OnAccessibleAbilityManagerShortkeyMultiTargetCha
     std::vector<std::shared_ptr<AccessibilityConfigObserver>> observers;
     {
         std::lock_guard<ffrt::mutex> lock(mutex_);
+        ValidateConfigCache(CONFIG_SHORT_KEY_MULTI_TARGET);
         // need to add, if no change, do not inform
         shortkeyMultiTarget_ = shortkeyMultiTarget;
         std::map<CONFIG_ID, std::vector<std::shared_ptr<AccessibilityConfigObserver>>>::iterator it =
@@ -1669,6 +1830,7 @@ void AccessibilityConfig::Impl::OnAccessibleAbilityManagerClickResponseTimeChang
     std::vector<std::shared_ptr<AccessibilityConfigObserver>> observers;
     {
         std::lock_guard<ffrt::mutex> lock(mutex_);
+        ValidateConfigCache(CONIFG_CLICK_RESPONSE_TIME);
         if (clickResponseTime_ == clickResponseTime) {
             return;
         }
@@ -1690,6 +1852,7 @@ void AccessibilityConfig::Impl::OnAccessibleAbilityManagerIgnoreRepeatClickTimeC
     std::vector<std::shared_ptr<AccessibilityConfigObserver>> observers;
     {
         std::lock_guard<ffrt::mutex> lock(mutex_);
+        ValidateConfigCache(CONFIG_IGNORE_REPEAT_CLICK_TIME);
         if (ignoreRepeatClickTime_ == time) {
             return;
         }
@@ -1741,6 +1904,7 @@ void AccessibilityConfig::Impl::InitConfigValues()
     if (serviceProxy_ == nullptr) {
         return;
     }
+    uint32_t serviceVersion = serviceVersion_.load();
     serviceProxy_->GetAllConfigs(configData);
     highContrastText_ = configData.highContrastText_;
     invertColor_ = configData.invertColor_;
@@ -1762,6 +1926,11 @@ void AccessibilityConfig::Impl::InitConfigValues()
     clickResponseTime_ = configData.clickResponseTime_;
     ignoreRepeatClickTime_ = configData.ignoreRepeatClickTime_;
     ignoreRepeatClickState_ = configData.ignoreRepeatClickState_;
+    staleConfigs_ = 0;
+    if (configObserver_ != nullptr && captionObserver_ != nullptr) {
+        // Without the observers the cached configs could not follow the changes made by others.
+        configCacheVersion_.store(serviceVersion);
+    }
     NotifyDefaultConfigs();
     HILOG_DEBUG("ConnectToService Success");
 }
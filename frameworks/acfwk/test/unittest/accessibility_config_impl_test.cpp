@@ -15,7 +15,10 @@
 
 #include <vector>
 #include <gtest/gtest.h>
+#define private public
 #include "accessibility_config.h"
+#include "accessibility_config_impl.h"
+#undef private
 #include "parameter.h"
 #include "system_ability_definition.h"
 
@@ -26,6 +29,9 @@ namespace OHOS {
 namespace AccessibilityConfig {
 namespace {
     constexpr float BRIGHTNESS_DISCOUNT_VALUE = 0.2f;
+    constexpr uint32_t CONTENT_TIMEOUT_SET = 30;
+    constexpr uint32_t CONTENT_TIMEOUT_NOTIFIED = 40;
+    constexpr uint32_t CONTENT_TIMEOUT_DEFAULT = 10;
 } // namespace
 
 class AccessibilityConfigImplTest : public ::testing::Test {
@@ -714,6 +720,75 @@ HWTEST_F(AccessibilityConfigImplTest, SetContentTimeout_001, TestSize.Level1)
     GTEST_LOG_(INFO) << "SetContentTimeout_001 end";
 }
 
+/**
+ * @tc.number: SetContentTimeout_003
+ * @tc.name: SetContentTimeout_003
+ * @tc.desc: Test function GetContentTimeout returns the latest value set before the change is notified
+ */
+HWTEST_F(AccessibilityConfigImplTest, SetContentTimeout_003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SetContentTimeout_003 start";
+
+    uint32_t value = 0;
+    auto &instance = OHOS::AccessibilityConfig::AccessibilityConfig::GetInstance();
+    instance.InitializeContext();
+    instance.SetContentTimeout(10);
+    instance.SetContentTimeout(20);
+    instance.GetContentTimeout(value);
+    EXPECT_EQ(20, value);
+    GTEST_LOG_(INFO) << "SetContentTimeout_003 end";
+}
+
+/**
+ * @tc.number: GetContentTimeout_001
+ * @tc.name: GetContentTimeout_001
+ * @tc.desc: Test function GetContentTimeout serves the notified value from the cache
+ */
+HWTEST_F(AccessibilityConfigImplTest, GetContentTimeout_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GetContentTimeout_001 start";
+
+    uint32_t value = 0;
+    auto &instance = OHOS::AccessibilityConfig::AccessibilityConfig::GetInstance();
+    instance.InitializeContext();
+    instance.SetContentTimeout(CONTENT_TIMEOUT_SET);
+    instance.GetContentTimeout(value);
+    EXPECT_EQ(CONTENT_TIMEOUT_SET, value);
+
+    // The service holds CONTENT_TIMEOUT_SET, so only the cache can answer CONTENT_TIMEOUT_NOTIFIED.
+    instance.pImpl_->OnAccessibleAbilityManagerContentTimeoutChanged(CONTENT_TIMEOUT_NOTIFIED);
+    instance.GetContentTimeout(value);
+    EXPECT_EQ(CONTENT_TIMEOUT_NOTIFIED, value);
+    GTEST_LOG_(INFO) << "GetContentTimeout_001 end";
+}
+
+/**
+ * @tc.number: GetContentTimeout_002
+ * @tc.name: GetContentTimeout_002
+ * @tc.desc: Test function GetContentTimeout drops the cache when the service dies and reloads it on reconnection
+ */
+HWTEST_F(AccessibilityConfigImplTest, GetContentTimeout_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GetContentTimeout_002 start";
+
+    uint32_t value = 0;
+    auto &instance = OHOS::AccessibilityConfig::AccessibilityConfig::GetInstance();
+    instance.InitializeContext();
+    instance.pImpl_->OnAccessibleAbilityManagerContentTimeoutChanged(CONTENT_TIMEOUT_NOTIFIED);
+    instance.GetContentTimeout(value);
+    EXPECT_EQ(CONTENT_TIMEOUT_NOTIFIED, value);
+
+    ASSERT_TRUE(instance.pImpl_->serviceProxy_ != nullptr);
+    instance.pImpl_->ResetService(instance.pImpl_->serviceProxy_->AsObject());
+    EXPECT_EQ(Accessibility::RET_ERR_SAMGR, instance.GetContentTimeout(value));
+
+    // Reconnecting reloads the configs of the new service instead of the ones cached before its death.
+    instance.InitializeContext();
+    EXPECT_EQ(Accessibility::RET_OK, instance.GetContentTimeout(value));
+    EXPECT_EQ(CONTENT_TIMEOUT_DEFAULT, value);
+    GTEST_LOG_(INFO) << "GetContentTimeout_002 end";
+}
+
 /**
  * @tc.number: SetAnimationOffState_001
  * @tc.name: SetAnimationOffState_001
@@ -17,6 +17,9 @@
 #define ACCESSIBILITY_SYSTEM_ABILITY_CLIENT_IMPL_H
 
 #include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
 #include "accessibility_element_operator_impl.h"
 #include "accessibility_system_ability_client.h"
 #include "accessible_ability_manager_state_observer_stub.h"
@@ -33,7 +36,8 @@ using StateArray = std::array<bool, AccessibilityStateEventType::EVENT_TYPE_MAX>
 using StateObserverVector = std::vector<std::shared_ptr<AccessibilityStateObserver>>;
 using StateObserversArray = std::array<StateObserverVector, AccessibilityStateEventType::EVENT_TYPE_MAX>;
 class AccessibilitySystemAbilityClientImpl
-    : public AccessibilitySystemAbilityClient, public AccessibilityElementOperatorCallback {
+    : public AccessibilitySystemAbilityClient, public AccessibilityElementOperatorCallback,
+    public std::enable_shared_from_this<AccessibilitySystemAbilityClientImpl> {
 public:
     /**
      * @brief Construct.
@@ -120,6 +124,19 @@ public:
      */
     virtual RetError SendEvent(const AccessibilityEventInfo &event) override;
 
+    /**
+     * @brief Enables or disables event batching for this process.
+     * @param enabled True: events are batched; otherwise every event is sent at once.
+     * @return Returns RET_OK if successful, otherwise refer to the RetError for the failure.
+     */
+    virtual RetError SetEventBatchingEnabled(const bool enabled) override;
+
+    /**
+     * @brief Sends the buffered events immediately.
+     * @return Returns RET_OK if successful, otherwise refer to the RetError for the failure.
+     */
+    virtual RetError FlushEvents() override;
+
     /**
      * @brief Subscribes to the specified type of accessibility status change events.
      * @param observer Indicates the observer for listening to status events, which is specified
@@ -292,6 +309,13 @@ private:
      * @return True: The data of event type is valid; otherwise is not.
      */
     bool CheckEventType(EventType eventType);
+
+    /**
+     * @brief Buffer the event, and send the batch if it is full or the event is latency critical.
+     * @param event The event to be sent.
+     * @return Returns RET_OK if successful, otherwise refer to the RetError for the failure.
+     */
+    RetError BatchEvent(const AccessibilityEventInfo &event);
     static void OnParameterChanged(const char *key, const char *value, void *context);
     void ReregisterElementOperator();
 
@@ -308,6 +332,12 @@ private:
 
     ffrt::condition_variable proxyConVar_;
     ffrt::mutex conVarMutex_; // mutex for proxyConVar
+
+    std::atomic<bool> eventBatchingEnabled_ = false;
+    bool batchFlushScheduled_ = false;
+    std::vector<AccessibilityEventInfo> pendingEvents_;
+    ffrt::mutex batchMutex_; // mutex for pendingEvents_ and batchFlushScheduled_
+    ffrt::mutex flushMutex_; // keeps the batches in order
 };
 } // namespace Accessibility
 } // namespace OHOS
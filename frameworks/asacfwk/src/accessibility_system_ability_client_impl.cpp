@@ -14,6 +14,7 @@
  */
 
 #include <cinttypes>
+#include <iterator>
 #include "accessibility_system_ability_client_impl.h"
 #include "hilog_wrapper.h"
 #include "if_system_ability_manager.h"
@@ -27,6 +28,16 @@ namespace {
     constexpr int32_t CONFIG_PARAMETER_VALUE_SIZE = 10;
     const std::string SYSTEM_PARAMETER_AAMS_NAME = "accessibility.config.ready";
     constexpr int32_t SA_CONNECT_TIMEOUT = 500; // ms
+    constexpr size_t EVENT_BATCH_MAX_SIZE = 32;
+    constexpr size_t EVENT_SEND_MAX_SIZE = 64; // the most events the service proxy takes in one SendEvents
+    constexpr uint64_t EVENT_BATCH_INTERVAL = 16; // ms
+    constexpr uint64_t US_PER_MS = 1000;
+    // Events which a screen reader reacts to at once are never held back.
+    constexpr uint32_t EVENT_BATCH_URGENT_TYPES = TYPE_VIEW_CLICKED_EVENT | TYPE_VIEW_LONG_CLICKED_EVENT |
+        TYPE_VIEW_FOCUSED_EVENT | TYPE_VIEW_HOVER_ENTER_EVENT | TYPE_VIEW_HOVER_EXIT_EVENT |
+        TYPE_VIEW_ACCESSIBILITY_FOCUSED_EVENT | TYPE_VIEW_ACCESSIBILITY_FOCUS_CLEARED_EVENT |
+        TYPE_INTERRUPT_EVENT | TYPE_VIEW_REQUEST_FOCUS_FOR_ACCESSIBILITY | TYPE_VIEW_ANNOUNCE_FOR_ACCESSIBILITY |
+        TYPE_PAGE_OPEN | TYPE_PAGE_CLOSE;
 } // namespaces
 
 static ffrt::mutex g_Mutex;
@@ -427,13 +438,16 @@ bool AccessibilitySystemAbilityClientImpl::CheckEventType(EventType eventType)
 RetError AccessibilitySystemAbilityClientImpl::SendEvent(const EventType eventType, const int64_t componentId)
 {
     HILOG_DEBUG("componentId[%{public}" PRId64 "], eventType[%{public}d]", componentId, eventType);
-    std::lock_guard<ffrt::mutex> lock(mutex_);
     if (!CheckEventType(eventType)) {
         return RET_ERR_INVALID_PARAM;
     }
     AccessibilityEventInfo event;
     event.SetEventType(eventType);
     event.SetSource(componentId);
+    if (eventBatchingEnabled_.load()) {
+        return BatchEvent(event);
+    }
+    std::lock_guard<ffrt::mutex> lock(mutex_);
     if (serviceProxy_ == nullptr) {
         HILOG_ERROR("Failed to get aams service");
         return RET_ERR_SAMGR;
@@ -448,10 +462,13 @@ RetError AccessibilitySystemAbilityClientImpl::SendEvent(const EventType eventTy
 RetError AccessibilitySystemAbilityClientImpl::SendEvent(const AccessibilityEventInfo &event)
 {
     HILOG_DEBUG("EventType[%{public}d]", event.GetEventType());
-    std::lock_guard<ffrt::mutex> lock(mutex_);
     if (!CheckEventType(event.GetEventType())) {
         return RET_ERR_INVALID_PARAM;
     }
+    if (eventBatchingEnabled_.load()) {
+        return BatchEvent(event);
+    }
+    std::lock_guard<ffrt::mutex> lock(mutex_);
     if (serviceProxy_ == nullptr) {
         HILOG_ERROR("Failed to get aams service");
         return RET_ERR_SAMGR;
@@ -463,6 +480,91 @@ RetError AccessibilitySystemAbilityClientImpl::SendEvent(const AccessibilityEven
     return serviceProxy_->SendEvent(event);
 }
 
+RetError AccessibilitySystemAbilityClientImpl::BatchEvent(const AccessibilityEventInfo &event)
+{
+    bool flushNow = (static_cast<uint32_t>(event.GetEventType()) & EVENT_BATCH_URGENT_TYPES) != 0;
+    bool scheduleFlush = false;
+    {
+        std::lock_guard<ffrt::mutex> lock(batchMutex_);
+        pendingEvents_.push_back(event);
+        flushNow = flushNow || (pendingEvents_.size() >= EVENT_BATCH_MAX_SIZE);
+        if (!flushNow && !batchFlushScheduled_) {
+            batchFlushScheduled_ = true;
+            scheduleFlush = true;
+        }
+    }
+    if (flushNow) {
+        return FlushEvents();
+    }
+    if (scheduleFlush) {
+        // The oldest buffered event waits at most EVENT_BATCH_INTERVAL.
+        std::weak_ptr<AccessibilitySystemAbilityClientImpl> weakThis = weak_from_this();
+        ffrt::submit([weakThis]() {
+            auto client = weakThis.lock();
+            if (client == nullptr) {
+                return;
+            }
+            {
+                std::lock_guard<ffrt::mutex> lock(client->batchMutex_);
+                client->batchFlushScheduled_ = false;
+            }
+            client->FlushEvents();
+            }, {}, {}, ffrt::task_attr().delay(EVENT_BATCH_INTERVAL * US_PER_MS));
+    }
+    return RET_OK;
+}
+
+RetError AccessibilitySystemAbilityClientImpl::FlushEvents()
+{
+    std::lock_guard<ffrt::mutex> flushLock(flushMutex_);
+    sptr<IAccessibleAbilityManagerService> serviceProxy = nullptr;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        serviceProxy = serviceProxy_;
+    }
+
+    // Events keep arriving while a batch is sent, so take at most one proxy call worth at a time.
+    RetError result = RET_OK;
+    while (true) {
+        std::vector<AccessibilityEventInfo> events;
+        {
+            std::lock_guard<ffrt::mutex> lock(batchMutex_);
+            if (serviceProxy == nullptr || pendingEvents_.size() <= EVENT_SEND_MAX_SIZE) {
+                events.swap(pendingEvents_);
+                pendingEvents_.reserve(EVENT_BATCH_MAX_SIZE);
+            } else {
+                auto end = pendingEvents_.begin() + EVENT_SEND_MAX_SIZE;
+                events.assign(std::make_move_iterator(pendingEvents_.begin()), std::make_move_iterator(end));
+                pendingEvents_.erase(pendingEvents_.begin(), end);
+            }
+        }
+        if (events.empty()) {
+            return result;
+        }
+        if (serviceProxy == nullptr) {
+            HILOG_ERROR("Failed to get aams service, drop %{public}zu events", events.size());
+            return RET_ERR_SAMGR;
+        }
+
+        RetError ret = (events.size() == 1) ? serviceProxy->SendEvent(events.front()) :
+            serviceProxy->SendEvents(events);
+        if (ret != RET_OK) {
+            HILOG_ERROR("send %{public}zu events failed, ret %{public}d", events.size(), ret);
+            result = ret;
+        }
+    }
+}
+
+RetError AccessibilitySystemAbilityClientImpl::SetEventBatchingEnabled(const bool enabled)
+{
+    HILOG_INFO("enabled[%{public}d]", enabled);
+    eventBatchingEnabled_.store(enabled);
+    if (!enabled) {
+        return FlushEvents();
+    }
+    return RET_OK;
+}
+
 RetError AccessibilitySystemAbilityClientImpl::SubscribeStateObserver(
     const std::shared_ptr<AccessibilityStateObserver> &observer, const uint32_t eventType)
 {
@@ -16,7 +16,9 @@
 #include <gtest/gtest.h>
 #include <memory>
 #include "accessibility_common_helper.h"
+#define private public
 #include "accessibility_system_ability_client_impl.h"
+#undef private
 #include "mock_accessibility_element_operator.h"
 
 using namespace testing;
@@ -29,6 +31,7 @@ namespace {
     constexpr int32_t REQUEST_ID = 1;
     constexpr int64_t COMPONENT_ID = 1;
     constexpr uint32_t WINDOW_ID_MASK = 16;
+    constexpr size_t BUFFERED_EVENT_NUM = 100; // more than one SendEvents call takes
 } // namespace
 
 class AccessibilitySystemAbilityClientImplTest : public ::testing::Test {
@@ -379,6 +382,81 @@ HWTEST_F(AccessibilitySystemAbilityClientImplTest, SendEvent_005, TestSize.Level
     GTEST_LOG_(INFO) << "SendEvent_005 end";
 }
 
+/**
+ * @tc.number: SendEvent_Batching_001
+ * @tc.name: SendEvent
+ * @tc.desc: Test function SendEvent(batching enabled, proxy is not null)
+ */
+HWTEST_F(AccessibilitySystemAbilityClientImplTest, SendEvent_Batching_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SendEvent_Batching_001 start";
+    AccessibilityCommonHelper::GetInstance().SetRemoteObjectNotNullFlag(true);
+    impl_ = std::make_shared<AccessibilitySystemAbilityClientImpl>();
+    AccessibilityCommonHelper::GetInstance().SetRemoteObjectNotNullFlag(false);
+    if (!impl_) {
+        GTEST_LOG_(INFO) << "Cann't get AccessibilitySystemAbilityClientImpl impl_";
+        return;
+    }
+    EXPECT_EQ(RET_OK, impl_->SetEventBatchingEnabled(true));
+    AccessibilityEventInfo event {};
+    event.SetEventType(TYPE_VIEW_TEXT_UPDATE_EVENT);
+    EXPECT_EQ(RET_OK, impl_->SendEvent(event));
+    EXPECT_EQ(RET_OK, impl_->SendEvent(TYPE_VIEW_SCROLLED_EVENT, COMPONENT_ID));
+    EXPECT_EQ(RET_OK, impl_->SendEvent(TYPE_VIEW_ACCESSIBILITY_FOCUSED_EVENT, COMPONENT_ID));
+    EXPECT_EQ(RET_OK, impl_->FlushEvents());
+    EXPECT_EQ(RET_OK, impl_->SetEventBatchingEnabled(false));
+    impl_ = nullptr;
+    GTEST_LOG_(INFO) << "SendEvent_Batching_001 end";
+}
+
+/**
+ * @tc.number: SendEvent_Batching_002
+ * @tc.name: SendEvent
+ * @tc.desc: Test function SendEvent(batching enabled, proxy is null)
+ */
+HWTEST_F(AccessibilitySystemAbilityClientImplTest, SendEvent_Batching_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SendEvent_Batching_002 start";
+    impl_ = std::make_shared<AccessibilitySystemAbilityClientImpl>();
+    if (!impl_) {
+        GTEST_LOG_(INFO) << "Cann't get AccessibilitySystemAbilityClientImpl impl_";
+        return;
+    }
+    EXPECT_EQ(RET_OK, impl_->SetEventBatchingEnabled(true));
+    EXPECT_EQ(RET_OK, impl_->SendEvent(TYPE_VIEW_TEXT_UPDATE_EVENT, COMPONENT_ID));
+    EXPECT_EQ(RET_ERR_INVALID_PARAM, impl_->SendEvent(TYPE_VIEW_INVALID, COMPONENT_ID));
+    EXPECT_EQ(RET_ERR_SAMGR, impl_->SendEvent(TYPE_VIEW_CLICKED_EVENT, COMPONENT_ID));
+    EXPECT_EQ(RET_OK, impl_->FlushEvents());
+    impl_ = nullptr;
+    GTEST_LOG_(INFO) << "SendEvent_Batching_002 end";
+}
+
+/**
+ * @tc.number: SendEvent_Batching_003
+ * @tc.name: FlushEvents
+ * @tc.desc: Test function FlushEvents(more events buffered than one SendEvents call takes)
+ */
+HWTEST_F(AccessibilitySystemAbilityClientImplTest, SendEvent_Batching_003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SendEvent_Batching_003 start";
+    AccessibilityCommonHelper::GetInstance().SetRemoteObjectNotNullFlag(true);
+    impl_ = std::make_shared<AccessibilitySystemAbilityClientImpl>();
+    AccessibilityCommonHelper::GetInstance().SetRemoteObjectNotNullFlag(false);
+    if (!impl_) {
+        GTEST_LOG_(INFO) << "Cann't get AccessibilitySystemAbilityClientImpl impl_";
+        return;
+    }
+    EXPECT_EQ(RET_OK, impl_->SetEventBatchingEnabled(true));
+    AccessibilityEventInfo event {};
+    event.SetEventType(TYPE_VIEW_TEXT_UPDATE_EVENT);
+    impl_->pendingEvents_.assign(BUFFERED_EVENT_NUM, event);
+    EXPECT_EQ(RET_OK, impl_->FlushEvents());
+    EXPECT_TRUE(impl_->pendingEvents_.empty());
+    EXPECT_EQ(RET_OK, impl_->SetEventBatchingEnabled(false));
+    impl_ = nullptr;
+    GTEST_LOG_(INFO) << "SendEvent_Batching_003 end";
+}
+
 /**
  * @tc.number: SendEvent_006
  * @tc.name: SendEvent
@@ -27,6 +27,23 @@
 
 namespace OHOS {
 namespace Accessibility {
+/*
+* The statistics of the element cache used by the batch element queries.
+*/
+struct ElementCacheStatistics {
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+    uint64_t evictionCount = 0;
+    uint32_t windowCount = 0;
+    uint32_t elementCount = 0;
+    uint64_t usedBytes = 0;
+    uint64_t budgetBytes = 0;
+    // the cached nodes invalidated by the node, subtree and window events
+    uint64_t nodeEventInvalidatedCount = 0;
+    uint64_t subtreeEventInvalidatedCount = 0;
+    uint64_t windowEventInvalidatedCount = 0;
+};
+
 class AccessibleAbilityClient : public virtual RefBase {
 public:
     /**
@@ -261,6 +278,31 @@ public:
      */
     virtual RetError SetCacheMode(const int32_t cacheMode) = 0;
 
+    /**
+     * @brief Set the groups of element info fields to be fetched.
+     *        The mask is used for functions: GetRoot, GetRootByWindow, GetChildElementInfo, GetChildren,
+     *        GetSource, GetParentElementInfo, GetByElementId, GetByContent, GetFocus, GetFocusByElementInfo.
+     *        The cached elements fetched with fewer fields are fetched again.
+     * @param fieldMask The field mask, refer to ElementFieldMask. ELEMENT_FIELD_ALL by default.
+     * @return Return RET_OK if sets field mask successfully, otherwise refer to the RetError for the failure.
+     */
+    virtual RetError SetElementFieldMask(const uint32_t fieldMask) = 0;
+
+    /**
+     * @brief Set the memory budget of the element cache. The least recently used windows are evicted
+     *        when the cached elements exceed the budget, and a window larger than the budget is not cached.
+     * @param budgetBytes The memory budget in bytes.
+     * @return Return RET_OK if sets memory budget successfully, otherwise refer to the RetError for the failure.
+     */
+    virtual RetError SetCacheMemoryBudget(const uint64_t budgetBytes) = 0;
+
+    /**
+     * @brief Get the hit, miss and eviction counters and the memory usage of the element cache.
+     * @param statistics[out] The statistics of the element cache.
+     * @return Return RET_OK if gets statistics successfully, otherwise refer to the RetError for the failure.
+     */
+    virtual RetError GetCacheStatistics(ElementCacheStatistics &statistics) = 0;
+
     /**
      * @brief Find the node information by accessibility ID.
      * @param accessibilityWindowId The window id that the component belongs to.
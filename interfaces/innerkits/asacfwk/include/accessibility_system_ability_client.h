@@ -130,6 +130,21 @@ public:
      */
     virtual RetError SendEvent(const AccessibilityEventInfo &event) = 0;
 
+    /**
+     * @brief Enables or disables event batching for this process.
+     *        When enabled, events are buffered for a short bounded interval or up to a maximum count
+     *        and sent in one request. Focus, click and announcement events are sent at once.
+     * @param enabled True: events are batched; otherwise every event is sent at once.
+     * @return Returns RET_OK if successful, otherwise refer to the RetError for the failure.
+     */
+    virtual RetError SetEventBatchingEnabled(const bool enabled) = 0;
+
+    /**
+     * @brief Sends the buffered events immediately.
+     * @return Returns RET_OK if successful, otherwise refer to the RetError for the failure.
+     */
+    virtual RetError FlushEvents() = 0;
+
     /**
      * @brief Subscribes to the specified type of accessibility status change events.
      * @param observer Indicates the observer for listening to status events, which is specified
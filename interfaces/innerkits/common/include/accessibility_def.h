@@ -139,6 +139,19 @@ enum AccessibilityAbilityTypes : uint32_t {
     ACCESSIBILITY_ABILITY_TYPE_ALL = 0xFFFFFFFF,
 };
 
+// The groups of element info fields returned by an element search.
+// Ids, bounds, states, component type, text and child ids are always returned.
+enum ElementFieldMask : uint32_t {
+    ELEMENT_FIELD_BASIC = 0x00000000,
+    ELEMENT_FIELD_DESCRIPTION = 0x00000001, // hint, accessibility text, description, error, level, labeled
+    ELEMENT_FIELD_PAGE = 0x00000002, // bundle name, page id, page path, inspector key, resource name
+    ELEMENT_FIELD_ACTIONS = 0x00000004, // supported actions
+    ELEMENT_FIELD_VALUE = 0x00000008, // range, grid, grid item, text type, cursor and selection
+    ELEMENT_FIELD_STYLE = 0x00000010, // live region, z index, opacity, background, blur, hit test
+    ELEMENT_FIELD_EXTRA = 0x00000020, // extra element info, span list, content list
+    ELEMENT_FIELD_ALL = 0xFFFFFFFF,
+};
+
 enum CaptionMode : int32_t {
     CAPTION_BLACK_WHITE = 0,  // CAPTION_background_foreground
     CAPTION_WHITE_BLACK,
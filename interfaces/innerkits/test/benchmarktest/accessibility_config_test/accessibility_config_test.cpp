@@ -210,6 +210,73 @@ namespace {
         }
     }
 
+    /**
+     * @tc.name: BenchmarkTestForGetContentTimeoutAfterSet
+     * @tc.desc: Testcase for testing 'GetContentTimeout' function before the change is notified,
+     *           which has to ask the service.
+     * @tc.type: FUNC
+     * @tc.require: Issue Number
+     */
+    static void BenchmarkTestForGetContentTimeoutAfterSet(benchmark::State &state)
+    {
+        uint32_t value = 0;
+        auto &config = OHOS::AccessibilityConfig::AccessibilityConfig::GetInstance();
+        (void)config.InitializeContext();
+        AddPermission();
+        (void)config.GetContentTimeout(value);
+        for (auto _ : state) {
+            /* @tc.steps: step1.call SetContentTimeout and GetContentTimeout in loop */
+            (void)config.SetContentTimeout(value);
+            (void)config.GetContentTimeout(value);
+        }
+    }
+
+    /**
+     * @tc.name: BenchmarkTestForGetAllConfigValues
+     * @tc.desc: Testcase for reading every config through the getters.
+     * @tc.type: FUNC
+     * @tc.require: Issue Number
+     */
+    static void BenchmarkTestForGetAllConfigValues(benchmark::State &state)
+    {
+        bool boolValue = false;
+        uint32_t uintValue = 0;
+        int32_t intValue = 0;
+        float floatValue = 0.0;
+        std::string stringValue = "";
+        std::vector<std::string> stringValues;
+        CaptionProperty caption;
+        DALTONIZATION_TYPE daltonizationType = Normal;
+        CLICK_RESPONSE_TIME clickResponseTime = ResponseDelayShort;
+        IGNORE_REPEAT_CLICK_TIME ignoreRepeatClickTime = RepeatClickTimeoutShortest;
+        auto &config = OHOS::AccessibilityConfig::AccessibilityConfig::GetInstance();
+        (void)config.InitializeContext();
+        AddPermission();
+        for (auto _ : state) {
+            /* @tc.steps: step1.call all the getters in loop */
+            (void)config.GetScreenMagnificationState(boolValue);
+            (void)config.GetShortKeyState(boolValue);
+            (void)config.GetMouseKeyState(boolValue);
+            (void)config.GetCaptionsState(boolValue);
+            (void)config.GetCaptionsProperty(caption);
+            (void)config.GetMouseAutoClick(intValue);
+            (void)config.GetShortkeyTarget(stringValue);
+            (void)config.GetShortkeyMultiTarget(stringValues);
+            (void)config.GetInvertColorState(boolValue);
+            (void)config.GetHighContrastTextState(boolValue);
+            (void)config.GetDaltonizationState(boolValue);
+            (void)config.GetDaltonizationColorFilter(daltonizationType);
+            (void)config.GetContentTimeout(uintValue);
+            (void)config.GetAnimationOffState(boolValue);
+            (void)config.GetBrightnessDiscount(floatValue);
+            (void)config.GetAudioMonoState(boolValue);
+            (void)config.GetAudioBalance(floatValue);
+            (void)config.GetClickResponseTime(clickResponseTime);
+            (void)config.GetIgnoreRepeatClickState(boolValue);
+            (void)config.GetIgnoreRepeatClickTime(ignoreRepeatClickTime);
+        }
+    }
+
     /**
      * @tc.name: BenchmarkTestForSubscribeConfigObserver
      * @tc.desc: Testcase for testing 'SubscribeConfigObserver' and 'UnsubscribeConfigObserver' function.
@@ -237,6 +304,8 @@ namespace {
     BENCHMARK(BenchmarkTestForGetShortkeyTarget)->Iterations(1000)->ReportAggregatesOnly();
     BENCHMARK(BenchmarkTestForSetContentTimeout)->Iterations(1000)->ReportAggregatesOnly();
     BENCHMARK(BenchmarkTestForGetContentTimeout)->Iterations(1000)->ReportAggregatesOnly();
+    BENCHMARK(BenchmarkTestForGetContentTimeoutAfterSet)->Iterations(1000)->ReportAggregatesOnly();
+    BENCHMARK(BenchmarkTestForGetAllConfigValues)->Iterations(1000)->ReportAggregatesOnly();
     BENCHMARK(BenchmarkTestForSubscribeConfigObserver)->Iterations(1000)->ReportAggregatesOnly();
 }
 
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include "accessibility_element_operator_callback_proxy.h"
+#include "accessibility_element_operator_callback_stub.h"
+
+using namespace OHOS;
+using namespace OHOS::Accessibility;
+
+namespace {
+    constexpr int32_t REQUEST_ID = 1;
+    constexpr int32_t CHILD_NUM = 10;
+    constexpr int32_t RECT_SIZE = 100;
+
+    class ElementOperatorCallbackImpl : public AccessibilityElementOperatorCallbackStub {
+    public:
+        ElementOperatorCallbackImpl() = default;
+        ~ElementOperatorCallbackImpl() = default;
+
+        void SetSearchElementInfoByAccessibilityIdResult(const std::vector<AccessibilityElementInfo> &infos,
+            const int32_t requestId) override
+        {
+            receivedSize_ = infos.size();
+        }
+
+        void SetSearchElementInfoByTextResult(const std::vector<AccessibilityElementInfo> &infos,
+            const int32_t requestId) override {}
+        void SetFindFocusedElementInfoResult(const AccessibilityElementInfo &info, const int32_t requestId) override {}
+        void SetFocusMoveSearchResult(const AccessibilityElementInfo &info, const int32_t requestId) override {}
+        void SetExecuteActionResult(const bool succeeded, const int32_t requestId) override {}
+        void SetCursorPositionResult(const int32_t cursorPosition, const int32_t requestId) override {}
+
+        size_t receivedSize_ = 0;
+
+    protected:
+        void OnSearchElementInfoByAccessibilityIdResult(std::vector<AccessibilityElementInfo> &&infos,
+            const int32_t requestId) override
+        {
+            receivedSize_ = infos.size();
+        }
+    };
+
+    class ElementOperatorCallbackTest : public benchmark::Fixture {
+    public:
+        ElementOperatorCallbackTest()
+        {
+            Iterations(iterations);
+            Repetitions(repetitions);
+            ReportAggregatesOnly();
+        }
+
+        ~ElementOperatorCallbackTest() override = default;
+
+        void SetUp(const ::benchmark::State &state) override;
+        void TearDown(const ::benchmark::State &state) override;
+
+    protected:
+        void Transmit(benchmark::State &state, const bool useAshmem);
+
+        const int32_t repetitions = 3;
+        const int32_t iterations = 10;
+        sptr<ElementOperatorCallbackImpl> stub_ = nullptr;
+        sptr<AccessibilityElementOperatorCallbackProxy> proxy_ = nullptr;
+        std::vector<AccessibilityElementInfo> infos_ {};
+    };
+
+    void ElementOperatorCallbackTest::SetUp(const ::benchmark::State &state)
+    {
+        stub_ = new ElementOperatorCallbackImpl();
+        proxy_ = new AccessibilityElementOperatorCallbackProxy(stub_->AsObject());
+
+        // A tree shaped like a real page: every node has a text, a rect and up to CHILD_NUM children.
+        int64_t nodeNum = state.range(0);
+        infos_.clear();
+        infos_.reserve(nodeNum);
+        for (int64_t id = 0; id < nodeNum; id++) {
+            AccessibilityElementInfo info;
+            info.SetAccessibilityId(id);
+            info.SetParent(id == 0 ? -1 : (id - 1) / CHILD_NUM);
+            for (int64_t child = id * CHILD_NUM + 1; child <= id * CHILD_NUM + CHILD_NUM && child < nodeNum;
+                child++) {
+                info.AddChild(child);
+            }
+            info.SetBundleName("com.example.benchmark");
+            info.SetComponentType("Text");
+            info.SetContent("element content " + std::to_string(id));
+            Rect rect(0, 0, RECT_SIZE, RECT_SIZE);
+            info.SetRectInScreen(rect);
+            infos_.push_back(info);
+        }
+    }
+
+    void ElementOperatorCallbackTest::TearDown(const ::benchmark::State &state)
+    {
+        AccessibilityElementOperatorCallbackProxy::SetAshmemTransmitEnabled(true);
+        infos_.clear();
+        proxy_ = nullptr;
+        stub_ = nullptr;
+    }
+
+    void ElementOperatorCallbackTest::Transmit(benchmark::State &state, const bool useAshmem)
+    {
+        AccessibilityElementOperatorCallbackProxy::SetAshmemTransmitEnabled(useAshmem);
+        while (state.KeepRunning()) {
+            stub_->receivedSize_ = 0;
+            proxy_->SetSearchElementInfoByAccessibilityIdResult(infos_, REQUEST_ID);
+            if (stub_->receivedSize_ != infos_.size()) {
+                state.SkipWithError("The element infos received are not complete.");
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(infos_.size()));
+    }
+
+    /**
+     * @tc.name: SearchResultByParcelTestCase
+     * @tc.desc: Testcase for sending the search result in chunks of 800 infos per parcel.
+     * @tc.type: PERF
+     * @tc.require: Issue Number
+     */
+    BENCHMARK_DEFINE_F(ElementOperatorCallbackTest, SearchResultByParcelTestCase)(
+        benchmark::State &state)
+    {
+        Transmit(state, false);
+    }
+
+    /**
+     * @tc.name: SearchResultByAshmemTestCase
+     * @tc.desc: Testcase for sending the search result in one shared memory region.
+     * @tc.type: PERF
+     * @tc.require: Issue Number
+     */
+    BENCHMARK_DEFINE_F(ElementOperatorCallbackTest, SearchResultByAshmemTestCase)(
+        benchmark::State &state)
+    {
+        Transmit(state, true);
+    }
+
+    BENCHMARK_REGISTER_F(ElementOperatorCallbackTest, SearchResultByParcelTestCase)
+        ->Arg(1000)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(ElementOperatorCallbackTest, SearchResultByAshmemTestCase)
+        ->Arg(1000)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK_MAIN();
@@ -76,9 +76,36 @@ namespace {
         }
     }
 
+    /**
+     * @tc.name: BenchmarkTestForSendEventBatched
+     * @tc.desc: Testcase for testing 'SendEvent' function with event batching enabled.
+     * @tc.type: FUNC
+     * @tc.require: Issue Number
+     */
+    static void BenchmarkTestForSendEventBatched(benchmark::State &state)
+    {
+        auto asaClient = AccessibilitySystemAbilityClient::GetInstance();
+        if (!asaClient) {
+            return;
+        }
+        (void)asaClient->SetEventBatchingEnabled(true);
+        for (auto _ : state) {
+            /* @tc.steps: step1.call SendEvent in loop, the events are sent in batches */
+            AccessibilityEventInfo event;
+            event.SetEventType(TYPE_VIEW_TEXT_UPDATE_EVENT);
+            (void)asaClient->SendEvent(event);
+        }
+        (void)asaClient->FlushEvents();
+        state.SetItemsProcessed(state.iterations());
+    }
+
     BENCHMARK(BenchmarkTestForIsEnabled)->Iterations(1000)->ReportAggregatesOnly();
     BENCHMARK(BenchmarkTestForGetEnabledAbilities)->Iterations(1000)->ReportAggregatesOnly();
     BENCHMARK(BenchmarkTestForSendEvent)->Iterations(1000)->ReportAggregatesOnly();
+    BENCHMARK(BenchmarkTestForSendEvent)->Iterations(1000)->Threads(4)->ReportAggregatesOnly();
+    // Registered last: batching stays enabled for the rest of the process.
+    BENCHMARK(BenchmarkTestForSendEventBatched)->Iterations(1000)->ReportAggregatesOnly();
+    BENCHMARK(BenchmarkTestForSendEventBatched)->Iterations(1000)->Threads(4)->ReportAggregatesOnly();
 }
 
 BENCHMARK_MAIN();
\ No newline at end of file
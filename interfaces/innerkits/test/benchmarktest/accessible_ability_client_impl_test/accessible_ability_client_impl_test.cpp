@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <random>
+#include <benchmark/benchmark.h>
+#include "accessible_ability_client_impl.h"
+
+using namespace OHOS::Accessibility;
+
+namespace {
+    constexpr int64_t VIRTUAL_ROOT_ID = 0x7FFFFFFE;
+    constexpr int64_t CHILD_NUM = 10;
+    constexpr uint32_t SHUFFLE_SEED = 1;
+
+    class AccessibleAbilityClientImplTest : public benchmark::Fixture {
+    public:
+        AccessibleAbilityClientImplTest()
+        {
+            Iterations(iterations);
+            Repetitions(repetitions);
+            ReportAggregatesOnly();
+        }
+
+        ~AccessibleAbilityClientImplTest() override = default;
+
+        void SetUp(const ::benchmark::State &state) override;
+        void TearDown(const ::benchmark::State &state) override;
+
+    protected:
+        const int32_t repetitions = 3;
+        const int32_t iterations = 10;
+        std::vector<AccessibilityElementInfo> infos_ {};
+    };
+
+    void AccessibleAbilityClientImplTest::SetUp(const ::benchmark::State &state)
+    {
+        // A virtual root followed by a tree of up to CHILD_NUM children per node, received out of order.
+        int64_t nodeNum = state.range(0);
+        infos_.clear();
+        infos_.reserve(nodeNum + 1);
+        AccessibilityElementInfo virtualRoot;
+        virtualRoot.SetAccessibilityId(VIRTUAL_ROOT_ID);
+        virtualRoot.AddChild(0);
+        infos_.push_back(virtualRoot);
+        for (int64_t id = 0; id < nodeNum; id++) {
+            AccessibilityElementInfo info;
+            info.SetAccessibilityId(id);
+            info.SetParent(id == 0 ? VIRTUAL_ROOT_ID : (id - 1) / CHILD_NUM);
+            for (int64_t child = id * CHILD_NUM + 1; child <= id * CHILD_NUM + CHILD_NUM && child < nodeNum;
+                child++) {
+                info.AddChild(child);
+            }
+            info.SetBundleName("com.example.benchmark");
+            info.SetComponentType("Text");
+            info.SetContent("element content " + std::to_string(id));
+            infos_.push_back(info);
+        }
+        std::shuffle(infos_.begin() + 1, infos_.end(), std::mt19937(SHUFFLE_SEED));
+    }
+
+    void AccessibleAbilityClientImplTest::TearDown(const ::benchmark::State &state)
+    {
+        infos_.clear();
+    }
+
+    /**
+     * @tc.name: SortElementInfosTestCase
+     * @tc.desc: Testcase for sorting the element infos of a page in breadth first order.
+     * @tc.type: PERF
+     * @tc.require: Issue Number
+     */
+    BENCHMARK_DEFINE_F(AccessibleAbilityClientImplTest, SortElementInfosTestCase)(
+        benchmark::State &state)
+    {
+        while (state.KeepRunning()) {
+            state.PauseTiming();
+            std::vector<AccessibilityElementInfo> infos = infos_;
+            state.ResumeTiming();
+            AccessibleAbilityClientImpl::SortElementInfosIfNecessary(infos);
+            if (infos.size() != infos_.size()) {
+                state.SkipWithError("The element infos sorted are not complete.");
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(infos_.size()));
+    }
+
+    BENCHMARK_REGISTER_F(AccessibleAbilityClientImplTest, SortElementInfosTestCase)
+        ->Arg(100)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK_MAIN();
@@ -16,8 +16,10 @@
 #define ACCESSIBILITY_ACCOUNT_DATA_H
 
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "accessibility_caption.h"
@@ -37,6 +39,10 @@ namespace Accessibility {
 using CaptionPropertyCallbacks = std::vector<sptr<IAccessibleAbilityManagerCaptionObserver>>;
 class AccessibleAbilityConnection;
 class AccessibilityWindowConnection;
+using AbilityConnectionMap = std::map<std::string, sptr<AccessibleAbilityConnection>>; // key: bundleName/abilityName
+using WindowConnectionMap = std::map<int32_t, sptr<AccessibilityWindowConnection>>; // key: windowId
+// key: windowId, value: element operators of the window keyed by treeId, 0 for the window itself
+using ElementOperatorSnapshot = std::map<int32_t, std::map<int32_t, sptr<IAccessibilityElementOperator>>>;
 
 struct ConfigValueAtoHosUpdate {
     bool highContrastText = false;
@@ -150,6 +156,20 @@ public:
      */
     const std::map<std::string, sptr<AccessibleAbilityConnection>> GetConnectedA11yAbilities();
 
+    /**
+     * @brief Get the connected accessibility abilities without copying or locking.
+     *        The snapshot is immutable and replaced whenever an ability connects or disconnects.
+     * @return Store map of connected accessibility abilities.
+     */
+    std::shared_ptr<const AbilityConnectionMap> GetConnectedA11yAbilitiesSnapshot();
+
+    /**
+     * @brief Get the connected accessibility abilities which want the event type.
+     * @param eventType The type of the event.
+     * @param subscribers The connected abilities which want the event type.
+     */
+    void GetEventSubscribers(const uint32_t eventType, std::vector<sptr<AccessibleAbilityConnection>>& subscribers);
+
     const CaptionPropertyCallbacks GetCaptionPropertyCallbacks();
 
     /**
@@ -158,6 +178,25 @@ public:
      */
     const std::map<int32_t, sptr<AccessibilityWindowConnection>> GetAsacConnections();
 
+    /**
+     * @brief Get interface operation interactive connection list without copying or locking.
+     *        The snapshot is immutable and replaced whenever a window connection is added or removed.
+     * @return Store map of interface operation interactive connection.
+     */
+    std::shared_ptr<const WindowConnectionMap> GetAsacConnectionsSnapshot();
+
+    /**
+     * @brief Get the element operators of all window connections without locking.
+     *        The snapshot is immutable and replaced whenever a connection or a card proxy changes.
+     * @return The element operators keyed by windowId and treeId.
+     */
+    std::shared_ptr<const ElementOperatorSnapshot> GetElementOperatorSnapshot();
+
+    /**
+     * @brief Republish the element operator snapshot after a card proxy of a window connection changed.
+     */
+    void UpdateElementOperatorSnapshot();
+
     /**
      * @brief Query accessible ability connection through elementName URI.
      * @param elementName Accessibility elementName URI
@@ -310,6 +349,11 @@ private:
      */
     void UpdateMagnificationCapability();
 
+    /**
+     * @brief Rebuild the element operator snapshot, asacConnectionsMutex_ must be held.
+     */
+    void PublishElementOperatorSnapshot();
+
     class AccessibilityAbility {
     public:
         AccessibilityAbility() = default;
@@ -318,9 +362,12 @@ private:
         sptr<AccessibleAbilityConnection> GetAccessibilityAbilityByName(const std::string& elementName);
         sptr<AccessibleAbilityConnection> GetAccessibilityAbilityByUri(const std::string& uri);
         void GetAccessibilityAbilities(std::vector<sptr<AccessibleAbilityConnection>>& connectionList);
+        void GetAccessibilityAbilitiesByEventType(const uint32_t eventType,
+            std::vector<sptr<AccessibleAbilityConnection>>& connectionList);
         void GetAbilitiesInfo(std::vector<AccessibilityAbilityInfo>& abilities);
         bool IsExistCapability(Capability capability);
         void GetAccessibilityAbilitiesMap(std::map<std::string, sptr<AccessibleAbilityConnection>>& connectionMap);
+        std::shared_ptr<const AbilityConnectionMap> GetAccessibilityAbilitiesSnapshot();
         void GetDisableAbilities(std::vector<AccessibilityAbilityInfo>& disabledAbilities);
         int32_t GetSizeByUri(const std::string& uri);
         void RemoveAccessibilityAbilityByName(const std::string& bundleName, bool& result);
@@ -328,7 +375,13 @@ private:
         void Clear();
         size_t GetSize();
     private:
-        std::map<std::string, sptr<AccessibleAbilityConnection>> connectionMap_;
+        // mutex_ must be held
+        void PublishConnectionMap(const std::shared_ptr<AbilityConnectionMap>& connectionMap);
+
+        // replaced as a whole under mutex_, readers load it without locking
+        std::shared_ptr<const AbilityConnectionMap> connectionMap_ = std::make_shared<const AbilityConnectionMap>();
+        // key: event type, built on demand and cleared whenever connectionMap_ changes
+        std::unordered_map<uint32_t, std::vector<sptr<AccessibleAbilityConnection>>> eventRoutes_;
         ffrt::mutex mutex_;
     };
 
@@ -345,8 +398,12 @@ private:
     AccessibilityAbility connectingA11yAbilities_;  // key: bundleName/abilityName
     std::vector<sptr<IAccessibilityEnableAbilityListsObserver>> enableAbilityListsObservers_;
     ffrt::mutex enableAbilityListObserversMutex_; // mutex for enableAbilityListsObservers_
-    std::map<int32_t, sptr<AccessibilityWindowConnection>> asacConnections_; // key: windowId
-    ffrt::mutex asacConnectionsMutex_; // mutex for map asacConnections_
+    // replaced as a whole under asacConnectionsMutex_, readers load it without locking
+    std::shared_ptr<const WindowConnectionMap> asacConnections_ = std::make_shared<const WindowConnectionMap>();
+    ffrt::mutex asacConnectionsMutex_; // mutex for replacing asacConnections_
+    // read by the ability channels on binder threads, replaced under asacConnectionsMutex_
+    std::shared_ptr<const ElementOperatorSnapshot> elementOperatorSnapshot_ =
+        std::make_shared<const ElementOperatorSnapshot>();
     CaptionPropertyCallbacks captionPropertyCallbacks_;
     ffrt::mutex captionPropertyCallbacksMutex_; // mutex for captionPropertyCallbacks_
     std::vector<AccessibilityAbilityInfo> installedAbilities_;
@@ -18,6 +18,9 @@
 
 #include <string>
 #include "draw/canvas.h"
+#ifndef USE_ROSEN_DRAWING
+#include "pipeline/rs_recording_canvas.h"
+#endif
 #include <ui/rs_canvas_node.h>
 #include <ui/rs_surface_node.h>
 #include <transaction/rs_transaction.h>
@@ -52,6 +55,9 @@ public:
     void DrawingProgressByRosenDrawing(int32_t physicalX, int32_t physicalY, int32_t angle);
 #endif
 
+    // Build the paints of the progress once, only the arc angle changes between frames.
+    void InitProgressPaints();
+
     std::shared_ptr<Rosen::RSSurfaceNode> surfaceNode_;
     std::shared_ptr<Rosen::RSCanvasNode> canvasNode_;
     uint64_t screenId_;
@@ -60,6 +66,26 @@ public:
     int32_t half_;
     int32_t startAngle_ = 0;
     float dispalyDensity_;
+    int32_t pointerX_ = 0;
+    int32_t pointerY_ = 0;
+    bool isPointerVisible_ = false;
+
+    float outCircleRadius_ = 0;
+    float centerCircleRadius_ = 0;
+    float progressRadius_ = 0;
+#ifndef USE_ROSEN_DRAWING
+    SkPaint outCirclePaint_;
+    SkPaint centerCirclePaint_;
+    SkPaint progressCirclePaint_;
+    SkPaint progressArcPaint_;
+    SkRect progressArcRect_;
+#else
+    Rosen::Drawing::Brush outCircleBrush_;
+    Rosen::Drawing::Brush centerCircleBrush_;
+    Rosen::Drawing::Pen progressPen_;
+    Rosen::Drawing::Pen progressArcPen_;
+    Rosen::Drawing::Rect progressArcRect_;
+#endif
 };
 } // namespace Accessibility
 } // namespace OHOS
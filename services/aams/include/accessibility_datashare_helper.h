@@ -16,6 +16,11 @@
 #ifndef ACCESSIBILITY_DATASHARE_HELPER
 #define ACCESSIBILITY_DATASHARE_HELPER
 
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
 #include "accessibility_setting_observer.h"
 #include "accessibility_def.h"
 
@@ -51,6 +56,12 @@ public:
 
     void Initialize(int32_t systemAbilityId);
 
+    // Reads all the keys with one query. Until EndBatchLoad, the Get functions of these keys are served
+    // from the loaded values and the default values of missing keys are kept instead of being written.
+    RetError BeginBatchLoad(const std::vector<std::string>& keys);
+    // Writes the kept default values with one batch insert and returns how many were written.
+    size_t EndBatchLoad();
+
     sptr<AccessibilitySettingObserver> CreateObserver(const std::string& key,
         AccessibilitySettingObserver::UpdateFunc& func);
     RetError RegisterObserver(const sptr<AccessibilitySettingObserver>& observer);
@@ -65,6 +76,8 @@ private:
     bool DestoryDatashareHelper(std::shared_ptr<DataShare::DataShareHelper>& helper);
 #endif
     Uri AssembleUri(const std::string& key);
+    bool GetBatchValue(const std::string& key, const std::string& defaultValue, std::string& value);
+    void UpdateBatchValue(const std::string& key, const std::string& value);
 
 private:
     DATASHARE_TYPE type_;
@@ -76,6 +89,12 @@ private:
 #endif
     static ffrt::mutex observerMutex_;
     std::map<std::string, sptr<AccessibilitySettingObserver>> settingObserverMap_;
+
+    ffrt::mutex batchMutex_;
+    bool isBatchLoading_ = false;
+    std::set<std::string> batchKeys_ {};
+    std::map<std::string, std::string> batchValues_ {};
+    std::map<std::string, std::string> batchDefaultValues_ {};
 };
 } // namespace Accessibility
 } // namespace OHOS
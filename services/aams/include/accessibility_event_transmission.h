@@ -17,6 +17,7 @@
 #define OHOS_EVENT_TRANSMISSION_H
 
 #include <cstdint>
+#include <memory>
 #include "accessibility_event_info.h"
 #include "key_event.h"
 #include "pointer_event.h"
@@ -34,7 +35,17 @@ public:
     void SetNext(const sptr<EventTransmission> &next);
     sptr<EventTransmission> GetNext();
     virtual void DestroyEvents();
+    // Set by the interceptor around every pointer event it dispatches, on the input runner only.
+    static void SetDispatchingPointerEvent(const std::shared_ptr<MMI::PointerEvent> &event);
+protected:
+    /**
+     * Keeps the event for later. The event being dispatched is shared instead of copied. A shared event
+     * still goes down the chain if it is forwarded now, so only a stage that keeps the event instead of
+     * forwarding it may call this.
+     */
+    static std::shared_ptr<MMI::PointerEvent> KeepPointerEvent(MMI::PointerEvent &event);
 private:
+    static std::shared_ptr<MMI::PointerEvent> dispatchingPointerEvent_;
     sptr<EventTransmission> next_ = nullptr;
 };
 } // namespace Accessibility
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_GESTURE_PATH_SEGMENTER_H
+#define ACCESSIBILITY_GESTURE_PATH_SEGMENTER_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace OHOS {
+namespace Accessibility {
+const float DEGREES_THRESHOLD = 0.0f;
+
+struct Pointer {
+    float px_;
+    float py_;
+};
+
+/**
+ * Splits the route of a single finger into straight segments while the finger moves.
+ * The route turns into a new segment when the next point heads away from the average
+ * direction of the current segment by more than 90 degrees. Only the separations and
+ * the running sums of the current segment are kept, so the state does not grow with
+ * the length of the gesture.
+ */
+class AccessibilityGesturePathSegmenter {
+public:
+    // The start point and at most one turn, no gesture has more segments.
+    static constexpr size_t MAX_SEPARATION_NUM = 2;
+
+    /**
+     * @brief Start a new route.
+     * @param start the point the finger went down at
+     */
+    void Reset(const Pointer &start);
+
+    /**
+     * @brief Drop the route.
+     */
+    void Clear();
+
+    /**
+     * @brief Add the next point of the route.
+     * @param point the position of the finger
+     */
+    void AddPoint(const Pointer &point);
+
+    /**
+     * @brief Get the number of points added since the route started.
+     */
+    size_t GetPointCount() const
+    {
+        return pointCount_;
+    }
+
+    /**
+     * @brief Whether the route already has more segments than any gesture.
+     * @return true if the route can no longer be recognized, else false
+     */
+    bool IsRejected() const
+    {
+        return isRejected_;
+    }
+
+    /**
+     * @brief Get the number of points of the path: the separations and the last point.
+     */
+    size_t GetPathSize() const
+    {
+        return separationCount_ + 1;
+    }
+
+    /**
+     * @brief Get a point of the path.
+     * @param index the index of the point, less than GetPathSize()
+     * @return the separation at index, or the last point of the route.
+     */
+    const Pointer &GetPathPoint(size_t index) const
+    {
+        return index < separationCount_ ? separations_[index] : lastPoint_;
+    }
+
+private:
+    Pointer separations_[MAX_SEPARATION_NUM] = {};
+    size_t separationCount_ = 0;
+    Pointer lastPoint_ = {};
+    size_t pointCount_ = 0;
+    float xUnitVector_ = 0;
+    float yUnitVector_ = 0;
+    float vectorLength_ = 0;
+    int32_t numSinceFirstSep_ = 0;
+    bool isRejected_ = false;
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_GESTURE_PATH_SEGMENTER_H
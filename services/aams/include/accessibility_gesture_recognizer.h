@@ -23,6 +23,8 @@
 #include "accessibility_display_manager.h"
 #endif
 #include "accessibility_event_info.h"
+#include "accessibility_gesture_path_segmenter.h"
+#include "accessibility_gesture_template_matcher.h"
 #include "accessible_ability_manager_service.h"
 #include "event_handler.h"
 #include "event_runner.h"
@@ -38,18 +40,12 @@ const int64_t MIN_DOUBLE_TAP_TIME = 40000; // microsecond
 const int64_t DOUBLE_TAP_TIMEOUT = 300000; // microsecond
 const int64_t LONG_PRESS_TIMEOUT = 300000; // microsecond
 const int64_t TAP_INTERVAL_TIMEOUT = 100000; // microsecond
-const float DEGREES_THRESHOLD = 0.0f;
 const int32_t DIRECTION_NUM = 4;
 const int64_t US_TO_MS = 1000;
 const int32_t MM_PER_CM = 10;
 #define CALCULATION_DIMENSION(xdpi) ((xdpi) * 0.25f)
 #define MIN_PIXELS(xyDpi) ((xyDpi) * 0.1f)
 
-struct Pointer {
-    float px_;
-    float py_;
-};
-
 class AccessibilityGestureRecognizer;
 class GestureHandler : public AppExecFwk::EventHandler {
 public:
@@ -281,17 +277,31 @@ private:
     void AddSwipePosition(MMI::PointerEvent::PointerItem &pointerIterm);
 
     /**
-     * @brief Calculate the move threshold for the double tap gesture.
-     * @param densityDpi the physical density
+     * @brief Add position to the route matched against the gesture templates.
+     * @param pointerIterm the touch item from touchguide
      */
-    float GetDoubleTapMoveThreshold(float densityDpi);
+    void AddTemplatePosition(MMI::PointerEvent::PointerItem &pointerIterm);
 
     /**
-     * @brief Get pointer path.
-     * @param route all pointer route
-     * @return the vector of PointerPath
+     * @brief Recognize a route the swipe directions do not cover with the gesture templates.
+     * @param event the touch event from touchguide
+     * @return true if the template gesture be recognized, else false
      */
-    std::vector<Pointer> GetPointerPath(std::vector<Pointer> &route);
+    bool RecognizeTemplateGesture(MMI::PointerEvent &event);
+
+    /**
+     * @brief Cancel the gesture as soon as its route has more segments than any swipe,
+     *        when there is no gesture template to match it against.
+     * @param event the touch event from touchguide
+     * @return true if the gesture is cancelled, else false
+     */
+    bool RejectDirectionGesture(MMI::PointerEvent &event);
+
+    /**
+     * @brief Calculate the move threshold for the double tap gesture.
+     * @param densityDpi the physical density
+     */
+    float GetDoubleTapMoveThreshold(float densityDpi);
 
     /**
      * @brief Get swipe direction.
@@ -357,7 +367,9 @@ private:
     int32_t doubleTapScaledSlop_ = 0;
     MMI::PointerEvent::PointerItem prePointer_ = {};
     MMI::PointerEvent::PointerItem startPointer_ = {};
-    std::vector<Pointer> pointerRoute_ {};
+    AccessibilityGesturePathSegmenter pathSegmenter_ {};
+    AccessibilityGestureTemplateMatcher templateMatcher_ {};
+    GestureRoute templateRoute_ {};
     AccessibilityGestureRecognizeListener *listener_ = nullptr;
     std::unique_ptr<MMI::PointerEvent> pPreUp_ = nullptr;
     std::shared_ptr<MMI::PointerEvent> pCurDown_ = nullptr;
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_GESTURE_TEMPLATE_MATCHER_H
+#define ACCESSIBILITY_GESTURE_TEMPLATE_MATCHER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "accessibility_def.h"
+#include "accessibility_gesture_path_segmenter.h"
+
+namespace OHOS {
+namespace Accessibility {
+constexpr size_t TEMPLATE_POINT_NUM = 32;
+
+/**
+ * A shape resampled to TEMPLATE_POINT_NUM equidistant points, moved to its centroid and scaled
+ * so that the longer side of its bounding box is 1. The coordinates are kept as separate arrays
+ * so the distance between two shapes runs over contiguous floats.
+ */
+struct GestureTemplate {
+    std::string name = "";
+    GestureType gestureId = GestureType::GESTURE_INVALID;
+    float aspect = 0; // width / (width + height) of the bounding box
+    float straightness = 0; // distance between the ends / length of the route
+    float xs[TEMPLATE_POINT_NUM] = {};
+    float ys[TEMPLATE_POINT_NUM] = {};
+};
+
+struct GestureMatchResult {
+    GestureType gestureId = GestureType::GESTURE_INVALID;
+    float score = 0; // root mean square distance to the matched template
+    size_t comparedCount = 0; // templates left after the early rejection
+};
+
+/**
+ * The route of a single finger kept in a fixed number of points. Once the buffer is full every
+ * second point is dropped and later points are sampled half as often, so a long route keeps its
+ * shape without growing. The latest point is always kept.
+ */
+class GestureRoute {
+public:
+    static constexpr size_t MAX_POINT_NUM = 64;
+
+    void Reset(const Pointer &start);
+    void Clear();
+    void AddPoint(const Pointer &point);
+
+    const Pointer *GetPoints() const
+    {
+        return points_;
+    }
+
+    size_t GetPointCount() const
+    {
+        return committedCount_ + (hasProvisional_ ? 1 : 0);
+    }
+
+private:
+    void Decimate();
+
+    Pointer points_[MAX_POINT_NUM] = {};
+    size_t committedCount_ = 0;
+    bool hasProvisional_ = false;
+    uint32_t stride_ = 1;
+    uint32_t sinceCommit_ = 0;
+};
+
+/**
+ * Matches a route against a registry of shape templates. The registry is loaded from a json file:
+ *     {"templates": [{"name": "zigzag", "gestureId": 21, "points": [[0, 0], [1, 1], [2, 0]]}]}
+ * gestureId is a GestureType and points is the polyline of the shape in any unit.
+ * Templates are sorted by aspect, so only the ones with a close aspect and straightness are compared.
+ */
+class AccessibilityGestureTemplateMatcher {
+public:
+    /**
+     * @brief Load the templates from a json file, replacing the current ones.
+     * @param path the path of the json file
+     * @return true if the file is loaded, else false.
+     */
+    bool LoadTemplates(const std::string &path);
+
+    /**
+     * @brief Parse the templates from json content, replacing the current ones.
+     * @param content the json content
+     * @return true if the content is parsed, else false.
+     */
+    bool ParseTemplates(const std::string &content);
+
+    /**
+     * @brief Add a template.
+     * @param name the name of the template
+     * @param gestureId the gesture reported when the template matches
+     * @param points the polyline of the shape
+     * @param count the number of points
+     * @return true if the template is added, else false.
+     */
+    bool AddTemplate(const std::string &name, GestureType gestureId, const Pointer *points, size_t count);
+
+    void Clear();
+
+    bool IsEmpty() const
+    {
+        return templates_.empty();
+    }
+
+    const std::vector<GestureTemplate> &GetTemplates() const
+    {
+        return templates_;
+    }
+
+    /**
+     * @brief Find the template closest to the route.
+     * @param points the route of the finger
+     * @param count the number of points
+     * @return the matched gesture, GESTURE_INVALID if no template is close enough.
+     */
+    GestureMatchResult Match(const Pointer *points, size_t count) const;
+
+    /**
+     * @brief Resample, center and scale a route into a template.
+     * @param points the route
+     * @param count the number of points
+     * @param shape the normalized shape
+     * @return true if the route is long enough to have a shape, else false.
+     */
+    static bool NormalizeShape(const Pointer *points, size_t count, GestureTemplate &shape);
+
+    /**
+     * @brief Get the root mean square distance between two shapes.
+     * @param first the first shape
+     * @param second the second shape
+     * @param limit the distance beyond which the computation stops
+     * @return the distance, or a value not less than limit if the shapes are further apart.
+     */
+    static float GetDistance(const GestureTemplate &first, const GestureTemplate &second, float limit);
+
+private:
+    std::vector<GestureTemplate> templates_ {};
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_GESTURE_TEMPLATE_MATCHER_H
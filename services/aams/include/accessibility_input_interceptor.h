@@ -16,6 +16,8 @@
 #ifndef ACCESSIBILITY_INPUT_INTERCEPTOR_H
 #define ACCESSIBILITY_INPUT_INTERCEPTOR_H
 
+#include <array>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <vector>
@@ -32,6 +34,58 @@ namespace OHOS {
 namespace Accessibility {
 class AccessibleAbilityManagerService;
 
+struct InputEventQueueStats {
+    uint32_t depth = 0;
+    uint32_t maxDepth = 0;
+    uint64_t enqueuedCount = 0;
+    uint64_t droppedCount = 0;
+    int64_t lastWaitTime = 0; // us
+    int64_t maxWaitTime = 0; // us
+    int64_t averageWaitTime = 0; // us
+};
+
+/**
+ * Bounded lock-free ring used to hand input events over from the MMI callback thread
+ * to the input runner. Producers never block on a mutex, the input runner drains it in order.
+ */
+class AccessibilityInputEventQueue {
+public:
+    struct Item {
+        std::shared_ptr<MMI::KeyEvent> keyEvent = nullptr;
+        std::shared_ptr<MMI::PointerEvent> pointerEvent = nullptr;
+        int64_t enqueueTime = 0;
+    };
+
+    // Must be a power of two.
+    static constexpr uint32_t QUEUE_CAPACITY = 256;
+
+    AccessibilityInputEventQueue();
+    ~AccessibilityInputEventQueue() = default;
+
+    bool Push(Item &item);
+    bool Pop(Item &item);
+    bool IsEmpty() const;
+    void RecordWaitTime(int64_t waitTime);
+    void RecordDropped();
+    InputEventQueueStats GetStats() const;
+
+private:
+    struct Cell {
+        std::atomic<uint64_t> sequence {0};
+        Item item;
+    };
+
+    std::array<Cell, QUEUE_CAPACITY> cells_;
+    std::atomic<uint64_t> enqueuePos_ {0};
+    std::atomic<uint64_t> dequeuePos_ {0};
+    std::atomic<uint32_t> maxDepth_ {0};
+    std::atomic<uint64_t> droppedCount_ {0};
+    std::atomic<uint64_t> dequeuedCount_ {0};
+    std::atomic<int64_t> lastWaitTime_ {0};
+    std::atomic<int64_t> maxWaitTime_ {0};
+    std::atomic<int64_t> totalWaitTime_ {0};
+};
+
 class AccessibilityInputEventConsumer : public MMI::IInputEventConsumer {
 public:
     AccessibilityInputEventConsumer();
@@ -39,8 +93,6 @@ public:
     void OnInputEvent(std::shared_ptr<MMI::KeyEvent> keyEvent) const override;
     void OnInputEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent) const override;
     void OnInputEvent(std::shared_ptr<MMI::AxisEvent> axisEvent) const override {};
-private:
-    std::shared_ptr<AppExecFwk::EventHandler> eventHandler_ = nullptr;
 };
 
 class AccessibilityInputInterceptor : public EventTransmission {
@@ -76,6 +128,8 @@ public:
     bool OnPointerEvent(MMI::PointerEvent &event) override;
     void OnMoveMouse(int32_t offsetX, int32_t offsetY) override;
     void SetAvailableFunctions(uint32_t availableFunctions);
+    void DispatchInputEvent(AccessibilityInputEventQueue::Item &item);
+    InputEventQueueStats GetInputQueueStats() const;
 
 private:
     AccessibilityInputInterceptor();
@@ -88,15 +142,20 @@ private:
         const sptr<EventTransmission> &next);
     void UpdateInterceptor();
     void DestroyInterceptor();
+    void UpdateAvailableFunctions(uint32_t availableFunctions);
+    void DrainInputEvents();
 
     sptr<EventTransmission> pointerEventTransmitters_ = nullptr;
     sptr<EventTransmission> keyEventTransmitters_ = nullptr;
     sptr<EventTransmission> mouseKey_ = nullptr;
-    uint32_t availableFunctions_ = 0;
+    // written on the input runner, read on the caller thread of SetAvailableFunctions
+    std::atomic<uint32_t> availableFunctions_ = 0;
     int32_t interceptorId_ = -1;
     MMI::InputManager *inputManager_ = nullptr;
     std::shared_ptr<AccessibilityInputEventConsumer> inputEventConsumer_ = nullptr;
     std::shared_ptr<AppExecFwk::EventHandler> eventHandler_ = nullptr;
+    AccessibilityInputEventQueue inputEventQueue_;
+    std::atomic<bool> drainScheduled_ = false;
 };
 } // namespace Accessibility
 } // namespace OHOS
@@ -36,6 +36,7 @@ namespace Accessibility {
 namespace {
     constexpr uint32_t MAX_TAP_NUM = 3;
     constexpr uint32_t MAX_MULTI_FINGER_TYPE = 3;
+    constexpr int32_t MAX_FINGER_NUM = 10;
 } // namespace
 
 enum MoveGirectionType : int32_t {
@@ -59,6 +60,90 @@ enum MultiFingerGestureState : int32_t {
     GESTURE_WAIT = 4,
 };
 
+/**
+ * The part of a touch event the recognizer reads, taken from the pointer the event is about.
+ */
+struct MultiFingerPoint {
+    int32_t pointerId = -1;
+    int32_t displayX = 0;
+    int32_t displayY = 0;
+    int64_t actionTime = 0; // microsecond
+};
+
+/**
+ * The move path of one finger. Every point is checked against the move direction when it is added,
+ * so only the last point is kept.
+ */
+struct MultiFingerRoute {
+    int32_t lastX = 0;
+    int32_t lastY = 0;
+    uint32_t pointNum = 0;
+    bool isSameDirection = true; // every step of the path goes in the move direction
+};
+
+/**
+ * Per finger records indexed by pointer id, kept in place so that recording a finger never allocates.
+ * Pointer ids from MAX_FINGER_NUM on are not recorded.
+ */
+template<typename T>
+class MultiFingerRecords {
+public:
+    T *Find(const int32_t pId)
+    {
+        return Contains(pId) ? &slots_[pId].record : nullptr;
+    }
+
+    const T *Find(const int32_t pId) const
+    {
+        return Contains(pId) ? &slots_[pId].record : nullptr;
+    }
+
+    /**
+     * @brief Get the record of a pointer, a new record is added if there is none.
+     * @param pId the pointer id.
+     * @return the record, nullptr if the pointer id is out of range.
+     */
+    T *Insert(const int32_t pId)
+    {
+        if (pId < 0 || pId >= MAX_FINGER_NUM) {
+            return nullptr;
+        }
+        if (!slots_[pId].isUsed) {
+            slots_[pId].record = T();
+            slots_[pId].isUsed = true;
+            size_++;
+        }
+        return &slots_[pId].record;
+    }
+
+    bool Contains(const int32_t pId) const
+    {
+        return pId >= 0 && pId < MAX_FINGER_NUM && slots_[pId].isUsed;
+    }
+
+    int32_t GetSize() const
+    {
+        return size_;
+    }
+
+    void Clear()
+    {
+        for (auto &slot : slots_) {
+            slot.isUsed = false;
+        }
+        size_ = 0;
+    }
+
+private:
+    struct Slot {
+        T record {};
+        bool isUsed = false;
+    };
+
+    Slot slots_[MAX_FINGER_NUM] {};
+    int32_t size_ = 0;
+};
+
 class AccessibilityMultiTapGestureRecognizer;
 class MultiFingerGestureHandler : public AppExecFwk::EventHandler {
 public:
@@ -302,16 +387,16 @@ private:
     int64_t GetLastFirstPointUpTime(const int32_t fingerNum);
 
     /**
-     * @brief Get the current and pre PointerItems with fingerNum, store in curPoints and prePoints.
+     * @brief Get the current and pre points with fingerNum, store in curPoints and prePoints.
      * @param curPoints to store the cur touch event pointerItems rst, size is fingerNum.
-     * @param prePoints to store the pre touch event pointerItems rst, size is fingerNum.
+     * @param prePoints to store the pre touch points rst, size is fingerNum.
      * @param event current touch event, to get the curPoints.
-     * @param prePointsEventInfo pre touch Event storage, to get the prePoints.
+     * @param prePointsInfo pre touch point storage, to get the prePoints.
      * @return true if the get rst is ok, else false.
      */
     bool GetPointerItemWithFingerNum(int32_t fingerNum, std::vector<MMI::PointerEvent::PointerItem> &curPoints,
-        std::vector<MMI::PointerEvent::PointerItem> &prePoints, MMI::PointerEvent &event,
-        std::map<int32_t, std::shared_ptr<MMI::PointerEvent>> &prePointsEventInfo);
+        std::vector<MultiFingerPoint> &prePoints, MMI::PointerEvent &event,
+        const MultiFingerRecords<MultiFingerPoint> &prePointsInfo);
 
     /**
      * @brief check whether the two taps offset is less than slop threshold.
@@ -322,7 +407,7 @@ private:
      */
     bool IsDoubelTapSlopConditionMatch(const int32_t fingerNum,
         const std::vector<MMI::PointerEvent::PointerItem> &curPoints,
-        const std::vector<MMI::PointerEvent::PointerItem> &prePoints);
+        const std::vector<MultiFingerPoint> &prePoints);
 
     /**
      * @brief Determine whether it is a multi finger double tap gesture.
@@ -346,14 +431,29 @@ private:
     int32_t GetSwipeDirection(const int32_t dx, const int32_t dy);
 
     /**
-     * @brief Get the base point Item info by point Id.
-     * @param basePointerIterm to save th base pointItem info.
-     * @param pId the point Id to get the pointItem.
-     * @param pointInfo the touch down event point info storage.
-     * @return true if get base pointItem success, else false.
+     * @brief Get the base point info by point Id.
+     * @param basePoint to save the base point info.
+     * @param pId the point Id to get the point.
+     * @param pointInfo the touch point info storage.
+     * @return true if get base point success, else false.
+     */
+    bool GetBasePoint(MultiFingerPoint &basePoint, int32_t pId, const MultiFingerRecords<MultiFingerPoint> &pointInfo);
+
+    /**
+     * @brief Record the point of the pointer the touch event is about.
+     * @param event the touch event to be recorded.
+     * @param pointInfo the touch point info storage.
+     * @return true if the point is recorded, else false.
+     */
+    bool RecordPoint(MMI::PointerEvent &event, MultiFingerRecords<MultiFingerPoint> &pointInfo);
+
+    /**
+     * @brief Add a point to the move path of a finger and check its direction.
+     * @param pId the point Id of the finger.
+     * @param x the x axis position of the point.
+     * @param y the y axis position of the point.
      */
-    bool GetBasePointItem(MMI::PointerEvent::PointerItem &basePointerIterm,
-        int32_t pId, std::map<int32_t, std::shared_ptr<MMI::PointerEvent>> &pointInfo);
+    void AddRoutePoint(const int32_t pId, const int32_t x, const int32_t y);
 
     /**
      * @brief Save move gesture path info.
@@ -368,10 +468,10 @@ private:
 
     /**
      * @brief recognize the move path is correct and match a move gesture.
-     * @param path move path pointer info storage.
+     * @param route move path info of a finger.
      * @return true if the move path is correct and match a move gesture, else false.
      */
-    bool recognizeGesturePath(const std::vector<Pointer> &path);
+    bool recognizeGesturePath(const MultiFingerRoute &route);
 
     /**
      * @brief Get the matched move gesture by moveDirection and fingerNum.
@@ -434,11 +534,11 @@ private:
     float mMinPixelsBetweenSamplesX_ = 0;
     float mMinPixelsBetweenSamplesY_ = 0;
 
-    std::map<int32_t, std::shared_ptr<MMI::PointerEvent>> firstDownPoint_; // first round touch down points
-    std::map<int32_t, std::shared_ptr<MMI::PointerEvent>> currentDownPoint_; // current round touch down points
-    std::map<int32_t, std::shared_ptr<MMI::PointerEvent>> preGesturePoint_; // pre move event points
-    std::map<int32_t, std::shared_ptr<MMI::PointerEvent>> lastUpPoint_; // last time finger touch up points
-    std::map<int32_t, std::vector<Pointer>> pointerRoute_;
+    MultiFingerRecords<MultiFingerPoint> firstDownPoint_; // first round touch down points
+    MultiFingerRecords<MultiFingerPoint> currentDownPoint_; // current round touch down points
+    MultiFingerRecords<MultiFingerPoint> preGesturePoint_; // pre move event points
+    MultiFingerRecords<MultiFingerPoint> lastUpPoint_; // last time finger touch up points
+    MultiFingerRecords<MultiFingerRoute> pointerRoute_;
 
     AccessibilityGestureRecognizeListener *listener_ = nullptr;
     std::shared_ptr<MultiFingerGestureHandler> handler_ = nullptr; // multi finger gesture recognize event handler
@@ -17,6 +17,9 @@
 #define ACCESSIBILITY_SCREEN_TOUCH_H
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <string>
 #include <thread>
 #include "accessibility_event_transmission.h"
@@ -32,6 +35,22 @@ enum ScreenTouchState : int32_t {
     BOTH_RESPONSE_DELAY_IGNORE_REPEAT_CLICK
 };
 
+enum DrawCircleCommandType : int32_t {
+    DRAW_CIRCLE_START,
+    DRAW_CIRCLE_UPDATE,
+    DRAW_CIRCLE_STOP,
+    DRAW_CIRCLE_EXIT
+};
+
+struct DrawCircleCommand {
+    DrawCircleCommandType type = DRAW_CIRCLE_STOP;
+    int32_t physicalX = 0;
+    int32_t physicalY = 0;
+    int32_t startAngle = 0;
+    int32_t screenId = 0;
+    uint32_t duration = 0; // ms, only for DRAW_CIRCLE_START
+};
+
 class AccessibilityScreenTouch;
 class ScreenTouchHandler : public AppExecFwk::EventHandler {
 public:
@@ -92,7 +111,14 @@ private:
     void Clear();
 
     void ConversionCoordinates(MMI::PointerEvent::PointerItem &item);
-    void DrawCircleProgress();
+
+    // The progress circle is drawn by one long-lived worker fed through a command queue.
+    void StartDrawCircle();
+    void UpdateDrawCircle();
+    void StopDrawCircle();
+    void PostDrawCircleCommand(const DrawCircleCommand &command);
+    void DrawCircleLoop();
+    void DrawCircleProgress(const DrawCircleCommand &startCommand);
 
     bool isMoveBeyondThreshold_ = false;
     int64_t startTime_ = 0; // microsecond
@@ -112,6 +138,9 @@ private:
     int32_t startAngle_ = 0;
     std::atomic<bool> isStopDrawCircle_;
     std::shared_ptr<std::thread> drawCircleThread_ = nullptr;
+    std::mutex drawCircleMutex_;
+    std::condition_variable drawCircleCondition_;
+    std::deque<DrawCircleCommand> drawCircleCommands_ {};
 
     static int64_t lastUpTime; // global last up time
 
@@ -16,6 +16,7 @@
 #define ACCESSIBILITY_SETTINGS_CONFIG_H
 
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -26,7 +27,33 @@
 namespace OHOS {
 namespace Accessibility {
 
-class AccessibilitySettingsConfig final {
+struct SettingsLoadStats {
+    int64_t loadTime = 0; // ms spent on reading the settings in Init
+    size_t keyCount = 0; // keys read by the batch query
+    size_t defaultCount = 0; // missing keys whose default values are written back
+    bool isBatchLoaded = false; // false if it falls back to the query of each key
+};
+
+struct SettingsFlushStats {
+    uint64_t committedCount = 0; // write-behind values written to the settings database
+    uint64_t failedCount = 0; // write-behind values whose database write failed, they are not retried
+};
+
+/*
+ * Persistence of the setters:
+ * - The switch states (SetEnabled, SetCaptionState, SetShortKeyState and so on), the shortkey targets and the
+ *   enabled services are written to the settings database before the setter returns.
+ * - The values adjusted continuously by the user (content timeout, brightness discount, audio balance, click
+ *   response time, ignore repeat click time, mouse auto click, daltonization color filter, shortkey timeout
+ *   and the caption property) are write-behind: the in-memory value is updated at once, and the database write
+ *   is kept per key so that only the last value is committed. Pending values are committed at most
+ *   500 ms after the first change, when the user is switched, when the service stops and when
+ *   FlushPendingSettings is called. Pending values are lost if the process dies before that, and the observers
+ *   of the settings database are notified when the value is committed.
+ * - The setters of the write-behind values return RET_OK once the value is pending, even if the later database
+ *   write fails. Such a failure is logged and counted in SettingsFlushStats, which hidumper -p shows.
+ */
+class AccessibilitySettingsConfig final : public std::enable_shared_from_this<AccessibilitySettingsConfig> {
 public:
     explicit AccessibilitySettingsConfig(int id);
     ~AccessibilitySettingsConfig() = default;
@@ -100,14 +127,24 @@ public:
     {
         return datashare_;
     }
+    const SettingsLoadStats &GetSettingsLoadStats() const
+    {
+        return loadStats_;
+    }
+    SettingsFlushStats GetSettingsFlushStats();
 
     void Init();
     void ClearData();
+
+    // Commits the pending write-behind values to the settings database and waits for the result.
+    RetError FlushPendingSettings();
 private:
     void InitCaption();
     void InitSetting();
     void InitCapability();
     RetError SetConfigState(const std::string& key, bool value);
+    RetError PutDeferredValue(const std::string& key, const std::string& value);
+    void DropPendingSettings();
 
     int32_t accountId_;
     bool enabled_ = false;
@@ -142,6 +179,13 @@ private:
 
     std::shared_ptr<AccessibilityDatashareHelper> datashare_ = nullptr;
     std::shared_ptr<AccessibilityDatashareHelper> systemDatashare_ = nullptr;
+    SettingsLoadStats loadStats_;
+
+    ffrt::mutex pendingMutex_;
+    ffrt::mutex flushMutex_;
+    bool isFlushScheduled_ = false;
+    SettingsFlushStats flushStats_; // guarded by flushMutex_
+    std::map<std::string, std::string> pendingValues_ {}; // key -> last value not committed yet
     ffrt::mutex interfaceMutex_;
 };
 } // namespace Accessibility
@@ -17,6 +17,7 @@
 #ifndef ACCESSIBILITY_TOUCHEVENT_INJECTOR_H
 #define ACCESSIBILITY_TOUCHEVENT_INJECTOR_H
 
+#include <atomic>
 #include <time.h>
 #include "accessibility_event_transmission.h"
 #include "event_handler.h"
@@ -29,8 +30,11 @@ namespace OHOS {
 namespace Accessibility {
 const int64_t DOUBLE_TAP_MIN_TIME = 50000; // microsecond
 
-struct SendEventArgs {
-    std::shared_ptr<MMI::PointerEvent> event_;
+struct InjectionJitterStats {
+    uint64_t injectedCount = 0; // events sent by the injection scheduler
+    int64_t lastJitter = 0; // us between the requested and the actual send time of the last event
+    int64_t maxJitter = 0; // us
+    int64_t averageJitter = 0; // us
 };
 
 class TouchEventInjector;
@@ -86,7 +90,30 @@ public:
      */
     void InjectEvents(const std::shared_ptr<AccessibilityGestureInjectPath>& gesturePath);
 
+    /**
+     * @brief Send the injected events whose time has come and arm the deadline of the next one.
+     *        Called by the inject handler on the input runner.
+     */
+    void SendInjectedEvents();
+
+    /**
+     * @brief Get the deviation between the requested and the actual injection time.
+     * @return the jitter statistics of the injected events
+     */
+    InjectionJitterStats GetInjectionJitterStats() const;
+
 private:
+    /**
+     * @brief Arm the single deadline timer for the next event of the playback buffer.
+     */
+    void ScheduleNextEvent();
+
+    /**
+     * @brief Record the jitter of one injected event.
+     * @param jitter the deviation from the requested injection time in microseconds
+     */
+    void UpdateJitterStats(int64_t jitter);
+
     /**
      * @brief Cancel the gesture.
      */
@@ -138,7 +165,14 @@ private:
     bool isDestroyEvent_ = false;
     std::shared_ptr<TouchInjectHandler> handler_ = nullptr;
     std::shared_ptr<AppExecFwk::EventRunner> runner_ = nullptr;
+    // Playback buffer of the current gesture, its capacity is kept between gestures.
     std::vector<std::shared_ptr<MMI::PointerEvent>> injectedEvents_;
+    size_t nextEventIndex_ = 0;
+
+    std::atomic<uint64_t> injectedCount_ {0};
+    std::atomic<int64_t> lastJitter_ {0};
+    std::atomic<int64_t> maxJitter_ {0};
+    std::atomic<int64_t> totalJitter_ {0};
 };
 } // namespace Accessibility
 } // namespace OHOS
@@ -19,6 +19,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <unordered_map>
 #include "accessibility_window_info.h"
 #include "event_handler.h"
 #include "ffrt.h"
@@ -84,8 +85,15 @@ public:
         bool CheckWindowIdPair(const int32_t windowId);
         std::map<int32_t, int64_t> GetAllPairs();
         void Clear();
+        bool IsRootElement(const int64_t elementId);
+        bool GetInnerWindowId(const int64_t elementId, int32_t& windowId);
+        void InsertElements(const int32_t windowId, const std::vector<int64_t>& elementIds);
     private:
+        void RemoveElements(const int32_t windowId, const int64_t rootElementId);
+
         std::map<int32_t, int64_t> windowElementMap_;
+        std::unordered_map<int64_t, int32_t> rootElementMap_; // key: root element id of an inner window
+        std::unordered_map<int64_t, int32_t> elementWindowMap_; // key: element id below an inner window root
         ffrt::mutex mapMutex_;
     };
     SceneBoardElementIdMap sceneBoardElementIdMap_ = {};
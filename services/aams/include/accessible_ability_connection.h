@@ -16,6 +16,7 @@
 #ifndef ACCESSIBLE_ABILITY_CONNECTION_H
 #define ACCESSIBLE_ABILITY_CONNECTION_H
 
+#include <unordered_set>
 #include "ability_connect_callback_stub.h"
 #include "accessibility_ability_info.h"
 #include "accessible_ability_channel.h"
@@ -98,6 +99,7 @@ private:
     sptr<IAccessibleAbilityClient> abilityClient_ = nullptr;
     sptr<AccessibleAbilityChannel> channel_ = nullptr;
     AccessibilityAbilityInfo abilityInfo_ {};
+    std::unordered_set<std::string> filterBundleNames_ {}; // the filter bundle names of abilityInfo_
     AppExecFwk::ElementName elementName_ {};
     std::shared_ptr<AppExecFwk::EventHandler> eventHandler_ = nullptr;
 };
@@ -16,9 +16,12 @@
 #ifndef ACCESSIBLE_ABILITY_MANAGER_SERVICE_H
 #define ACCESSIBLE_ABILITY_MANAGER_SERVICE_H
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "accessibility_dumper.h"
 #include "accessibility_def.h"
@@ -57,6 +60,13 @@ enum CallBackID {
 
 constexpr int REQUEST_ID_INIT = 65535;
 
+struct EventCoalescingStats {
+    uint64_t receivedCount = 0; // events of the coalesced types
+    uint64_t mergedCount = 0; // events replaced by a later event of the same window and type
+    uint64_t deliveredCount = 0; // coalesced events delivered to the abilities
+    uint64_t passThroughCount = 0; // events delivered without delay
+};
+
 const std::map<std::string, int32_t> AccessibilityConfigTable = {
     {"HIGH_CONTRAST_TEXT", HIGH_CONTRAST_TEXT},
     {"INVERT_COLOR", INVERT_COLOR},
@@ -88,6 +98,7 @@ public:
 public:
     /* For AccessibleAbilityManagerServiceStub */
     RetError SendEvent(const AccessibilityEventInfo &uiEvent, const int32_t flag = 0) override;
+    RetError SendEvents(const std::vector<AccessibilityEventInfo> &uiEvents, const int32_t flag = 0) override;
 
     RetError VerifyingToKenId(const int32_t windowId, const int64_t elementId);
 
@@ -171,6 +182,11 @@ public:
 
     void SetKeyEventFilter(const sptr<KeyEventFilter> &keyEventFilter);
 
+    inline sptr<AccessibilityInputInterceptor> GetInputInterceptor()
+    {
+        return inputInterceptor_;
+    }
+
     /* For DisplayResize */
     void NotifyDisplayResizeStateChanged(int32_t displayId, Rect& rect, float scale, float centerX, float centerY);
 
@@ -194,6 +210,17 @@ public:
         return runner_;
     }
 
+    // Dedicated runner for the input event transmission chain.
+    inline std::shared_ptr<AAMSEventHandler> &GetInputHandler()
+    {
+        return inputHandler_;
+    }
+
+    inline std::shared_ptr<AppExecFwk::EventRunner> &GetInputRunner()
+    {
+        return inputRunner_;
+    }
+
     sptr<AccessibilityAccountData> GetAccountData(int32_t accountId);
     sptr<AccessibilityAccountData> GetCurrentAccountData();
     sptr<AppExecFwk::IBundleMgr> GetBundleMgrProxy();
@@ -213,6 +240,7 @@ public:
 
     // used for arkui windowId 1 map to WMS windowId
     void FindInnerWindowId(const AccessibilityEventInfo &event, int32_t& windowId);
+    void FindInnerWindowIdAsync(const AccessibilityEventInfo &event, const uint64_t sequence);
     bool GetParentElementRecursively(int32_t windowId, int64_t elementId,
         std::vector<AccessibilityElementInfo>& infos);
 
@@ -297,8 +325,17 @@ public:
     void AddRequestId(int32_t windowId, int32_t treeId, int32_t requestId,
         sptr<IAccessibilityElementOperatorCallback> callback);
     void RemoveRequestId(int32_t requestId) override;
+    void GetPendingRequestNums(std::map<int32_t, size_t>& requestNums);
     void OnDataClone();
 
+    /**
+     * @brief Set how long events of the type are held to merge them with later ones.
+     * @param eventType The type of the event.
+     * @param window The coalescing window in ms, 0 to deliver the events immediately.
+     */
+    void SetEventCoalescingWindow(const EventType eventType, const int64_t window);
+    void GetEventCoalescingStats(EventCoalescingStats& stats);
+
 private:
     void StopCallbackWait(int32_t windowId);
     void StopCallbackWait(int32_t windowId, int32_t treeId);
@@ -387,6 +424,65 @@ private:
         ffrt::mutex stateObserversMutex_;
     };
 
+    // the callbacks of element operator requests which are waiting for the result
+    class RequestIdRegistry {
+    public:
+        RequestIdRegistry() = default;
+        ~RequestIdRegistry() = default;
+        void AddRequestId(int32_t windowId, int32_t treeId, int32_t requestId,
+            const sptr<IAccessibilityElementOperatorCallback>& callback);
+        void RemoveRequestId(int32_t requestId);
+        void RemoveRequestIds(int32_t windowId, int32_t treeId,
+            std::vector<std::pair<int32_t, sptr<IAccessibilityElementOperatorCallback>>>& callbacks);
+        void RemoveRequestIds(int32_t windowId,
+            std::vector<std::pair<int32_t, sptr<IAccessibilityElementOperatorCallback>>>& callbacks);
+        void GetPendingRequestNums(std::map<int32_t, size_t>& requestNums);
+    private:
+        struct RequestInfo {
+            int32_t windowId;
+            int32_t treeId;
+            sptr<IAccessibilityElementOperatorCallback> callback;
+        };
+        void EraseRequestId(int32_t requestId, const RequestInfo& info);
+
+        std::unordered_map<int32_t, RequestInfo> requests_; // key: requestId
+        // windowId->treeId->requestIds
+        std::unordered_map<int32_t, std::unordered_map<int32_t, std::unordered_set<int32_t>>> windowRequestIds_;
+        ffrt::mutex mutex_;
+    };
+
+    // holds bursts of high-frequency events per window and type, only used on the main runner.
+    // The held events of a window always leave together in arrival order, so the abilities never see
+    // the events of one window reordered across types.
+    class EventCoalescer {
+    public:
+        EventCoalescer();
+        ~EventCoalescer() = default;
+        int64_t GetWindow(const EventType eventType) const;
+        void SetWindow(const EventType eventType, const int64_t window);
+        bool HoldEvent(const AccessibilityEventInfo& event, std::vector<AccessibilityEventInfo>& readyEvents);
+        void TakeEvents(const int32_t windowId, std::vector<AccessibilityEventInfo>& events);
+        void CountPassThrough();
+        void GetStats(EventCoalescingStats& stats) const;
+    private:
+        struct HeldEvent {
+            uint64_t sequence = 0; // arrival order of the latest event merged in
+            AccessibilityEventInfo event;
+        };
+
+        std::map<uint32_t, int64_t> windows_; // key: event type, value: coalescing window in ms
+        std::map<std::pair<int32_t, uint32_t>, HeldEvent> pendingEvents_; // key: windowId, event type
+        uint64_t nextSequence_ = 0;
+        std::atomic<uint64_t> receivedCount_ {0};
+        std::atomic<uint64_t> mergedCount_ {0};
+        std::atomic<uint64_t> deliveredCount_ {0};
+        std::atomic<uint64_t> passThroughCount_ {0};
+    };
+
+    void SetInputRunnerPriority();
+    void CoalesceEvent(const AccessibilityEventInfo &uiEvent);
+    void DispatchEvent(AccessibilityEventInfo &uiEvent);
+
     RetError InnerEnableAbility(const std::string &name, const uint32_t capabilities);
     RetError InnerDisableAbility(const std::string &name);
 
@@ -438,7 +534,12 @@ private:
     std::shared_ptr<AppExecFwk::EventRunner> actionRunner_;
     std::shared_ptr<AAMSEventHandler> actionHandler_;
 
+    std::shared_ptr<AppExecFwk::EventRunner> inputRunner_;
+    std::shared_ptr<AAMSEventHandler> inputHandler_;
+
     int64_t ipcTimeoutNum_ = 0; // count ipc timeout number
+    uint64_t windowStateSequence_ = 0; // count hover and focus events which update the window state
+    ffrt::mutex windowStateMutex_; // mutex for windowStateSequence_
 
     sptr<IRemoteObject::DeathRecipient> stateObserversDeathRecipient_ = nullptr;
     std::map<int32_t, sptr<IRemoteObject::DeathRecipient>> interactionOperationDeathRecipients_ {};
@@ -454,8 +555,8 @@ private:
     std::vector<std::string> removedAutoStartAbilities_ {};
     std::map<int32_t, AccessibilityEventInfo> windowFocusEventMap_ {};
 
-    std::map<int32_t, std::map<int32_t, std::set<int32_t>>> windowRequestIdMap_ {}; // windowId->treeId->requestId
-    std::map<int32_t, sptr<IAccessibilityElementOperatorCallback>> requestIdMap_ {}; // requestId->callback
+    RequestIdRegistry requestIdRegistry_;
+    EventCoalescer eventCoalescer_;
 };
 } // namespace Accessibility
 } // namespace OHOS
@@ -107,6 +107,9 @@ uint32_t AccessibilityAccountData::GetAccessibilityState()
 void AccessibilityAccountData::OnAccountSwitched()
 {
     HILOG_INFO();
+    if (config_) {
+        config_->FlushPendingSettings();
+    }
     connectingA11yAbilities_.Clear();
     std::vector<sptr<AccessibleAbilityConnection>> connectionList;
     connectedA11yAbilities_.GetAccessibilityAbilities(connectionList);
@@ -119,7 +122,8 @@ void AccessibilityAccountData::OnAccountSwitched()
     connectedA11yAbilities_.Clear();
     enabledAbilities_.clear();
     std::lock_guard lock(asacConnectionsMutex_);
-    asacConnections_.clear();
+    std::atomic_store(&asacConnections_, std::make_shared<const WindowConnectionMap>());
+    PublishElementOperatorSnapshot();
 }
 
 void AccessibilityAccountData::AddConnectedAbility(sptr<AccessibleAbilityConnection>& connection)
@@ -215,19 +219,55 @@ void AccessibilityAccountData::AddAccessibilityWindowConnection(
 {
     HILOG_INFO("windowId(%{public}d)", windowId);
     std::lock_guard lock(asacConnectionsMutex_);
-    asacConnections_[windowId] = interactionConnection;
+    auto asacConnections = std::make_shared<WindowConnectionMap>(*asacConnections_);
+    (*asacConnections)[windowId] = interactionConnection;
+    std::atomic_store(&asacConnections_, std::shared_ptr<const WindowConnectionMap>(asacConnections));
+    PublishElementOperatorSnapshot();
 }
 
 void AccessibilityAccountData::RemoveAccessibilityWindowConnection(const int32_t windowId)
 {
     HILOG_INFO("windowId(%{public}d)", windowId);
     std::lock_guard lock(asacConnectionsMutex_);
-    std::map<int32_t, sptr<AccessibilityWindowConnection>>::iterator it = asacConnections_.find(windowId);
-    if (it != asacConnections_.end()) {
-        asacConnections_.erase(it);
+    if (asacConnections_->count(windowId)) {
+        auto asacConnections = std::make_shared<WindowConnectionMap>(*asacConnections_);
+        asacConnections->erase(windowId);
+        std::atomic_store(&asacConnections_, std::shared_ptr<const WindowConnectionMap>(asacConnections));
+        PublishElementOperatorSnapshot();
     }
 }
 
+std::shared_ptr<const ElementOperatorSnapshot> AccessibilityAccountData::GetElementOperatorSnapshot()
+{
+    return std::atomic_load(&elementOperatorSnapshot_);
+}
+
+void AccessibilityAccountData::UpdateElementOperatorSnapshot()
+{
+    std::lock_guard lock(asacConnectionsMutex_);
+    PublishElementOperatorSnapshot();
+}
+
+void AccessibilityAccountData::PublishElementOperatorSnapshot()
+{
+    auto snapshot = std::make_shared<ElementOperatorSnapshot>();
+    for (auto &asacConnection : *asacConnections_) {
+        if (!asacConnection.second) {
+            continue;
+        }
+        auto &operators = (*snapshot)[asacConnection.first];
+        operators[0] = asacConnection.second->GetProxy();
+        std::vector<int32_t> treeIds;
+        asacConnection.second->GetAllTreeId(treeIds);
+        for (int32_t treeId : treeIds) {
+            if (treeId > 0) {
+                operators[treeId] = asacConnection.second->GetCardProxy(treeId);
+            }
+        }
+    }
+    std::atomic_store(&elementOperatorSnapshot_, std::shared_ptr<const ElementOperatorSnapshot>(snapshot));
+}
+
 void AccessibilityAccountData::AddConnectingA11yAbility(const std::string &uri,
     const sptr<AccessibleAbilityConnection> &connection)
 {
@@ -326,14 +366,11 @@ const sptr<AccessibleAbilityConnection> AccessibilityAccountData::GetAccessibleA
 const sptr<AccessibilityWindowConnection> AccessibilityAccountData::GetAccessibilityWindowConnection(
     const int32_t windowId)
 {
-    std::lock_guard lock(asacConnectionsMutex_);
-    HILOG_DEBUG("window id[%{public}d] interactionOperators's size[%{public}zu]", windowId, asacConnections_.size());
-    for (auto &asacConnection : asacConnections_) {
-        HILOG_DEBUG("window id of asacConnection is %{public}d", asacConnection.first);
-    }
-
-    if (asacConnections_.count(windowId) > 0) {
-        return asacConnections_[windowId];
+    std::shared_ptr<const WindowConnectionMap> asacConnections = GetAsacConnectionsSnapshot();
+    HILOG_DEBUG("window id[%{public}d] interactionOperators's size[%{public}zu]", windowId, asacConnections->size());
+    auto iter = asacConnections->find(windowId);
+    if (iter != asacConnections->end()) {
+        return iter->second;
     }
 
     return nullptr;
@@ -341,15 +378,29 @@ const sptr<AccessibilityWindowConnection> AccessibilityAccountData::GetAccessibi
 
 const std::map<std::string, sptr<AccessibleAbilityConnection>> AccessibilityAccountData::GetConnectedA11yAbilities()
 {
-    std::map<std::string, sptr<AccessibleAbilityConnection>> connectionMap;
-    connectedA11yAbilities_.GetAccessibilityAbilitiesMap(connectionMap);
-    return connectionMap;
+    return *connectedA11yAbilities_.GetAccessibilityAbilitiesSnapshot();
+}
+
+std::shared_ptr<const AbilityConnectionMap> AccessibilityAccountData::GetConnectedA11yAbilitiesSnapshot()
+{
+    return connectedA11yAbilities_.GetAccessibilityAbilitiesSnapshot();
+}
+
+void AccessibilityAccountData::GetEventSubscribers(const uint32_t eventType,
+    std::vector<sptr<AccessibleAbilityConnection>>& subscribers)
+{
+    connectedA11yAbilities_.GetAccessibilityAbilitiesByEventType(eventType, subscribers);
 }
 
 const std::map<int32_t, sptr<AccessibilityWindowConnection>> AccessibilityAccountData::GetAsacConnections()
 {
     HILOG_DEBUG("GetAsacConnections start.");
-    return asacConnections_;
+    return *GetAsacConnectionsSnapshot();
+}
+
+std::shared_ptr<const WindowConnectionMap> AccessibilityAccountData::GetAsacConnectionsSnapshot()
+{
+    return std::atomic_load(&asacConnections_);
 }
 
 const CaptionPropertyCallbacks AccessibilityAccountData::GetCaptionPropertyCallbacks()
@@ -1051,33 +1102,36 @@ void AccessibilityAccountData::AccessibilityAbility::AddAccessibilityAbility(con
 {
     HILOG_INFO("uri is %{private}s", uri.c_str());
     std::lock_guard<ffrt::mutex> lock(mutex_);
-    if (!connectionMap_.count(uri)) {
-        connectionMap_[uri] = connection;
-        HILOG_DEBUG("connectionMap_ size %{public}zu", connectionMap_.size());
+    if (!connectionMap_->count(uri)) {
+        auto connectionMap = std::make_shared<AbilityConnectionMap>(*connectionMap_);
+        (*connectionMap)[uri] = connection;
+        PublishConnectionMap(connectionMap);
+        HILOG_DEBUG("connectionMap_ size %{public}zu", connectionMap->size());
         return;
     }
 
-    HILOG_DEBUG("uri %{private}s, connectionMap_ %{public}zu", uri.c_str(), connectionMap_.size());
+    HILOG_DEBUG("uri %{private}s, connectionMap_ %{public}zu", uri.c_str(), connectionMap_->size());
 }
 
 void AccessibilityAccountData::AccessibilityAbility::RemoveAccessibilityAbilityByUri(const std::string& uri)
 {
     HILOG_INFO("uri is %{private}s", uri.c_str());
     std::lock_guard<ffrt::mutex> lock(mutex_);
-    auto it = connectionMap_.find(uri);
-    if (it != connectionMap_.end()) {
-        connectionMap_.erase(it);
+    if (connectionMap_->count(uri)) {
+        auto connectionMap = std::make_shared<AbilityConnectionMap>(*connectionMap_);
+        connectionMap->erase(uri);
+        PublishConnectionMap(connectionMap);
     }
 
-    HILOG_DEBUG("connectionMap_ %{public}zu", connectionMap_.size());
+    HILOG_DEBUG("connectionMap_ %{public}zu", connectionMap_->size());
 }
 
 sptr<AccessibleAbilityConnection> AccessibilityAccountData::AccessibilityAbility::GetAccessibilityAbilityByName(
     const std::string& elementName)
 {
     HILOG_DEBUG("elementName is %{public}s", elementName.c_str());
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    for (auto& connection : connectionMap_) {
+    std::shared_ptr<const AbilityConnectionMap> connectionMap = GetAccessibilityAbilitiesSnapshot();
+    for (auto& connection : *connectionMap) {
         std::string::size_type index = connection.first.find(elementName);
         if (index == std::string::npos) {
             continue;
@@ -1094,9 +1148,9 @@ sptr<AccessibleAbilityConnection> AccessibilityAccountData::AccessibilityAbility
     const std::string& uri)
 {
     HILOG_DEBUG("uri is %{private}s", uri.c_str());
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    auto iter = connectionMap_.find(uri);
-    if (iter != connectionMap_.end()) {
+    std::shared_ptr<const AbilityConnectionMap> connectionMap = GetAccessibilityAbilitiesSnapshot();
+    auto iter = connectionMap->find(uri);
+    if (iter != connectionMap->end()) {
         return iter->second;
     }
     return nullptr;
@@ -1105,31 +1159,50 @@ sptr<AccessibleAbilityConnection> AccessibilityAccountData::AccessibilityAbility
 void AccessibilityAccountData::AccessibilityAbility::GetAccessibilityAbilities(
     std::vector<sptr<AccessibleAbilityConnection>>& connectionList)
 {
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    for (auto& connection : connectionMap_) {
+    std::shared_ptr<const AbilityConnectionMap> connectionMap = GetAccessibilityAbilitiesSnapshot();
+    connectionList.reserve(connectionList.size() + connectionMap->size());
+    for (auto& connection : *connectionMap) {
         connectionList.push_back(connection.second);
     }
 }
 
+void AccessibilityAccountData::AccessibilityAbility::GetAccessibilityAbilitiesByEventType(const uint32_t eventType,
+    std::vector<sptr<AccessibleAbilityConnection>>& connectionList)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto iter = eventRoutes_.find(eventType);
+    if (iter == eventRoutes_.end()) {
+        std::vector<sptr<AccessibleAbilityConnection>> subscribers;
+        for (auto& connection : *connectionMap_) {
+            if (connection.second && (connection.second->GetAbilityInfo().GetEventTypes() & eventType) == eventType) {
+                subscribers.push_back(connection.second);
+            }
+        }
+        HILOG_DEBUG("eventType %{public}u has %{public}zu subscribers", eventType, subscribers.size());
+        iter = eventRoutes_.emplace(eventType, std::move(subscribers)).first;
+    }
+    connectionList = iter->second;
+}
+
 void AccessibilityAccountData::AccessibilityAbility::GetAbilitiesInfo(
     std::vector<AccessibilityAbilityInfo>& abilities)
 {
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    for (auto& connection : connectionMap_) {
+    std::shared_ptr<const AbilityConnectionMap> connectionMap = GetAccessibilityAbilitiesSnapshot();
+    for (auto& connection : *connectionMap) {
         if (connection.second) {
             abilities.push_back(connection.second->GetAbilityInfo());
         }
     }
 
     HILOG_DEBUG("connectionMap_ %{public}zu and enabledAbilities %{public}zu",
-        connectionMap_.size(), abilities.size());
+        connectionMap->size(), abilities.size());
 }
 
 bool AccessibilityAccountData::AccessibilityAbility::IsExistCapability(Capability capability)
 {
     HILOG_DEBUG("capability %{public}d", capability);
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    for (auto iter = connectionMap_.begin(); iter != connectionMap_.end(); iter++) {
+    std::shared_ptr<const AbilityConnectionMap> connectionMap = GetAccessibilityAbilitiesSnapshot();
+    for (auto iter = connectionMap->begin(); iter != connectionMap->end(); iter++) {
         if (iter->second->GetAbilityInfo().GetCapabilityValues() & capability) {
             return true;
         }
@@ -1141,27 +1214,38 @@ bool AccessibilityAccountData::AccessibilityAbility::IsExistCapability(Capabilit
 void AccessibilityAccountData::AccessibilityAbility::GetAccessibilityAbilitiesMap(
     std::map<std::string, sptr<AccessibleAbilityConnection>>& connectionMap)
 {
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    connectionMap = connectionMap_;
+    connectionMap = *GetAccessibilityAbilitiesSnapshot();
+}
+
+std::shared_ptr<const AbilityConnectionMap>
+    AccessibilityAccountData::AccessibilityAbility::GetAccessibilityAbilitiesSnapshot()
+{
+    return std::atomic_load(&connectionMap_);
+}
+
+void AccessibilityAccountData::AccessibilityAbility::PublishConnectionMap(
+    const std::shared_ptr<AbilityConnectionMap>& connectionMap)
+{
+    std::atomic_store(&connectionMap_, std::shared_ptr<const AbilityConnectionMap>(connectionMap));
+    eventRoutes_.clear();
 }
 
 void AccessibilityAccountData::AccessibilityAbility::Clear()
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
-    return connectionMap_.clear();
+    PublishConnectionMap(std::make_shared<AbilityConnectionMap>());
 }
 
 size_t AccessibilityAccountData::AccessibilityAbility::GetSize()
 {
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    return connectionMap_.size();
+    return GetAccessibilityAbilitiesSnapshot()->size();
 }
 
 void AccessibilityAccountData::AccessibilityAbility::GetDisableAbilities(
     std::vector<AccessibilityAbilityInfo> &disabledAbilities)
 {
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    for (auto& connection : connectionMap_) {
+    std::shared_ptr<const AbilityConnectionMap> connectionMap = GetAccessibilityAbilitiesSnapshot();
+    for (auto& connection : *connectionMap) {
         for (auto iter = disabledAbilities.begin(); iter != disabledAbilities.end();) {
             if (connection.second && (iter->GetId() == connection.second->GetAbilityInfo().GetId())) {
                 iter = disabledAbilities.erase(iter);
@@ -1176,7 +1260,8 @@ void AccessibilityAccountData::AccessibilityAbility::RemoveAccessibilityAbilityB
     bool& result)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
-    for (auto& connection : connectionMap_) {
+    std::shared_ptr<AbilityConnectionMap> connectionMap = nullptr;
+    for (auto& connection : *connectionMap_) {
         std::size_t firstPos = connection.first.find_first_of('/') + 1;
         std::size_t endPos = connection.first.find_last_of('/');
         if (endPos <= firstPos) {
@@ -1187,20 +1272,21 @@ void AccessibilityAccountData::AccessibilityAbility::RemoveAccessibilityAbilityB
         std::string connectedBundleName = connection.first.substr(firstPos, endPos - firstPos);
         if (connectedBundleName == bundleName) {
             HILOG_DEBUG("remove connected ability, bundle name %{public}s", connectedBundleName.c_str());
-            std::string uri = Utils::GetUri(connection.second->GetElementName());
-            auto it = connectionMap_.find(uri);
-            if (it != connectionMap_.end()) {
-                connectionMap_.erase(it);
+            if (!connectionMap) {
+                connectionMap = std::make_shared<AbilityConnectionMap>(*connectionMap_);
             }
+            connectionMap->erase(Utils::GetUri(connection.second->GetElementName()));
             result = true;
         }
     }
+    if (connectionMap) {
+        PublishConnectionMap(connectionMap);
+    }
 }
 
 int32_t AccessibilityAccountData::AccessibilityAbility::GetSizeByUri(const std::string& uri)
 {
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    return connectionMap_.count(uri);
+    return GetAccessibilityAbilitiesSnapshot()->count(uri);
 }
 
 sptr<AccessibilityAccountData> AccessibilityAccountDataMap::AddAccountData(
@@ -103,6 +103,81 @@ AccessibilityCircleDrawingManager::AccessibilityCircleDrawingManager()
     HILOG_DEBUG("not support display manager");
     screenId_ = 0;
     dispalyDensity_ = 1;
+#endif
+    InitProgressPaints();
+}
+
+void AccessibilityCircleDrawingManager::InitProgressPaints()
+{
+    outCircleRadius_ = dispalyDensity_ * OUT_CIRCLE_RADIUS;
+    centerCircleRadius_ = dispalyDensity_ * CENTER_CIRCLE_RADIUS;
+    progressRadius_ = dispalyDensity_ * PROGRESS_RADIUS;
+    std::vector<int32_t> outCircleColor = ParseColorString(OUT_CIRCLE_BACKGROUND_COLOR_TYPE);
+    std::vector<int32_t> progressColor = ParseColorString(PROGRESS_COLOR_TYPE);
+    std::vector<int32_t> progressCircleColor = ParseColorString(PROGRESS_BACKGROUND_COLOR_TYPE);
+
+#ifndef USE_ROSEN_DRAWING
+    // outer circle
+    outCirclePaint_.setAntiAlias(true);
+    outCirclePaint_.setAlphaf(OUT_CIRCLE_BACKGROUND_ALPHA);
+    outCirclePaint_.setARGB(OUT_CIRCLE_BACKGROUND_ALPHA, outCircleColor[NUMBER_0], outCircleColor[NUMBER_1],
+        outCircleColor[NUMBER_2]);
+    outCirclePaint_.setStyle(SkPaint::kFill_Style);
+
+    // center circle
+    centerCirclePaint_.setAntiAlias(true);
+    centerCirclePaint_.setAlphaf(CENTER_CIRCLE_BACKGROUND_ALPHA);
+    centerCirclePaint_.setARGB(CENTER_CIRCLE_BACKGROUND_ALPHA, progressColor[NUMBER_0], progressColor[NUMBER_1],
+        progressColor[NUMBER_2]);
+    centerCirclePaint_.setStyle(SkPaint::kFill_Style);
+
+    // progress circle
+    progressCirclePaint_.setAntiAlias(true);
+    progressCirclePaint_.setAlphaf(PROGRESS_BACKGROUND_ALPHA);
+    progressCirclePaint_.setARGB(PROGRESS_BACKGROUND_ALPHA, progressCircleColor[NUMBER_0],
+        progressCircleColor[NUMBER_1], progressCircleColor[NUMBER_2]);
+    progressCirclePaint_.setStrokeWidth(PROGRESS_STROKE_WIDTH * dispalyDensity_);
+    progressCirclePaint_.setStyle(SkPaint::kStroke_Style);
+
+    // progress arc
+    progressArcPaint_.setAntiAlias(true);
+    progressArcPaint_.setAlphaf(PROGRESS_BAR_BACKGROUND_ALPHA);
+    progressArcPaint_.setARGB(PROGRESS_BAR_BACKGROUND_ALPHA, progressColor[NUMBER_0], progressColor[NUMBER_1],
+        progressColor[NUMBER_2]);
+    progressArcPaint_.setStrokeWidth(PROGRESS_STROKE_WIDTH * dispalyDensity_);
+    progressArcPaint_.setStyle(SkPaint::kStroke_Style);
+
+    progressArcRect_ = SkRect::MakeLTRB(half_ - progressRadius_, half_ - progressRadius_,
+        half_ + progressRadius_, half_ + progressRadius_);
+#else
+    // outer circle
+    outCircleBrush_.SetAntiAlias(true);
+    outCircleBrush_.SetAlphaF(OUT_CIRCLE_BACKGROUND_ALPHA);
+    outCircleBrush_.SetARGB(OUT_CIRCLE_BACKGROUND_ALPHA, outCircleColor[NUMBER_0], outCircleColor[NUMBER_1],
+        outCircleColor[NUMBER_2]);
+
+    // center circle
+    centerCircleBrush_.SetAntiAlias(true);
+    centerCircleBrush_.SetAlphaF(CENTER_CIRCLE_BACKGROUND_ALPHA);
+    centerCircleBrush_.SetARGB(CENTER_CIRCLE_BACKGROUND_ALPHA, progressColor[NUMBER_0], progressColor[NUMBER_1],
+        progressColor[NUMBER_2]);
+
+    // progress circle
+    progressPen_.SetAntiAlias(true);
+    progressPen_.SetAlphaF(PROGRESS_BACKGROUND_ALPHA);
+    progressPen_.SetARGB(PROGRESS_BACKGROUND_ALPHA, progressCircleColor[NUMBER_0],
+        progressCircleColor[NUMBER_1], progressCircleColor[NUMBER_2]);
+    progressPen_.SetWidth(PROGRESS_STROKE_WIDTH * dispalyDensity_);
+
+    // progress arc
+    progressArcPen_.SetAntiAlias(true);
+    progressArcPen_.SetAlphaF(PROGRESS_BAR_BACKGROUND_ALPHA);
+    progressArcPen_.SetARGB(PROGRESS_BAR_BACKGROUND_ALPHA, progressColor[NUMBER_0], progressColor[NUMBER_1],
+        progressColor[NUMBER_2]);
+    progressArcPen_.SetWidth(PROGRESS_STROKE_WIDTH * dispalyDensity_);
+
+    progressArcRect_ = Rosen::Drawing::Rect(half_ - progressRadius_, half_ - progressRadius_,
+        half_ + progressRadius_, half_ + progressRadius_);
 #endif
 }
 
@@ -129,6 +204,10 @@ void AccessibilityCircleDrawingManager::UpdatePointerVisible(bool state)
         return;
     }
 
+    if (isPointerVisible_ == state) {
+        return;
+    }
+    isPointerVisible_ = state;
     surfaceNode_->SetVisible(state);
     Rosen::RSTransaction::FlushImplicitTransaction();
 }
@@ -149,6 +228,9 @@ void AccessibilityCircleDrawingManager::CreatePointerWindow(int32_t physicalX, i
     surfaceNode_->SetPositionZ(Rosen::RSSurfaceNode::POINTER_WINDOW_POSITION_Z);
     surfaceNode_->SetBounds(physicalX - half_, physicalY - half_, imageWidth_, imageHeight_);
     surfaceNode_->SetBackgroundColor(SK_ColorTRANSPARENT); // USE_ROSEN_DRAWING
+    pointerX_ = physicalX;
+    pointerY_ = physicalY;
+    isPointerVisible_ = false;
     screenId_ = screenId;
     surfaceNode_->AttachToDisplay(screenId);
     surfaceNode_->SetRotation(0);
@@ -175,53 +257,10 @@ void AccessibilityCircleDrawingManager::DrawingProgressByOpenSource(int32_t phys
     HILOG_DEBUG();
     auto canvas = static_cast<Rosen::RSRecordingCanvas *>(canvasNode_->BeginRecording(imageWidth_, imageHeight_));
 
-    // outer circle
-    SkPaint outCirclePaint;
-    outCirclePaint.setAntiAlias(true);
-    outCirclePaint.setAlphaf(OUT_CIRCLE_BACKGROUND_ALPHA);
-
-    std::vector<int32_t> outCircleColor = ParseColorString(OUT_CIRCLE_BACKGROUND_COLOR_TYPE);
-    outCirclePaint.setARGB(OUT_CIRCLE_BACKGROUND_ALPHA, outCircleColor[NUMBER_0], outCircleColor[NUMBER_1],
-        outCircleColor[NUMBER_2]);
-    outCirclePaint.setStyle(SkPaint::kFill_Style);
-    canvas->drawCircle(half_, half_, dispalyDensity_ * OUT_CIRCLE_RADIUS, outCirclePaint);
-
-    // center circle
-    SkPaint centerCirclePaint;
-    centerCirclePaint.setAntiAlias(true);
-    centerCirclePaint.setAlphaf(CENTER_CIRCLE_BACKGROUND_ALPHA);
-    std::vector<int32_t> centerCircleColor = ParseColorString(PROGRESS_COLOR_TYPE);
-    centerCirclePaint.setARGB(CENTER_CIRCLE_BACKGROUND_ALPHA, centerCircleColor[NUMBER_0],
-        centerCircleColor[NUMBER_1], centerCircleColor[NUMBER_2]);
-    centerCirclePaint.setStyle(SkPaint::kFill_Style);
-    canvas->drawCircle(half_, half_, dispalyDensity_ * CENTER_CIRCLE_RADIUS, centerCirclePaint);
-
-    // progress circle
-    SkPaint progressCirclePaint;
-    progressCirclePaint.setAntiAlias(true);
-    progressCirclePaint.setAlphaf(PROGRESS_BACKGROUND_ALPHA);
-    std::vector<int32_t> progressCircleColor = ParseColorString(PROGRESS_BACKGROUND_COLOR_TYPE);
-    progressCirclePaint.setARGB(PROGRESS_BACKGROUND_ALPHA, progressCircleColor[NUMBER_0],
-        progressCircleColor[NUMBER_1], progressCircleColor[NUMBER_2]);
-    progressCirclePaint.setStrokeWidth(PROGRESS_STROKE_WIDTH * dispalyDensity_);
-    progressCirclePaint.setStyle(SkPaint::kStroke_Style);
-    canvas->drawCircle(half_, half_, dispalyDensity_ * PROGRESS_RADIUS, progressCirclePaint);
-
-    // progress arc
-    SkPaint progressArcPaint;
-    progressArcPaint.setAntiAlias(true);
-    progressArcPaint.setAlphaf(PROGRESS_BAR_BACKGROUND_ALPHA);
-    std::vector<int32_t> progressArcColor = ParseColorString(PROGRESS_COLOR_TYPE);
-    progressArcPaint.setARGB(PROGRESS_BAR_BACKGROUND_ALPHA, progressArcColor[NUMBER_0],
-        progressArcColor[NUMBER_1], progressArcColor[NUMBER_2]);
-    progressArcPaint.setStrokeWidth(PROGRESS_STROKE_WIDTH * dispalyDensity_);
-    progressArcPaint.setStyle(SkPaint::kStroke_Style);
-
-    SkRect arcRect = SkRect::MakeLTRB(half_ - dispalyDensity_ * PROGRESS_RADIUS,
-        half_ - dispalyDensity_ * PROGRESS_RADIUS,
-        half_ + dispalyDensity_ * PROGRESS_RADIUS,
-        half_ + dispalyDensity_ * PROGRESS_RADIUS);
-    canvas->drawArc(arcRect, startAngle_, angle, false, progressArcPaint);
+    canvas->drawCircle(half_, half_, outCircleRadius_, outCirclePaint_);
+    canvas->drawCircle(half_, half_, centerCircleRadius_, centerCirclePaint_);
+    canvas->drawCircle(half_, half_, progressRadius_, progressCirclePaint_);
+    canvas->drawArc(progressArcRect_, startAngle_, angle, false, progressArcPaint_);
 
     canvasNode_->FinishRecording();
     Rosen::RSTransaction::FlushImplicitTransaction();
@@ -233,58 +272,20 @@ void AccessibilityCircleDrawingManager::DrawingProgressByRosenDrawing(int32_t ph
     HILOG_DEBUG();
     auto canvas = canvasNode_->BeginRecording(imageWidth_, imageHeight_);
 
-    // outer circle
-    Rosen::Drawing::Brush outCircleBrush;
-    outCircleBrush.SetAntiAlias(true);
-    outCircleBrush.SetAlphaF(OUT_CIRCLE_BACKGROUND_ALPHA);
-    std::vector<int32_t> outCircleColor = ParseColorString(OUT_CIRCLE_BACKGROUND_COLOR_TYPE);
-    outCircleBrush.SetARGB(OUT_CIRCLE_BACKGROUND_ALPHA, outCircleColor[NUMBER_0], outCircleColor[NUMBER_1],
-        outCircleColor[NUMBER_2]);
-
-    canvas->AttachBrush(outCircleBrush);
-    canvas->DrawCircle(Rosen::Drawing::Point(half_, half_), dispalyDensity_ * OUT_CIRCLE_RADIUS);
+    canvas->AttachBrush(outCircleBrush_);
+    canvas->DrawCircle(Rosen::Drawing::Point(half_, half_), outCircleRadius_);
     canvas->DetachBrush();
 
-    // center circle
-    Rosen::Drawing::Brush centerCircleBrush;
-    centerCircleBrush.SetAntiAlias(true);
-    centerCircleBrush.SetAlphaF(CENTER_CIRCLE_BACKGROUND_ALPHA);
-    std::vector<int32_t> centerCircleColor = ParseColorString(PROGRESS_COLOR_TYPE);
-    centerCircleBrush.SetARGB(CENTER_CIRCLE_BACKGROUND_ALPHA, centerCircleColor[NUMBER_0],
-        centerCircleColor[NUMBER_1], centerCircleColor[NUMBER_2]);
-
-    canvas->AttachBrush(centerCircleBrush);
-    canvas->DrawCircle(Rosen::Drawing::Point(half_, half_), dispalyDensity_ * CENTER_CIRCLE_RADIUS);
+    canvas->AttachBrush(centerCircleBrush_);
+    canvas->DrawCircle(Rosen::Drawing::Point(half_, half_), centerCircleRadius_);
     canvas->DetachBrush();
 
-    // progress circle
-    Rosen::Drawing::Pen progressPen;
-    progressPen.SetAntiAlias(true);
-    progressPen.SetAlphaF(PROGRESS_BACKGROUND_ALPHA);
-    std::vector<int32_t> progressCircleColor = ParseColorString(PROGRESS_BACKGROUND_COLOR_TYPE);
-    progressPen.SetARGB(PROGRESS_BACKGROUND_ALPHA, progressCircleColor[NUMBER_0],
-        progressCircleColor[NUMBER_1], progressCircleColor[NUMBER_2]);
-    progressPen.SetWidth(PROGRESS_STROKE_WIDTH * dispalyDensity_);
-
-    canvas->AttachPen(progressPen);
-    canvas->DrawCircle(Rosen::Drawing::Point(half_, half_), dispalyDensity_ * PROGRESS_RADIUS);
+    canvas->AttachPen(progressPen_);
+    canvas->DrawCircle(Rosen::Drawing::Point(half_, half_), progressRadius_);
     canvas->DetachPen();
 
-    // progress arc
-    Rosen::Drawing::Pen progressArcPen;
-    progressArcPen.SetAntiAlias(true);
-    progressArcPen.SetAlphaF(PROGRESS_BAR_BACKGROUND_ALPHA);
-    std::vector<int32_t> progressArcColor = ParseColorString(PROGRESS_COLOR_TYPE);
-    progressArcPen.SetARGB(PROGRESS_BAR_BACKGROUND_ALPHA, progressArcColor[NUMBER_0],
-        progressArcColor[NUMBER_1], progressArcColor[NUMBER_2]);
-    progressArcPen.SetWidth(PROGRESS_STROKE_WIDTH * dispalyDensity_);
-
-    Rosen::Drawing::Rect rect(half_ - dispalyDensity_ * PROGRESS_RADIUS,
-        half_ - dispalyDensity_ * PROGRESS_RADIUS,
-        half_ + dispalyDensity_ * PROGRESS_RADIUS,
-        half_ + dispalyDensity_ * PROGRESS_RADIUS);
-    canvas->AttachPen(progressArcPen);
-    canvas->DrawArc(rect, startAngle_, angle);
+    canvas->AttachPen(progressArcPen_);
+    canvas->DrawArc(progressArcRect_, startAngle_, angle);
     canvas->DetachPen();
 
     canvasNode_->FinishRecording();
@@ -304,6 +305,8 @@ void AccessibilityCircleDrawingManager::DrawingProgress(int32_t physicalX, int32
 void AccessibilityCircleDrawingManager::SetPointerLocation(int32_t physicalX, int32_t physicalY, uint64_t screenId)
 {
     HILOG_DEBUG("Pointer window move, x:%{public}d, y:%{public}d", physicalX, physicalY);
+    pointerX_ = physicalX;
+    pointerY_ = physicalY;
     if (surfaceNode_ != nullptr) {
         surfaceNode_->SetBounds(physicalX - half_,
             physicalY - half_,
@@ -333,7 +336,10 @@ void AccessibilityCircleDrawingManager::DrawPointer(int32_t physicalX, int32_t p
     HILOG_DEBUG();
     startAngle_ = startAngle;
     if (surfaceNode_ != nullptr) {
-        SetPointerLocation(physicalX, physicalY, screenId);
+        // the window only moves when the finger moves, most frames just redraw the arc
+        if (physicalX != pointerX_ || physicalY != pointerY_ || screenId != screenId_) {
+            SetPointerLocation(physicalX, physicalY, screenId);
+        }
         DrawingProgress(physicalX, physicalY, angle);
         UpdatePointerVisible(true);
         HILOG_DEBUG("surfaceNode_ is existed");
@@ -34,6 +34,8 @@ ffrt::mutex AccessibilityDatashareHelper::observerMutex_;
 namespace {
 #ifdef OHOS_BUILD_ENABLE_DATA_SHARE
     constexpr int32_t INDEX = 0;
+    constexpr int32_t KEYWORD_INDEX = 0;
+    constexpr int32_t VALUE_INDEX = 1;
     const std::string SETTING_COLUMN_KEYWORD = "KEYWORD";
     const std::string SETTING_COLUMN_VALUE = "VALUE";
 #endif
@@ -64,6 +66,9 @@ AccessibilityDatashareHelper::~AccessibilityDatashareHelper()
 std::string AccessibilityDatashareHelper::GetStringValue(const std::string& key, const std::string& defaultValue)
 {
     std::string resultStr = defaultValue;
+    if (GetBatchValue(key, defaultValue, resultStr)) {
+        return resultStr;
+    }
 #ifdef OHOS_BUILD_ENABLE_DATA_SHARE
     std::string callingIdentity = IPCSkeleton::ResetCallingIdentity();
     std::shared_ptr<DataShare::DataShareResultSet> resultSet = nullptr;
@@ -141,6 +146,7 @@ float AccessibilityDatashareHelper::GetFloatValue(const std::string& key, const
 
 RetError AccessibilityDatashareHelper::PutStringValue(const std::string& key, const std::string& value, bool needNotify)
 {
+    UpdateBatchValue(key, value);
     std::string callingIdentity = IPCSkeleton::ResetCallingIdentity();
     RetError rtn = RET_OK;
 #ifdef OHOS_BUILD_ENABLE_DATA_SHARE
@@ -192,6 +198,140 @@ RetError AccessibilityDatashareHelper::PutFloatValue(const std::string& key, flo
     return PutStringValue(key, std::to_string(value), needNotify);
 }
 
+RetError AccessibilityDatashareHelper::BeginBatchLoad(const std::vector<std::string>& keys)
+{
+    std::lock_guard<ffrt::mutex> lock(batchMutex_);
+    batchKeys_.clear();
+    batchValues_.clear();
+    batchDefaultValues_.clear();
+    RetError rtn = RET_OK;
+#ifdef OHOS_BUILD_ENABLE_DATA_SHARE
+    std::string callingIdentity = IPCSkeleton::ResetCallingIdentity();
+    std::shared_ptr<DataShare::DataShareResultSet> resultSet = nullptr;
+    do {
+        if (dataShareHelper_ == nullptr) {
+            rtn = RET_ERR_NULLPTR;
+            break;
+        }
+        if (keys.empty()) {
+            rtn = RET_ERR_INVALID_PARAM;
+            break;
+        }
+        std::vector<std::string> columns = { SETTING_COLUMN_KEYWORD, SETTING_COLUMN_VALUE };
+        DataShare::DataSharePredicates predicates;
+        predicates.In(SETTING_COLUMN_KEYWORD, keys);
+        // the same uri form as the query of one key, so the batch reads the same table with the same permission
+        Uri uri(AssembleUri(keys.front()));
+        resultSet = dataShareHelper_->Query(uri, predicates, columns);
+        if (resultSet == nullptr) {
+            rtn = RET_ERR_FAILED;
+            break;
+        }
+        int32_t count = 0;
+        resultSet->GetRowCount(count);
+        for (int32_t row = 0; row < count; row++) {
+            std::string key = "";
+            std::string value = "";
+            if (resultSet->GoToRow(row) != DataShare::E_OK ||
+                resultSet->GetString(KEYWORD_INDEX, key) != DataShare::E_OK ||
+                resultSet->GetString(VALUE_INDEX, value) != DataShare::E_OK) {
+                continue;
+            }
+            batchValues_[key] = value;
+        }
+        HILOG_INFO("batch load %{public}zu keys, %{public}d found", keys.size(), count);
+    } while (0);
+    if (resultSet != nullptr) {
+        resultSet->Close();
+        resultSet = nullptr;
+    }
+    IPCSkeleton::SetCallingIdentity(callingIdentity);
+#endif
+    if (rtn != RET_OK) {
+        // fall back to the query of each key
+        batchValues_.clear();
+        return rtn;
+    }
+    batchKeys_.insert(keys.begin(), keys.end());
+    isBatchLoading_ = true;
+    return RET_OK;
+}
+
+size_t AccessibilityDatashareHelper::EndBatchLoad()
+{
+    std::map<std::string, std::string> defaultValues;
+    {
+        std::lock_guard<ffrt::mutex> lock(batchMutex_);
+        isBatchLoading_ = false;
+        batchKeys_.clear();
+        batchValues_.clear();
+        defaultValues.swap(batchDefaultValues_);
+    }
+    if (defaultValues.empty()) {
+        return 0;
+    }
+#ifdef OHOS_BUILD_ENABLE_DATA_SHARE
+    std::string callingIdentity = IPCSkeleton::ResetCallingIdentity();
+    int32_t ret = 0;
+    if (dataShareHelper_ != nullptr) {
+        std::vector<DataShare::DataShareValuesBucket> buckets;
+        for (auto& defaultValue : defaultValues) {
+            DataShare::DataShareValuesBucket bucket;
+            bucket.Put(SETTING_COLUMN_KEYWORD, DataShare::DataShareValueObject(defaultValue.first));
+            bucket.Put(SETTING_COLUMN_VALUE, DataShare::DataShareValueObject(defaultValue.second));
+            buckets.push_back(bucket);
+        }
+        Uri uri(AssembleUri(defaultValues.begin()->first));
+        ret = dataShareHelper_->BatchInsert(uri, buckets);
+        HILOG_INFO("helper batch insert %{public}zu default values ret(%{public}d).", buckets.size(), ret);
+        if (ret > 0) {
+            for (auto& defaultValue : defaultValues) {
+                dataShareHelper_->NotifyChange(AssembleUri(defaultValue.first));
+            }
+        }
+    }
+    IPCSkeleton::SetCallingIdentity(callingIdentity);
+    if (ret <= 0) {
+        HILOG_WARN("batch insert failed, put the default values one by one");
+        for (auto& defaultValue : defaultValues) {
+            if (PutStringValue(defaultValue.first, defaultValue.second) != RET_OK) {
+                HILOG_WARN("put default key failed key = %{public}s", defaultValue.first.c_str());
+            }
+        }
+    }
+#endif
+    return defaultValues.size();
+}
+
+bool AccessibilityDatashareHelper::GetBatchValue(const std::string& key, const std::string& defaultValue,
+    std::string& value)
+{
+    std::lock_guard<ffrt::mutex> lock(batchMutex_);
+    if (!isBatchLoading_ || batchKeys_.find(key) == batchKeys_.end()) {
+        return false;
+    }
+    auto iter = batchValues_.find(key);
+    if (iter != batchValues_.end()) {
+        value = iter->second;
+        return true;
+    }
+    batchValues_[key] = defaultValue;
+    batchDefaultValues_[key] = defaultValue;
+    value = defaultValue;
+    return true;
+}
+
+void AccessibilityDatashareHelper::UpdateBatchValue(const std::string& key, const std::string& value)
+{
+    std::lock_guard<ffrt::mutex> lock(batchMutex_);
+    if (!isBatchLoading_ || batchKeys_.find(key) == batchKeys_.end()) {
+        return;
+    }
+    // the value is written by the caller, so the default one must not be inserted any more
+    batchValues_[key] = value;
+    batchDefaultValues_.erase(key);
+}
+
 void AccessibilityDatashareHelper::Initialize(int32_t systemAbilityId)
 {
     auto systemAbilityManager = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
@@ -35,6 +35,7 @@ namespace {
     const std::string ARG_DUMP_USER = "-u";
     const std::string ARG_DUMP_CLIENT = "-c";
     const std::string ARG_DUMP_ACCESSIBILITY_WINDOW = "-w";
+    const std::string ARG_DUMP_PERFORMANCE = "-p";
 }
 
 int AccessibilityDumper::Dump(int fd, const std::vector<std::u16string>& args) const
@@ -314,6 +315,83 @@ int AccessibilityDumper::DumpAccessibilityUserInfo(std::string& dumpInfo) const
     return 0;
 }
 
+int AccessibilityDumper::DumpAccessibilityPerformanceInfo(std::string& dumpInfo) const
+{
+    HILOG_INFO();
+    std::ostringstream oss;
+
+    // Dump input event queue info
+    sptr<AccessibilityInputInterceptor> inputInterceptor =
+        Singleton<AccessibleAbilityManagerService>::GetInstance().GetInputInterceptor();
+    if (inputInterceptor) {
+        InputEventQueueStats stats = inputInterceptor->GetInputQueueStats();
+        oss << "input event queue:" << std::endl;
+        oss << "    depth:  " << stats.depth << std::endl;
+        oss << "    maxDepth:  " << stats.maxDepth << std::endl;
+        oss << "    enqueued:  " << stats.enqueuedCount << std::endl;
+        oss << "    dropped:  " << stats.droppedCount << std::endl;
+        oss << "    lastWaitTime(us):  " << stats.lastWaitTime << std::endl;
+        oss << "    maxWaitTime(us):  " << stats.maxWaitTime << std::endl;
+        oss << "    averageWaitTime(us):  " << stats.averageWaitTime << std::endl;
+    } else {
+        oss << "input event queue:  not started" << std::endl;
+    }
+
+    // Dump touch injection info
+    sptr<TouchEventInjector> touchEventInjector =
+        Singleton<AccessibleAbilityManagerService>::GetInstance().GetTouchEventInjector();
+    if (touchEventInjector) {
+        InjectionJitterStats jitterStats = touchEventInjector->GetInjectionJitterStats();
+        oss << "touch injection:" << std::endl;
+        oss << "    injected:  " << jitterStats.injectedCount << std::endl;
+        oss << "    lastJitter(us):  " << jitterStats.lastJitter << std::endl;
+        oss << "    maxJitter(us):  " << jitterStats.maxJitter << std::endl;
+        oss << "    averageJitter(us):  " << jitterStats.averageJitter << std::endl;
+    } else {
+        oss << "touch injection:  not started" << std::endl;
+    }
+
+    // Dump pending element operator requests of each window
+    std::map<int32_t, size_t> requestNums;
+    Singleton<AccessibleAbilityManagerService>::GetInstance().GetPendingRequestNums(requestNums);
+    oss << "pending element requests:" << std::endl;
+    for (auto& requestNum : requestNums) {
+        oss << "    windowId " << requestNum.first << ":  " << requestNum.second << std::endl;
+    }
+
+    // Dump event coalescing info
+    EventCoalescingStats coalescingStats;
+    Singleton<AccessibleAbilityManagerService>::GetInstance().GetEventCoalescingStats(coalescingStats);
+    oss << "event coalescing:" << std::endl;
+    oss << "    received:  " << coalescingStats.receivedCount << std::endl;
+    oss << "    merged:  " << coalescingStats.mergedCount << std::endl;
+    oss << "    delivered:  " << coalescingStats.deliveredCount << std::endl;
+    oss << "    passThrough:  " << coalescingStats.passThroughCount << std::endl;
+
+    // Dump settings load info of the current account
+    sptr<AccessibilityAccountData> currentAccount =
+        Singleton<AccessibleAbilityManagerService>::GetInstance().GetCurrentAccountData();
+    std::shared_ptr<AccessibilitySettingsConfig> config = currentAccount ? currentAccount->GetConfig() : nullptr;
+    if (config) {
+        const SettingsLoadStats &loadStats = config->GetSettingsLoadStats();
+        oss << "settings load:" << std::endl;
+        oss << "    loadTime(ms):  " << loadStats.loadTime << std::endl;
+        if (loadStats.isBatchLoaded) {
+            oss << "    keys:  " << loadStats.keyCount << std::endl;
+        }
+        oss << "    defaults:  " << loadStats.defaultCount << std::endl;
+        oss << "    batched:  " << loadStats.isBatchLoaded << std::endl;
+
+        SettingsFlushStats flushStats = config->GetSettingsFlushStats();
+        oss << "settings flush:" << std::endl;
+        oss << "    committed:  " << flushStats.committedCount << std::endl;
+        oss << "    failed:  " << flushStats.failedCount << std::endl;
+    }
+
+    dumpInfo.append(oss.str());
+    return 0;
+}
+
 int AccessibilityDumper::DumpAccessibilityInfo(const std::vector<std::string>& args, std::string& dumpInfo) const
 {
     if (args.empty()) {
@@ -326,6 +404,8 @@ int AccessibilityDumper::DumpAccessibilityInfo(const std::vector<std::string>& a
         dumpType = DumpType::DUMP_CLIENT;
     } else if (args[0] == ARG_DUMP_ACCESSIBILITY_WINDOW) {
         dumpType = DumpType::DUMP_ACCESSIBILITY_WINDOW;
+    } else if (args[0] == ARG_DUMP_PERFORMANCE) {
+        dumpType = DumpType::DUMP_PERFORMANCE;
     }
     int ret = 0;
     switch (dumpType) {
@@ -338,6 +418,9 @@ int AccessibilityDumper::DumpAccessibilityInfo(const std::vector<std::string>& a
         case DumpType::DUMP_ACCESSIBILITY_WINDOW:
             ret = DumpAccessibilityWindowInfo(dumpInfo);
             break;
+        case DumpType::DUMP_PERFORMANCE:
+            ret = DumpAccessibilityPerformanceInfo(dumpInfo);
+            break;
         default:
             ret = -1;
             break;
@@ -360,7 +443,9 @@ void AccessibilityDumper::ShowHelpInfo(std::string& dumpInfo) const
         .append(" -c                    ")
         .append("|dump accessibility client in the system\n")
         .append(" -w                    ")
-        .append("|dump accessibility window info in the system\n");
+        .append("|dump accessibility window info in the system\n")
+        .append(" -p                    ")
+        .append("|dump accessibility performance counters in the system\n");
 }
 } // Accessibility
 } // OHOS
\ No newline at end of file
@@ -18,6 +18,8 @@
 
 namespace OHOS {
 namespace Accessibility {
+std::shared_ptr<MMI::PointerEvent> EventTransmission::dispatchingPointerEvent_ = nullptr;
+
 bool EventTransmission::OnKeyEvent(MMI::KeyEvent &event)
 {
     HILOG_DEBUG();
@@ -73,5 +75,18 @@ void EventTransmission::DestroyEvents()
         next->DestroyEvents();
     }
 }
+
+void EventTransmission::SetDispatchingPointerEvent(const std::shared_ptr<MMI::PointerEvent> &event)
+{
+    dispatchingPointerEvent_ = event;
+}
+
+std::shared_ptr<MMI::PointerEvent> EventTransmission::KeepPointerEvent(MMI::PointerEvent &event)
+{
+    if (dispatchingPointerEvent_ != nullptr && dispatchingPointerEvent_.get() == &event) {
+        return dispatchingPointerEvent_;
+    }
+    return std::make_shared<MMI::PointerEvent>(event);
+}
 } // namespace Accessibility
 } // namespace OHOS
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_gesture_path_segmenter.h"
+#include <cmath>
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr float EPSINON = 0.0001f;
+} // namespace
+
+void AccessibilityGesturePathSegmenter::Reset(const Pointer &start)
+{
+    separations_[0] = start;
+    separationCount_ = 1;
+    lastPoint_ = start;
+    pointCount_ = 1;
+    xUnitVector_ = 0;
+    yUnitVector_ = 0;
+    vectorLength_ = 0;
+    numSinceFirstSep_ = 0;
+    isRejected_ = false;
+}
+
+void AccessibilityGesturePathSegmenter::Clear()
+{
+    separationCount_ = 0;
+    pointCount_ = 0;
+    xUnitVector_ = 0;
+    yUnitVector_ = 0;
+    vectorLength_ = 0;
+    numSinceFirstSep_ = 0;
+    isRejected_ = false;
+}
+
+void AccessibilityGesturePathSegmenter::AddPoint(const Pointer &point)
+{
+    if (pointCount_ == 0) {
+        Reset(point);
+        return;
+    }
+    pointCount_++;
+    lastPoint_ = point;
+    if (isRejected_) {
+        return;
+    }
+
+    if (numSinceFirstSep_ > 0) {
+        const Pointer &firstSeparation = separations_[separationCount_ - 1];
+        float xVector = xUnitVector_ / numSinceFirstSep_;
+        float yVector = yUnitVector_ / numSinceFirstSep_;
+        Pointer newSeparation;
+        newSeparation.px_ = vectorLength_ * xVector + firstSeparation.px_;
+        newSeparation.py_ = vectorLength_ * yVector + firstSeparation.py_;
+
+        float xNextUnitVector = point.px_ - newSeparation.px_;
+        float yNextUnitVector = point.py_ - newSeparation.py_;
+        float nextVectorLength = hypot(xNextUnitVector, yNextUnitVector);
+        if (nextVectorLength > EPSINON) {
+            xNextUnitVector /= nextVectorLength;
+            yNextUnitVector /= nextVectorLength;
+        }
+
+        if ((xVector * xNextUnitVector + yVector * yNextUnitVector) < DEGREES_THRESHOLD) {
+            if (separationCount_ == MAX_SEPARATION_NUM) {
+                // A third segment starts, the rest of the route can not change the result.
+                isRejected_ = true;
+                return;
+            }
+            separations_[separationCount_++] = newSeparation;
+            xUnitVector_ = 0;
+            yUnitVector_ = 0;
+            numSinceFirstSep_ = 0;
+        }
+    }
+
+    const Pointer &firstSeparation = separations_[separationCount_ - 1];
+    float xVector = point.px_ - firstSeparation.px_;
+    float yVector = point.py_ - firstSeparation.py_;
+    vectorLength_ = hypot(xVector, yVector);
+    numSinceFirstSep_ += 1;
+    if (vectorLength_ > EPSINON) {
+        xUnitVector_ += xVector / vectorLength_;
+        yUnitVector_ += yVector / vectorLength_;
+    }
+}
+} // namespace Accessibility
+} // namespace OHOS
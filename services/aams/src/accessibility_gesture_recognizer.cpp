@@ -25,6 +25,7 @@ namespace {
     constexpr int32_t POINTER_COUNT_1 = 1;
     constexpr float EPSINON = 0.0001f;
     constexpr float TOUCH_SLOP = 8.0f;
+    const std::string GESTURE_TEMPLATE_CONFIG_PATH = "/system/etc/accessibility/accessibility_gesture_templates.json";
 } // namespace
 
 GestureHandler::GestureHandler(const std::shared_ptr<AppExecFwk::EventRunner> &runner,
@@ -88,7 +89,9 @@ AccessibilityGestureRecognizer::AccessibilityGestureRecognizer()
     doubleTapScaledSlop_ = slop * slop;
 #endif
 
-    runner_ = Singleton<AccessibleAbilityManagerService>::GetInstance().GetMainRunner();
+    templateMatcher_.LoadTemplates(GESTURE_TEMPLATE_CONFIG_PATH);
+
+    runner_ = Singleton<AccessibleAbilityManagerService>::GetInstance().GetInputRunner();
     if (!runner_) {
         HILOG_ERROR("get runner failed");
         return;
@@ -130,7 +133,7 @@ bool AccessibilityGestureRecognizer::OnPointerEvent(MMI::PointerEvent &event)
                 Clear();
                 isRecognizingGesture_ = false;
                 isGestureStarted_ = false;
-                pointerRoute_.clear();
+                pathSegmenter_.Clear();
             }
             break;
         case MMI::PointerEvent::POINTER_ACTION_MOVE:
@@ -164,7 +167,8 @@ void AccessibilityGestureRecognizer::Clear()
     isDoubleTap_ = false;
     isGestureStarted_ = false;
     isRecognizingGesture_ = false;
-    pointerRoute_.clear();
+    pathSegmenter_.Clear();
+    templateRoute_.Clear();
     continueDown_ = false;
     StandardGestureCanceled();
 }
@@ -183,8 +187,8 @@ void AccessibilityGestureRecognizer::HandleTouchDownEvent(MMI::PointerEvent &eve
     isDoubleTap_ = false;
     isRecognizingGesture_ = true;
     isGestureStarted_ = false;
-    pointerRoute_.clear();
-    pointerRoute_.push_back(mp);
+    pathSegmenter_.Reset(mp);
+    templateRoute_.Reset(mp);
     prePointer_ = pointerIterm;
     startPointer_ = pointerIterm;
     startTime_ = event.GetActionTime();
@@ -198,7 +202,29 @@ void AccessibilityGestureRecognizer::AddSwipePosition(MMI::PointerEvent::Pointer
     prePointer_ = pointerIterm;
     mp.px_ = pointerIterm.GetDisplayX();
     mp.py_ = pointerIterm.GetDisplayY();
-    pointerRoute_.push_back(mp);
+    pathSegmenter_.AddPoint(mp);
+}
+
+void AccessibilityGestureRecognizer::AddTemplatePosition(MMI::PointerEvent::PointerItem &pointerIterm)
+{
+    if (templateMatcher_.IsEmpty()) {
+        return;
+    }
+    Pointer mp;
+    mp.px_ = static_cast<float>(pointerIterm.GetDisplayX());
+    mp.py_ = static_cast<float>(pointerIterm.GetDisplayY());
+    templateRoute_.AddPoint(mp);
+}
+
+bool AccessibilityGestureRecognizer::RejectDirectionGesture(MMI::PointerEvent &event)
+{
+    HILOG_DEBUG("The route turns more often than any gesture, cancel it before the finger lifts.");
+
+    isRecognizingGesture_ = false;
+    isGestureStarted_ = false;
+    pathSegmenter_.Clear();
+    templateRoute_.Clear();
+    return listener_->OnCancelled(event);
 }
 
 bool AccessibilityGestureRecognizer::HandleTouchMoveEvent(MMI::PointerEvent &event)
@@ -237,13 +263,18 @@ bool AccessibilityGestureRecognizer::HandleTouchMoveEvent(MMI::PointerEvent &eve
             if (durationTime > thresholdTime) {
                 isRecognizingGesture_ = false;
                 isGestureStarted_ = false;
-                pointerRoute_.clear();
+                pathSegmenter_.Clear();
+                templateRoute_.Clear();
                 return listener_->OnCancelled(event);
             }
         }
+        AddTemplatePosition(pointerIterm);
         if ((abs(pointerIterm.GetDisplayX() - prePointer_.GetDisplayX())) >= xMinPixels_ ||
             (abs(pointerIterm.GetDisplayY() - prePointer_.GetDisplayY())) >= yMinPixels_) {
             AddSwipePosition(pointerIterm);
+            if (isGestureStarted_ && pathSegmenter_.IsRejected() && templateMatcher_.IsEmpty()) {
+                return RejectDirectionGesture(event);
+            }
         }
     }
     if (!isRecognizingGesture_) {
@@ -278,8 +309,9 @@ bool AccessibilityGestureRecognizer::HandleTouchUpEvent(MMI::PointerEvent &event
             HILOG_DEBUG("Add position to pointer route.");
             mp.px_ = pointerIterm.GetDisplayX();
             mp.py_ = pointerIterm.GetDisplayY();
-            pointerRoute_.push_back(mp);
+            pathSegmenter_.AddPoint(mp);
         }
+        AddTemplatePosition(pointerIterm);
         return recognizeDirectionGesture(event);
     }
     if (!isRecognizingGesture_) {
@@ -372,23 +404,38 @@ bool AccessibilityGestureRecognizer::recognizeDirectionGesture(MMI::PointerEvent
         return false;
     }
 
-    if (pointerRoute_.size() < LIMIT_SIZE_TWO) {
+    if (pathSegmenter_.GetPointCount() < LIMIT_SIZE_TWO) {
         return listener_->OnCancelled(event);
     }
+    if (pathSegmenter_.IsRejected()) {
+        return RecognizeTemplateGesture(event);
+    }
 
-    // Check the angle of the most recent motion vector versus the preceding motion vector,
-    // segment the line if the angle is about 90 degrees.
-    std::vector<Pointer> pointerPath = GetPointerPath(pointerRoute_);
-
-    if (pointerPath.size() == LIMIT_SIZE_TWO) {
-        int32_t swipeDirection = GetSwipeDirection(pointerPath[0], pointerPath[1]);
+    // The route has been segmented while the finger moved, only the path is left to classify.
+    size_t pathSize = pathSegmenter_.GetPathSize();
+    if (pathSize == LIMIT_SIZE_TWO) {
+        int32_t swipeDirection = GetSwipeDirection(pathSegmenter_.GetPathPoint(0), pathSegmenter_.GetPathPoint(1));
         return listener_->OnCompleted(GESTURE_DIRECTION[swipeDirection]);
-    } else if (pointerPath.size() == LIMIT_SIZE_THREE) {
-        int32_t swipeDirectionH = GetSwipeDirection(pointerPath[0], pointerPath[1]);
-        int32_t swipeDirectionHV = GetSwipeDirection(pointerPath[1], pointerPath[2]);
+    } else if (pathSize == LIMIT_SIZE_THREE) {
+        int32_t swipeDirectionH = GetSwipeDirection(pathSegmenter_.GetPathPoint(0), pathSegmenter_.GetPathPoint(1));
+        int32_t swipeDirectionHV = GetSwipeDirection(pathSegmenter_.GetPathPoint(1),
+            pathSegmenter_.GetPathPoint(2));
         return listener_->OnCompleted(GESTURE_DIRECTION_TO_ID[swipeDirectionH][swipeDirectionHV]);
     }
-    return listener_->OnCancelled(event);
+    return RecognizeTemplateGesture(event);
+}
+
+bool AccessibilityGestureRecognizer::RecognizeTemplateGesture(MMI::PointerEvent &event)
+{
+    HILOG_DEBUG();
+
+    GestureMatchResult result = templateMatcher_.Match(templateRoute_.GetPoints(), templateRoute_.GetPointCount());
+    if (result.gestureId == GestureType::GESTURE_INVALID) {
+        return listener_->OnCancelled(event);
+    }
+    HILOG_DEBUG("gesture template matched, gestureId[%{public}d], compared[%{public}zu]",
+        static_cast<int32_t>(result.gestureId), result.comparedCount);
+    return listener_->OnCompleted(result.gestureId);
 }
 
 int32_t AccessibilityGestureRecognizer::GetSwipeDirection(Pointer firstP, Pointer secondP)
@@ -402,59 +449,6 @@ int32_t AccessibilityGestureRecognizer::GetSwipeDirection(Pointer firstP, Pointe
     }
 }
 
-std::vector<Pointer> AccessibilityGestureRecognizer::GetPointerPath(std::vector<Pointer> &route)
-{
-    HILOG_DEBUG();
-
-    std::vector<Pointer> pointerPath;
-    Pointer firstSeparation = route[0];
-    Pointer nextPoint;
-    Pointer newSeparation;
-    float xUnitVector = 0;
-    float yUnitVector = 0;
-    float xVector = 0;
-    float yVector = 0;
-    float vectorLength = 0;
-    int32_t numSinceFirstSep = 0;
-
-    pointerPath.push_back(firstSeparation);
-    for (size_t i = 1; i < route.size(); i++) {
-        nextPoint = route[i];
-        if (numSinceFirstSep > 0) {
-            xVector = xUnitVector / numSinceFirstSep;
-            yVector = yUnitVector / numSinceFirstSep;
-            newSeparation.px_ = vectorLength * xVector + firstSeparation.px_;
-            newSeparation.py_ = vectorLength * yVector + firstSeparation.py_;
-
-            float xNextUnitVector = nextPoint.px_ - newSeparation.px_;
-            float yNextUnitVector = nextPoint.py_ - newSeparation.py_;
-            float nextVectorLength = hypot(xNextUnitVector, yNextUnitVector);
-            if (nextVectorLength > EPSINON) {
-                xNextUnitVector /= nextVectorLength;
-                yNextUnitVector /= nextVectorLength;
-            }
-
-            if ((xVector * xNextUnitVector + yVector * yNextUnitVector) < DEGREES_THRESHOLD) {
-                pointerPath.push_back(newSeparation);
-                firstSeparation = newSeparation;
-                xUnitVector = 0;
-                yUnitVector = 0;
-                numSinceFirstSep = 0;
-            }
-        }
-        xVector = nextPoint.px_ - firstSeparation.px_;
-        yVector = nextPoint.py_ - firstSeparation.py_;
-        vectorLength = hypot(xVector, yVector);
-        numSinceFirstSep += 1;
-        if (vectorLength > EPSINON) {
-            xUnitVector += xVector / vectorLength;
-            yUnitVector += yVector / vectorLength;
-        }
-    }
-    pointerPath.push_back(nextPoint);
-    return pointerPath;
-}
-
 bool AccessibilityGestureRecognizer::isDoubleTap(MMI::PointerEvent &event)
 {
     HILOG_DEBUG();
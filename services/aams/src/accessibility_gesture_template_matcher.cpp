@@ -0,0 +1,305 @@
+/*
+ * Copyright (C) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_gesture_template_matcher.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+#include "hilog_wrapper.h"
+#include "nlohmann/json.hpp"
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr float EPSINON = 0.0001f;
+    // Lanes of the distance sum, the loop over one block has no dependency between lanes.
+    constexpr size_t DISTANCE_BLOCK_SIZE = 8;
+    constexpr float ASPECT_TOLERANCE = 0.15f;
+    constexpr float STRAIGHTNESS_TOLERANCE = 0.25f;
+    constexpr float MATCH_THRESHOLD = 0.2f;
+    constexpr size_t TEMPLATE_POINT_DIMENSION = 2;
+    const std::string JSON_KEY_TEMPLATES = "templates";
+    const std::string JSON_KEY_NAME = "name";
+    const std::string JSON_KEY_GESTURE_ID = "gestureId";
+    const std::string JSON_KEY_POINTS = "points";
+
+    static_assert(TEMPLATE_POINT_NUM % DISTANCE_BLOCK_SIZE == 0, "the shape must fill whole blocks");
+
+    bool IsValidGestureId(int64_t gestureId)
+    {
+        return gestureId > static_cast<int64_t>(GestureType::GESTURE_INVALID) &&
+            gestureId <= static_cast<int64_t>(GestureType::GESTURE_FOUR_FINGER_SWIPE_RIGHT);
+    }
+
+    bool ParsePoints(const nlohmann::json &json, std::vector<Pointer> &points)
+    {
+        if (!json.is_array()) {
+            return false;
+        }
+        for (auto &item : json) {
+            if (!item.is_array() || item.size() != TEMPLATE_POINT_DIMENSION || !item[0].is_number() ||
+                !item[1].is_number()) {
+                return false;
+            }
+            Pointer point;
+            point.px_ = item[0].get<float>();
+            point.py_ = item[1].get<float>();
+            points.push_back(point);
+        }
+        return true;
+    }
+
+    bool CompareAspect(const GestureTemplate &shape, float aspect)
+    {
+        return shape.aspect < aspect;
+    }
+} // namespace
+
+void GestureRoute::Reset(const Pointer &start)
+{
+    points_[0] = start;
+    committedCount_ = 1;
+    hasProvisional_ = false;
+    stride_ = 1;
+    sinceCommit_ = 0;
+}
+
+void GestureRoute::Clear()
+{
+    committedCount_ = 0;
+    hasProvisional_ = false;
+    stride_ = 1;
+    sinceCommit_ = 0;
+}
+
+void GestureRoute::AddPoint(const Pointer &point)
+{
+    if (committedCount_ == 0) {
+        Reset(point);
+        return;
+    }
+    if (committedCount_ == MAX_POINT_NUM) {
+        Decimate();
+    }
+    points_[committedCount_] = point;
+    sinceCommit_++;
+    if (sinceCommit_ >= stride_) {
+        committedCount_++;
+        hasProvisional_ = false;
+        sinceCommit_ = 0;
+    } else {
+        hasProvisional_ = true;
+    }
+}
+
+void GestureRoute::Decimate()
+{
+    for (size_t i = 1; i < MAX_POINT_NUM / 2; i++) {
+        points_[i] = points_[i * 2];
+    }
+    committedCount_ = MAX_POINT_NUM / 2;
+    stride_ *= 2;
+}
+
+bool AccessibilityGestureTemplateMatcher::LoadTemplates(const std::string &path)
+{
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        HILOG_DEBUG("no gesture templates at %{public}s", path.c_str());
+        return false;
+    }
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return ParseTemplates(content);
+}
+
+bool AccessibilityGestureTemplateMatcher::ParseTemplates(const std::string &content)
+{
+    Clear();
+    if (!nlohmann::json::accept(content)) {
+        HILOG_ERROR("gesture templates are not json format.");
+        return false;
+    }
+    nlohmann::json root = nlohmann::json::parse(content);
+    if (!root.is_object() || root.find(JSON_KEY_TEMPLATES) == root.end() || !root.at(JSON_KEY_TEMPLATES).is_array()) {
+        HILOG_ERROR("gesture templates have no template array.");
+        return false;
+    }
+
+    for (auto &item : root.at(JSON_KEY_TEMPLATES)) {
+        if (!item.is_object() || item.find(JSON_KEY_NAME) == item.end() || !item.at(JSON_KEY_NAME).is_string() ||
+            item.find(JSON_KEY_GESTURE_ID) == item.end() || !item.at(JSON_KEY_GESTURE_ID).is_number_integer() ||
+            item.find(JSON_KEY_POINTS) == item.end()) {
+            HILOG_WARN("skip a gesture template without name, gestureId or points.");
+            continue;
+        }
+        std::string name = item.at(JSON_KEY_NAME).get<std::string>();
+        int64_t gestureId = item.at(JSON_KEY_GESTURE_ID).get<int64_t>();
+        std::vector<Pointer> points;
+        if (!IsValidGestureId(gestureId) || !ParsePoints(item.at(JSON_KEY_POINTS), points) ||
+            !AddTemplate(name, static_cast<GestureType>(gestureId), points.data(), points.size())) {
+            HILOG_WARN("skip the invalid gesture template %{public}s.", name.c_str());
+        }
+    }
+    HILOG_INFO("%{public}zu gesture templates are loaded.", templates_.size());
+    return true;
+}
+
+bool AccessibilityGestureTemplateMatcher::AddTemplate(const std::string &name, GestureType gestureId,
+    const Pointer *points, size_t count)
+{
+    GestureTemplate shape;
+    if (!NormalizeShape(points, count, shape)) {
+        return false;
+    }
+    shape.name = name;
+    shape.gestureId = gestureId;
+    auto iter = std::upper_bound(templates_.begin(), templates_.end(), shape.aspect,
+        [](float aspect, const GestureTemplate &other) { return aspect < other.aspect; });
+    templates_.insert(iter, shape);
+    return true;
+}
+
+void AccessibilityGestureTemplateMatcher::Clear()
+{
+    templates_.clear();
+}
+
+GestureMatchResult AccessibilityGestureTemplateMatcher::Match(const Pointer *points, size_t count) const
+{
+    GestureMatchResult result;
+    GestureTemplate candidate;
+    if (templates_.empty() || !NormalizeShape(points, count, candidate)) {
+        return result;
+    }
+
+    // Shapes with a different bounding box or a different amount of turning can not be close,
+    // only the templates left after these cheap checks are compared point by point.
+    float best = MATCH_THRESHOLD;
+    auto iter = std::lower_bound(templates_.begin(), templates_.end(), candidate.aspect - ASPECT_TOLERANCE,
+        CompareAspect);
+    for (; iter != templates_.end() && iter->aspect <= candidate.aspect + ASPECT_TOLERANCE; ++iter) {
+        if (std::fabs(iter->straightness - candidate.straightness) > STRAIGHTNESS_TOLERANCE) {
+            continue;
+        }
+        result.comparedCount++;
+        float distance = GetDistance(*iter, candidate, best);
+        if (distance < best) {
+            best = distance;
+            result.gestureId = iter->gestureId;
+            result.score = distance;
+        }
+    }
+    return result;
+}
+
+bool AccessibilityGestureTemplateMatcher::NormalizeShape(const Pointer *points, size_t count, GestureTemplate &shape)
+{
+    if (points == nullptr || count < 2) {
+        return false;
+    }
+    float length = 0;
+    for (size_t i = 1; i < count; i++) {
+        length += hypot(points[i].px_ - points[i - 1].px_, points[i].py_ - points[i - 1].py_);
+    }
+    if (length < EPSINON) {
+        return false;
+    }
+
+    // Walk the route and drop a point every interval of its length.
+    float interval = length / (TEMPLATE_POINT_NUM - 1);
+    float accumulated = 0;
+    size_t resampled = 1;
+    Pointer previous = points[0];
+    shape.xs[0] = previous.px_;
+    shape.ys[0] = previous.py_;
+    for (size_t i = 1; i < count && resampled < TEMPLATE_POINT_NUM - 1; i++) {
+        float segment = hypot(points[i].px_ - previous.px_, points[i].py_ - previous.py_);
+        while (segment > EPSINON && accumulated + segment >= interval && resampled < TEMPLATE_POINT_NUM - 1) {
+            float ratio = (interval - accumulated) / segment;
+            previous.px_ += ratio * (points[i].px_ - previous.px_);
+            previous.py_ += ratio * (points[i].py_ - previous.py_);
+            shape.xs[resampled] = previous.px_;
+            shape.ys[resampled] = previous.py_;
+            resampled++;
+            accumulated = 0;
+            segment = hypot(points[i].px_ - previous.px_, points[i].py_ - previous.py_);
+        }
+        accumulated += segment;
+        previous = points[i];
+    }
+    for (; resampled < TEMPLATE_POINT_NUM; resampled++) {
+        shape.xs[resampled] = points[count - 1].px_;
+        shape.ys[resampled] = points[count - 1].py_;
+    }
+
+    float minX = shape.xs[0];
+    float maxX = shape.xs[0];
+    float minY = shape.ys[0];
+    float maxY = shape.ys[0];
+    float centerX = 0;
+    float centerY = 0;
+    for (size_t i = 0; i < TEMPLATE_POINT_NUM; i++) {
+        minX = std::min(minX, shape.xs[i]);
+        maxX = std::max(maxX, shape.xs[i]);
+        minY = std::min(minY, shape.ys[i]);
+        maxY = std::max(maxY, shape.ys[i]);
+        centerX += shape.xs[i];
+        centerY += shape.ys[i];
+    }
+    float width = maxX - minX;
+    float height = maxY - minY;
+    float side = std::max(width, height);
+    if (side < EPSINON) {
+        return false;
+    }
+    centerX /= TEMPLATE_POINT_NUM;
+    centerY /= TEMPLATE_POINT_NUM;
+    for (size_t i = 0; i < TEMPLATE_POINT_NUM; i++) {
+        shape.xs[i] = (shape.xs[i] - centerX) / side;
+        shape.ys[i] = (shape.ys[i] - centerY) / side;
+    }
+    shape.aspect = width / (width + height);
+    shape.straightness = hypot(points[count - 1].px_ - points[0].px_, points[count - 1].py_ - points[0].py_) / length;
+    return true;
+}
+
+float AccessibilityGestureTemplateMatcher::GetDistance(const GestureTemplate &first, const GestureTemplate &second,
+    float limit)
+{
+    float limitSum = limit * limit * TEMPLATE_POINT_NUM;
+    float lanes[DISTANCE_BLOCK_SIZE] = {};
+    for (size_t block = 0; block < TEMPLATE_POINT_NUM; block += DISTANCE_BLOCK_SIZE) {
+        for (size_t lane = 0; lane < DISTANCE_BLOCK_SIZE; lane++) {
+            float dx = first.xs[block + lane] - second.xs[block + lane];
+            float dy = first.ys[block + lane] - second.ys[block + lane];
+            lanes[lane] += dx * dx + dy * dy;
+        }
+        float sum = 0;
+        for (size_t lane = 0; lane < DISTANCE_BLOCK_SIZE; lane++) {
+            sum += lanes[lane];
+        }
+        if (sum >= limitSum) {
+            return limit;
+        }
+    }
+    float sum = 0;
+    for (size_t lane = 0; lane < DISTANCE_BLOCK_SIZE; lane++) {
+        sum += lanes[lane];
+    }
+    return std::sqrt(sum / TEMPLATE_POINT_NUM);
+}
+} // namespace Accessibility
+} // namespace OHOS
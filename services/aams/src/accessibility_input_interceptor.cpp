@@ -14,6 +14,10 @@
  */
 
 #include "accessibility_input_interceptor.h"
+
+#include <chrono>
+#include <thread>
+
 #include "accessibility_keyevent_filter.h"
 #include "accessibility_mouse_autoclick.h"
 #include "accessibility_short_key.h"
@@ -28,6 +32,16 @@
 
 namespace OHOS {
 namespace Accessibility {
+namespace {
+    constexpr uint32_t TIME_OUT_OPERATOR = 5000;
+
+    int64_t GetSteadyTimeUs()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+} // namespace
+
 sptr<AccessibilityInputInterceptor> AccessibilityInputInterceptor::instance_ = nullptr;
 sptr<AccessibilityInputInterceptor> AccessibilityInputInterceptor::GetInstance()
 {
@@ -49,7 +63,7 @@ AccessibilityInputInterceptor::AccessibilityInputInterceptor()
 
     inputManager_ = MMI::InputManager::GetInstance();
     eventHandler_ = std::make_shared<AppExecFwk::EventHandler>(
-        Singleton<AccessibleAbilityManagerService>::GetInstance().GetMainRunner());
+        Singleton<AccessibleAbilityManagerService>::GetInstance().GetInputRunner());
 }
 
 AccessibilityInputInterceptor::~AccessibilityInputInterceptor()
@@ -109,6 +123,34 @@ void AccessibilityInputInterceptor::SetAvailableFunctions(uint32_t availableFunc
     if (availableFunctions_ == availableFunctions && ((availableFunctions & FEATURE_SCREEN_TOUCH) == 0)) {
         return;
     }
+
+    // The transmitters are only touched on the input runner, rebuild them there.
+    if (!eventHandler_ || eventHandler_->GetEventRunner() == AppExecFwk::EventRunner::Current()) {
+        UpdateAvailableFunctions(availableFunctions);
+        return;
+    }
+
+    std::shared_ptr<ffrt::promise<void>> syncPromise = std::make_shared<ffrt::promise<void>>();
+    ffrt::future syncFuture = syncPromise->get_future();
+    bool posted = eventHandler_->PostTask([this, syncPromise, availableFunctions]() {
+        UpdateAvailableFunctions(availableFunctions);
+        syncPromise->set_value();
+        }, "SetAvailableFunctions", 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+    if (!posted) {
+        HILOG_ERROR("post SetAvailableFunctions task failed.");
+        UpdateAvailableFunctions(availableFunctions);
+        return;
+    }
+    ffrt::future_status wait = syncFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
+    if (wait != ffrt::future_status::ready) {
+        HILOG_ERROR("Failed to wait SetAvailableFunctions result");
+    }
+}
+
+void AccessibilityInputInterceptor::UpdateAvailableFunctions(uint32_t availableFunctions)
+{
+    HILOG_DEBUG("function[%{public}u].", availableFunctions);
+
     availableFunctions_ = availableFunctions;
     DestroyTransmitters();
     CreateTransmitters();
@@ -117,7 +159,7 @@ void AccessibilityInputInterceptor::SetAvailableFunctions(uint32_t availableFunc
 
 void AccessibilityInputInterceptor::CreateTransmitters()
 {
-    HILOG_DEBUG("function[%{public}u].", availableFunctions_);
+    HILOG_DEBUG("function[%{public}u].", availableFunctions_.load());
 
     if (!availableFunctions_) {
         return;
@@ -338,18 +380,167 @@ void AccessibilityInputInterceptor::SetNextEventTransmitter(sptr<EventTransmissi
     current = next;
 }
 
+void AccessibilityInputInterceptor::DispatchInputEvent(AccessibilityInputEventQueue::Item &item)
+{
+    bool isMoveEvent = item.pointerEvent &&
+        item.pointerEvent->GetPointerAction() == MMI::PointerEvent::POINTER_ACTION_MOVE;
+    item.enqueueTime = GetSteadyTimeUs();
+    while (!inputEventQueue_.Push(item)) {
+        if (isMoveEvent) {
+            // A later move supersedes this one, so it is safe to drop under pressure.
+            inputEventQueue_.RecordDropped();
+            HILOG_WARN("input event queue is full, drop move event.");
+            return;
+        }
+        std::this_thread::yield();
+    }
+
+    if (drainScheduled_.exchange(true)) {
+        return;
+    }
+
+    if (!eventHandler_) {
+        HILOG_ERROR("eventHandler_ is null.");
+        drainScheduled_.store(false);
+        return;
+    }
+    sptr<AccessibilityInputInterceptor> interceptor = this;
+    eventHandler_->PostTask([interceptor] { interceptor->DrainInputEvents(); }, "InputEventDrain", 0,
+        AppExecFwk::EventQueue::Priority::IMMEDIATE);
+}
+
+void AccessibilityInputInterceptor::DrainInputEvents()
+{
+    AccessibilityInputEventQueue::Item item;
+    do {
+        while (inputEventQueue_.Pop(item)) {
+            inputEventQueue_.RecordWaitTime(GetSteadyTimeUs() - item.enqueueTime);
+            if (item.keyEvent) {
+                ProcessKeyEvent(item.keyEvent);
+            } else if (item.pointerEvent) {
+                SetDispatchingPointerEvent(item.pointerEvent);
+                ProcessPointerEvent(item.pointerEvent);
+                SetDispatchingPointerEvent(nullptr);
+            }
+            item = {};
+        }
+        drainScheduled_.store(false);
+        // A producer may have pushed after the last pop but before the flag was cleared.
+    } while (!inputEventQueue_.IsEmpty() && !drainScheduled_.exchange(true));
+}
+
+InputEventQueueStats AccessibilityInputInterceptor::GetInputQueueStats() const
+{
+    return inputEventQueue_.GetStats();
+}
+
+AccessibilityInputEventQueue::AccessibilityInputEventQueue()
+{
+    for (uint32_t i = 0; i < QUEUE_CAPACITY; i++) {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool AccessibilityInputEventQueue::Push(Item &item)
+{
+    uint64_t pos = enqueuePos_.load(std::memory_order_relaxed);
+    Cell *cell = nullptr;
+    for (;;) {
+        cell = &cells_[pos & (QUEUE_CAPACITY - 1)];
+        uint64_t sequence = cell->sequence.load(std::memory_order_acquire);
+        int64_t diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(pos);
+        if (diff == 0) {
+            if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = enqueuePos_.load(std::memory_order_relaxed);
+        }
+    }
+    cell->item = std::move(item);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+
+    uint32_t depth = static_cast<uint32_t>(pos + 1 - dequeuePos_.load(std::memory_order_relaxed));
+    uint32_t maxDepth = maxDepth_.load(std::memory_order_relaxed);
+    while (depth > maxDepth && !maxDepth_.compare_exchange_weak(maxDepth, depth, std::memory_order_relaxed)) {
+    }
+    return true;
+}
+
+bool AccessibilityInputEventQueue::Pop(Item &item)
+{
+    uint64_t pos = dequeuePos_.load(std::memory_order_relaxed);
+    Cell *cell = nullptr;
+    for (;;) {
+        cell = &cells_[pos & (QUEUE_CAPACITY - 1)];
+        uint64_t sequence = cell->sequence.load(std::memory_order_acquire);
+        int64_t diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(pos + 1);
+        if (diff == 0) {
+            if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = dequeuePos_.load(std::memory_order_relaxed);
+        }
+    }
+    item = std::move(cell->item);
+    cell->item = {};
+    cell->sequence.store(pos + QUEUE_CAPACITY, std::memory_order_release);
+    return true;
+}
+
+bool AccessibilityInputEventQueue::IsEmpty() const
+{
+    return enqueuePos_.load(std::memory_order_acquire) == dequeuePos_.load(std::memory_order_acquire);
+}
+
+void AccessibilityInputEventQueue::RecordWaitTime(int64_t waitTime)
+{
+    dequeuedCount_.fetch_add(1, std::memory_order_relaxed);
+    lastWaitTime_.store(waitTime, std::memory_order_relaxed);
+    totalWaitTime_.fetch_add(waitTime, std::memory_order_relaxed);
+    int64_t maxWaitTime = maxWaitTime_.load(std::memory_order_relaxed);
+    while (waitTime > maxWaitTime &&
+        !maxWaitTime_.compare_exchange_weak(maxWaitTime, waitTime, std::memory_order_relaxed)) {
+    }
+}
+
+void AccessibilityInputEventQueue::RecordDropped()
+{
+    droppedCount_.fetch_add(1, std::memory_order_relaxed);
+}
+
+InputEventQueueStats AccessibilityInputEventQueue::GetStats() const
+{
+    InputEventQueueStats stats;
+    uint64_t enqueuePos = enqueuePos_.load(std::memory_order_relaxed);
+    uint64_t dequeuePos = dequeuePos_.load(std::memory_order_relaxed);
+    stats.depth = enqueuePos > dequeuePos ? static_cast<uint32_t>(enqueuePos - dequeuePos) : 0;
+    stats.maxDepth = maxDepth_.load(std::memory_order_relaxed);
+    stats.enqueuedCount = enqueuePos;
+    stats.droppedCount = droppedCount_.load(std::memory_order_relaxed);
+    stats.lastWaitTime = lastWaitTime_.load(std::memory_order_relaxed);
+    stats.maxWaitTime = maxWaitTime_.load(std::memory_order_relaxed);
+    uint64_t dequeuedCount = dequeuedCount_.load(std::memory_order_relaxed);
+    if (dequeuedCount > 0) {
+        stats.averageWaitTime = totalWaitTime_.load(std::memory_order_relaxed) /
+            static_cast<int64_t>(dequeuedCount);
+    }
+    return stats;
+}
+
 AccessibilityInputEventConsumer::AccessibilityInputEventConsumer()
 {
     HILOG_DEBUG();
-    eventHandler_ = std::make_shared<AppExecFwk::EventHandler>(
-        Singleton<AccessibleAbilityManagerService>::GetInstance().GetMainRunner());
 }
 
 AccessibilityInputEventConsumer::~AccessibilityInputEventConsumer()
 {
     HILOG_DEBUG();
-
-    eventHandler_ = nullptr;
 }
 
 void AccessibilityInputEventConsumer::OnInputEvent(std::shared_ptr<MMI::KeyEvent> keyEvent) const
@@ -366,13 +557,9 @@ void AccessibilityInputEventConsumer::OnInputEvent(std::shared_ptr<MMI::KeyEvent
         return;
     }
 
-    if (!eventHandler_) {
-        HILOG_ERROR("eventHandler is empty.");
-        return;
-    }
-
-    auto task = [keyEvent, interceptor] {interceptor->ProcessKeyEvent(keyEvent);};
-    eventHandler_->PostTask(task, "InputKeyEvent");
+    AccessibilityInputEventQueue::Item item;
+    item.keyEvent = keyEvent;
+    interceptor->DispatchInputEvent(item);
 }
 
 void AccessibilityInputEventConsumer::OnInputEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent) const
@@ -390,12 +577,9 @@ void AccessibilityInputEventConsumer::OnInputEvent(std::shared_ptr<MMI::PointerE
         return;
     }
 
-    if (!eventHandler_) {
-        HILOG_ERROR("eventHandler is empty.");
-        return;
-    }
-    auto task = [pointerEvent, interceptor] {interceptor->ProcessPointerEvent(pointerEvent);};
-    eventHandler_->PostTask(task, "InputPointerEvent");
+    AccessibilityInputEventQueue::Item item;
+    item.pointerEvent = pointerEvent;
+    interceptor->DispatchInputEvent(item);
 }
 } // namespace Accessibility
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -38,7 +38,7 @@ KeyEventFilter::KeyEventFilter()
 {
     HILOG_DEBUG();
 
-    runner_ = Singleton<AccessibleAbilityManagerService>::GetInstance().GetMainRunner();
+    runner_ = Singleton<AccessibleAbilityManagerService>::GetInstance().GetInputRunner();
     if (!runner_) {
         HILOG_ERROR("get runner failed");
         return;
@@ -119,12 +119,12 @@ void KeyEventFilter::DispatchKeyEvent(MMI::KeyEvent &event)
 
     sptr<AccessibilityAccountData> accountData =
         Singleton<AccessibleAbilityManagerService>::GetInstance().GetCurrentAccountData();
-    std::map<std::string, sptr<AccessibleAbilityConnection>> connectionMaps = accountData->GetConnectedA11yAbilities();
+    std::shared_ptr<const AbilityConnectionMap> connectionMaps = accountData->GetConnectedA11yAbilitiesSnapshot();
 
     std::shared_ptr<ProcessingEvent> processingEvent = nullptr;
     std::shared_ptr<MMI::KeyEvent> copyEvent = nullptr;
     sequenceNum_++;
-    for (auto iter = connectionMaps.begin(); iter != connectionMaps.end(); iter++) {
+    for (auto iter = connectionMaps->begin(); iter != connectionMaps->end(); iter++) {
         if (iter->second->OnKeyPressEvent(event, sequenceNum_)) {
             if (!processingEvent) {
                 processingEvent = std::make_shared<ProcessingEvent>();
@@ -182,7 +182,7 @@ AccessibilityMultiTapGestureRecognizer::AccessibilityMultiTapGestureRecognizer()
     mMinPixelsBetweenSamplesY_ = 1;
 #endif
 
-    runner_ = Singleton<AccessibleAbilityManagerService>::GetInstance().GetMainRunner();
+    runner_ = Singleton<AccessibleAbilityManagerService>::GetInstance().GetInputRunner();
     if (!runner_) {
         HILOG_ERROR("get runner failed");
         return;
@@ -316,11 +316,11 @@ void AccessibilityMultiTapGestureRecognizer::Clear()
     addContinueTapNum_ = 0;
     isMoveGestureRecognizing = 0;
     moveDirection = -1;
-    firstDownPoint_.clear();
-    lastUpPoint_.clear();
-    currentDownPoint_.clear();
-    preGesturePoint_.clear();
-    pointerRoute_.clear();
+    firstDownPoint_.Clear();
+    lastUpPoint_.Clear();
+    currentDownPoint_.Clear();
+    preGesturePoint_.Clear();
+    pointerRoute_.Clear();
     CancelAllPenddingEvent();
 }
 
@@ -345,14 +345,13 @@ void AccessibilityMultiTapGestureRecognizer::CancelGesture(bool isNoDelayFlag)
 
 bool AccessibilityMultiTapGestureRecognizer::ParamCheck(const int32_t fingerNum)
 {
-    if (static_cast<int32_t>(lastUpPoint_.size()) < fingerNum ||
-        static_cast<int32_t>(firstDownPoint_.size()) < fingerNum) {
+    if (lastUpPoint_.GetSize() < fingerNum || firstDownPoint_.GetSize() < fingerNum) {
         HILOG_ERROR("last_up point or first_down point size is less than target fingerNum");
         return false;
     }
 
     for (int pId = 0; pId < fingerNum; pId++) {
-        if (!lastUpPoint_.count(pId) || !lastUpPoint_[pId]) {
+        if (!lastUpPoint_.Contains(pId) || !firstDownPoint_.Contains(pId)) {
             HILOG_ERROR("last_up point or first_down point container has wrong value and pId is: %{public}d", pId);
             return false;
         }
@@ -365,10 +364,10 @@ int64_t AccessibilityMultiTapGestureRecognizer::GetLastFirstPointUpTime(const in
 {
     HILOG_DEBUG();
 
-    int64_t timeRst = lastUpPoint_[0]->GetActionTime();
+    int64_t timeRst = lastUpPoint_.Find(0)->actionTime;
     for (int32_t pId = 1; pId < fingerNum; pId++) {
-        if (lastUpPoint_[pId]->GetActionTime() < timeRst) {
-            timeRst = lastUpPoint_[pId]->GetActionTime();
+        if (lastUpPoint_.Find(pId)->actionTime < timeRst) {
+            timeRst = lastUpPoint_.Find(pId)->actionTime;
         }
     }
     return timeRst;
@@ -376,7 +375,7 @@ int64_t AccessibilityMultiTapGestureRecognizer::GetLastFirstPointUpTime(const in
 
 bool AccessibilityMultiTapGestureRecognizer::IsDoubelTapSlopConditionMatch(const int32_t fingerNum,
     const std::vector<MMI::PointerEvent::PointerItem> &curPoints,
-    const std::vector<MMI::PointerEvent::PointerItem> &prePoints)
+    const std::vector<MultiFingerPoint> &prePoints)
 {
     HILOG_DEBUG("doubleTapOffsetThresh_, %{public}d", doubleTapOffsetThresh_);
 
@@ -387,12 +386,12 @@ bool AccessibilityMultiTapGestureRecognizer::IsDoubelTapSlopConditionMatch(const
         int32_t curX = curPoint.GetDisplayX();
         int32_t curY = curPoint.GetDisplayY();
         for (auto prePoint : prePoints) {
-            int32_t pId = prePoint.GetPointerId();
+            int32_t pId = prePoint.pointerId;
             if (std::find(excludePid.begin(), excludePid.end(), pId) != excludePid.end()) {
                 continue;
             }
-            int32_t preX = prePoint.GetDisplayX();
-            int32_t preY = prePoint.GetDisplayY();
+            int32_t preX = prePoint.displayX;
+            int32_t preY = prePoint.displayY;
             int32_t offsetX = curX - preX;
             int32_t offsetY = curY - preY;
             if (offsetX == 0 && offsetY == 0) {
@@ -420,8 +419,8 @@ bool AccessibilityMultiTapGestureRecognizer::IsDoubelTapSlopConditionMatch(const
 
 bool AccessibilityMultiTapGestureRecognizer::GetPointerItemWithFingerNum(int32_t fingerNum,
     std::vector<MMI::PointerEvent::PointerItem> &curPoints,
-    std::vector<MMI::PointerEvent::PointerItem> &prePoints, MMI::PointerEvent &event,
-    std::map<int32_t, std::shared_ptr<MMI::PointerEvent>> &prePointsEventInfo)
+    std::vector<MultiFingerPoint> &prePoints, MMI::PointerEvent &event,
+    const MultiFingerRecords<MultiFingerPoint> &prePointsInfo)
 {
     HILOG_DEBUG();
 
@@ -431,8 +430,8 @@ bool AccessibilityMultiTapGestureRecognizer::GetPointerItemWithFingerNum(int32_t
             HILOG_ERROR("curPoint GetPointerItem(%{public}d) failed", pIds[pId]);
             return false;
         }
-        if (!prePointsEventInfo[pId]->GetPointerItem(prePointsEventInfo[pId]->GetPointerId(), prePoints[pId])) {
-            HILOG_ERROR("prePoint GetPointerItem(%{public}d) failed", prePointsEventInfo[pId]->GetPointerId());
+        if (!GetBasePoint(prePoints[pId], pId, prePointsInfo)) {
+            HILOG_ERROR("prePoint(%{public}d) is not recorded", pId);
             return false;
         }
     }
@@ -462,7 +461,7 @@ bool AccessibilityMultiTapGestureRecognizer::IsMultiFingerDoubleTap(MMI::Pointer
     }
 
     std::vector<MMI::PointerEvent::PointerItem> curPoints(fingerNum);
-    std::vector<MMI::PointerEvent::PointerItem> prePoints(fingerNum);
+    std::vector<MultiFingerPoint> prePoints(fingerNum);
     if (!GetPointerItemWithFingerNum(fingerNum, curPoints, prePoints, event, firstDownPoint_)) {
         return false;
     }
@@ -494,7 +493,7 @@ void AccessibilityMultiTapGestureRecognizer::HanleFirstTouchDownEvent(MMI::Point
 
     // start touch down, change fingerTouchUpState_ to TOUCH_DOWN_AFTER_ALL_FINGER_TOUCH_UP state
     fingerTouchUpState_ = FingerTouchUpState::TOUCH_DOWN_AFTER_ALL_FINGER_TOUCH_UP;
-    firstDownPoint_[event.GetPointerId()] = std::make_shared<MMI::PointerEvent>(event);
+    RecordPoint(event, firstDownPoint_);
     handler_->SendEvent(WAIT_ANOTHER_FINGER_DOWN_MSG, 0, TAP_INTERVAL_TIMEOUT / US_TO_MS);
     if (event.GetPointerIds().size() == POINTER_COUNT_1) {
         SetMultiFingerGestureState(MultiFingerGestureState::GESTURE_WAIT);
@@ -520,8 +519,7 @@ void AccessibilityMultiTapGestureRecognizer::HandleMultiTapEvent(MMI::PointerEve
     HILOG_DEBUG("fingerNum is %{public}d", fingerNum);
 
     // check is double tap
-    if (static_cast<int32_t>(firstDownPoint_.size()) == fingerNum &&
-        static_cast<int32_t>(lastUpPoint_.size()) == fingerNum &&
+    if (firstDownPoint_.GetSize() == fingerNum && lastUpPoint_.GetSize() == fingerNum &&
         IsMultiFingerDoubleTap(event, fingerNum)) {
         addContinueTapNum_ = addContinueTapNum_ + 1;
         HILOG_DEBUG("two finger Double tap is recognized, addContinueTapNum %{public}d", addContinueTapNum_);
@@ -577,22 +575,29 @@ void AccessibilityMultiTapGestureRecognizer::storeBaseDownPoint()
 {
     HILOG_DEBUG();
 
-    for (auto iter : currentDownPoint_) {
-        Pointer mp;
-        MMI::PointerEvent::PointerItem pointerIterm;
-        std::vector<Pointer> mpVec;
-        int32_t pId = iter.first;
-
-        if (!iter.second->GetPointerItem(pId, pointerIterm)) {
-            HILOG_ERROR("get GetPointerItem(%{public}d) failed", pId);
-            return;
+    for (int32_t pId = 0; pId < MAX_FINGER_NUM; pId++) {
+        const MultiFingerPoint *downPoint = currentDownPoint_.Find(pId);
+        if (downPoint == nullptr || pointerRoute_.Contains(pId)) {
+            continue;
         }
+        AddRoutePoint(pId, downPoint->displayX, downPoint->displayY);
+    }
+}
 
-        mp.px_ = static_cast<float>(pointerIterm.GetDisplayX());
-        mp.py_ = static_cast<float>(pointerIterm.GetDisplayY());
-        mpVec.push_back(mp);
-        pointerRoute_.insert(std::make_pair(pId, mpVec));
+void AccessibilityMultiTapGestureRecognizer::AddRoutePoint(const int32_t pId, const int32_t x, const int32_t y)
+{
+    MultiFingerRoute *route = pointerRoute_.Insert(pId);
+    if (route == nullptr) {
+        HILOG_ERROR("pointer id %{public}d is out of range", pId);
+        return;
     }
+
+    if (route->pointNum > 0 && GetSwipeDirection(x - route->lastX, y - route->lastY) != moveDirection) {
+        route->isSameDirection = false;
+    }
+    route->lastX = x;
+    route->lastY = y;
+    route->pointNum++;
 }
 
 int32_t AccessibilityMultiTapGestureRecognizer::GetSwipeDirection(const int32_t dx, const int32_t dy)
@@ -623,37 +628,59 @@ void AccessibilityMultiTapGestureRecognizer::SaveMoveGesturePointerInfo(MMI::Poi
         CancelGesture(true);
         return;
     }
-    Pointer mp;
-    mp.px_ = static_cast<float>(pointerIterm.GetDisplayX());
-    mp.py_ = static_cast<float>(pointerIterm.GetDisplayY());
-    pointerRoute_[pId].push_back(mp);
+    AddRoutePoint(pId, pointerIterm.GetDisplayX(), pointerIterm.GetDisplayY());
     //update preGesturePoint_
-    preGesturePoint_[pId] = std::make_shared<MMI::PointerEvent>(event);
+    MultiFingerPoint *prePoint = preGesturePoint_.Insert(pId);
+    if (prePoint == nullptr) {
+        return;
+    }
+    prePoint->pointerId = pId;
+    prePoint->displayX = pointerIterm.GetDisplayX();
+    prePoint->displayY = pointerIterm.GetDisplayY();
+    prePoint->actionTime = event.GetActionTime();
 }
 
-bool AccessibilityMultiTapGestureRecognizer::GetBasePointItem(MMI::PointerEvent::PointerItem &basePointerIterm,
-    int32_t pId, std::map<int32_t, std::shared_ptr<MMI::PointerEvent>> &pointInfo)
+bool AccessibilityMultiTapGestureRecognizer::GetBasePoint(MultiFingerPoint &basePoint, int32_t pId,
+    const MultiFingerRecords<MultiFingerPoint> &pointInfo)
 {
     HILOG_DEBUG();
 
-    if (pointInfo.count(pId) == 0 || !pointInfo[pId]) {
+    const MultiFingerPoint *point = pointInfo.Find(pId);
+    if (point == nullptr) {
         return false;
     }
-    if (!pointInfo[pId]->GetPointerItem(pointInfo[pId]->GetPointerId(), basePointerIterm)) {
-        HILOG_ERROR("base down point get GetPointerItem(%{public}d) failed", pId);
+
+    basePoint = *point;
+    return true;
+}
+
+bool AccessibilityMultiTapGestureRecognizer::RecordPoint(MMI::PointerEvent &event,
+    MultiFingerRecords<MultiFingerPoint> &pointInfo)
+{
+    int32_t pId = event.GetPointerId();
+    MMI::PointerEvent::PointerItem pointerIterm;
+    if (!event.GetPointerItem(pId, pointerIterm)) {
+        HILOG_ERROR("get GetPointerItem(%{public}d) failed", pId);
         return false;
     }
 
+    MultiFingerPoint *point = pointInfo.Insert(pId);
+    if (point == nullptr) {
+        HILOG_ERROR("pointer id %{public}d is out of range", pId);
+        return false;
+    }
+    point->pointerId = pId;
+    point->displayX = pointerIterm.GetDisplayX();
+    point->displayY = pointerIterm.GetDisplayY();
+    point->actionTime = event.GetActionTime();
     return true;
 }
 
 void AccessibilityMultiTapGestureRecognizer::HandleMultiFingerMoveEvent(MMI::PointerEvent &event)
 {
-    int32_t pIdSize = static_cast<int32_t>(event.GetPointerIds().size());
-    int32_t downPointSize = static_cast<int32_t>(currentDownPoint_.size());
+    int32_t downPointSize = currentDownPoint_.GetSize();
     int32_t pId = event.GetPointerId();
-    HILOG_DEBUG("pointer num is %{public}d, down pointer size is %{public}d, pointId is %{public}d", pIdSize,
-                downPointSize, pId);
+    HILOG_DEBUG("down pointer size is %{public}d, pointId is %{public}d", downPointSize, pId);
 
     MMI::PointerEvent::PointerItem pointerIterm;
     if (!event.GetPointerItem(pId, pointerIterm)) {
@@ -661,22 +688,22 @@ void AccessibilityMultiTapGestureRecognizer::HandleMultiFingerMoveEvent(MMI::Poi
         return;
     }
 
-    MMI::PointerEvent::PointerItem basePointerIterm;
+    MultiFingerPoint basePoint;
     if (isMoveGestureRecognizing) {
-        if (!GetBasePointItem(basePointerIterm, pId, preGesturePoint_)) {
+        if (!GetBasePoint(basePoint, pId, preGesturePoint_)) {
             return;
         }
     } else {
-        if (!GetBasePointItem(basePointerIterm, pId, currentDownPoint_)) {
+        if (!GetBasePoint(basePoint, pId, currentDownPoint_)) {
             return;
         }
     }
 
-    int32_t offsetX = pointerIterm.GetDisplayX() - basePointerIterm.GetDisplayX();
-    int32_t offsetY = pointerIterm.GetDisplayY() - basePointerIterm.GetDisplayY();
+    int32_t offsetX = pointerIterm.GetDisplayX() - basePoint.displayX;
+    int32_t offsetY = pointerIterm.GetDisplayY() - basePoint.displayY;
     HILOG_DEBUG("current point and first down point: pid %{public}d, %{public}d, %{public}d, %{public}d, %{public}d",
-                pId, pointerIterm.GetDisplayX(), pointerIterm.GetDisplayY(), basePointerIterm.GetDisplayX(),
-                basePointerIterm.GetDisplayY());
+                pId, pointerIterm.GetDisplayX(), pointerIterm.GetDisplayY(), basePoint.displayX,
+                basePoint.displayY);
 
     // two finger move will cancel gesture, but three or four finger move will enter move gesture recognize
     if (!isMoveGestureRecognizing && hypot(offsetX, offsetY) > TOUCH_SLOP * downPointSize) {
@@ -709,41 +736,34 @@ void AccessibilityMultiTapGestureRecognizer::StoreUpPointInPointerRoute(MMI::Poi
         return;
     }
 
-    MMI::PointerEvent::PointerItem basePointerIterm;
-    if (!GetBasePointItem(basePointerIterm, pId, preGesturePoint_)) {
+    MultiFingerPoint basePoint;
+    if (!GetBasePoint(basePoint, pId, preGesturePoint_)) {
         return;
     }
 
-    int32_t offsetX = pointerIterm.GetDisplayX() - basePointerIterm.GetDisplayX();
-    int32_t offsetY = pointerIterm.GetDisplayY() - basePointerIterm.GetDisplayY();
+    int32_t offsetX = pointerIterm.GetDisplayX() - basePoint.displayX;
+    int32_t offsetY = pointerIterm.GetDisplayY() - basePoint.displayY;
     if (abs(offsetX) > mMinPixelsBetweenSamplesX_ || abs(offsetY) > mMinPixelsBetweenSamplesY_) {
         SaveMoveGesturePointerInfo(event, pId, pointerIterm, offsetX, offsetY);
     }
 }
 
-bool AccessibilityMultiTapGestureRecognizer::recognizeGesturePath(const std::vector<Pointer> &path)
+bool AccessibilityMultiTapGestureRecognizer::recognizeGesturePath(const MultiFingerRoute &route)
 {
     HILOG_DEBUG();
-    if (path.size() < MIN_MOVE_POINTER_NUM) {
+    if (route.pointNum < MIN_MOVE_POINTER_NUM) {
         return false;
     }
 
-    int pathSize = static_cast<int>(path.size() - 1);
-    for (int routerIndex = 0; routerIndex < pathSize; routerIndex++) {
-        int32_t dx = static_cast<int32_t>(path[routerIndex + 1].px_ - path[routerIndex].px_);
-        int32_t dy = static_cast<int32_t>(path[routerIndex + 1].py_ - path[routerIndex].py_);
-        if (GetSwipeDirection(dx, dy) != moveDirection) {
-            return false;
-        }
-    }
-    return true;
+    // the direction of every step is checked by AddRoutePoint
+    return route.isSameDirection;
 }
 
 GestureType AccessibilityMultiTapGestureRecognizer::GetMoveGestureId()
 {
     HILOG_DEBUG();
 
-    int32_t downPointSize = static_cast<int32_t>(currentDownPoint_.size());
+    int32_t downPointSize = currentDownPoint_.GetSize();
     if (downPointSize == POINTER_COUNT_3) {
         switch (moveDirection) {
             case MoveGirectionType::SWIPE_LEFT:
@@ -782,16 +802,17 @@ bool AccessibilityMultiTapGestureRecognizer::IsMoveGestureRecognize()
         return false;
     }
 
-    int32_t downPointSize = static_cast<int32_t>(currentDownPoint_.size());
-    if (static_cast<int32_t>(pointerRoute_.size()) != downPointSize) {
+    int32_t downPointSize = currentDownPoint_.GetSize();
+    if (pointerRoute_.GetSize() != downPointSize) {
         return false;
     }
 
     for (int32_t pIndex = 0; pIndex < downPointSize; pIndex++) {
-        if (pointerRoute_.count(pIndex) == 0 || pointerRoute_[pIndex].size() < MIN_MOVE_POINTER_NUM) {
+        const MultiFingerRoute *route = pointerRoute_.Find(pIndex);
+        if (route == nullptr || route->pointNum < MIN_MOVE_POINTER_NUM) {
             return false;
         }
-        if (!recognizeGesturePath(pointerRoute_[pIndex])) {
+        if (!recognizeGesturePath(*route)) {
             return false;
         }
     }
@@ -823,9 +844,9 @@ void AccessibilityMultiTapGestureRecognizer::HandleMultiFingerTouchUpEvent(MMI::
             return;
         }
         fingerTouchUpState_ = FingerTouchUpState::ALL_FINGER_TOUCH_UP;
-        currentDownPoint_.clear();
-        preGesturePoint_.clear();
-        pointerRoute_.clear();
+        currentDownPoint_.Clear();
+        preGesturePoint_.Clear();
+        pointerRoute_.Clear();
         moveDirection = -1;
         isMoveGestureRecognizing = false;
     } else {
@@ -840,7 +861,7 @@ void AccessibilityMultiTapGestureRecognizer::HandleMultiFingerTouchUpEvent(MMI::
         }
     }
 
-    lastUpPoint_[event.GetPointerId()] = std::make_shared<MMI::PointerEvent>(event);
+    RecordPoint(event, lastUpPoint_);
     if (targetFingers_ == -1 && multiFingerGestureState_ == MultiFingerGestureState::GESTURE_START) {
         targetFingers_ = static_cast<int32_t>(event.GetPointerIds().size());
     }
@@ -855,8 +876,9 @@ bool AccessibilityMultiTapGestureRecognizer::OnPointerEvent(MMI::PointerEvent &e
             // cancel last cancel event when recevie a new down event
             CancelAllPenddingEvent();
             isFirstUp_ = true;
-            currentDownPoint_[event.GetPointerId()] = std::make_shared<MMI::PointerEvent>(event);
-            preGesturePoint_[event.GetPointerId()] = std::make_shared<MMI::PointerEvent>(event);
+            if (RecordPoint(event, currentDownPoint_)) {
+                *preGesturePoint_.Insert(event.GetPointerId()) = *currentDownPoint_.Find(event.GetPointerId());
+            }
             if (targetFingers_ == -1) {
                 HanleFirstTouchDownEvent(event);
             } else {
@@ -52,7 +52,7 @@ constexpr uint32_t START_ANGLE_LANDSCAPE = 180;
 constexpr uint32_t START_ANGLE_PORTRAIT_INVERTED = 90;
 constexpr uint32_t START_ANGLE_LANDSCAPE_INVERTED = 0;
 #endif
-constexpr uint32_t NUMBER_10 = 10;
+constexpr std::chrono::milliseconds DRAW_CIRCLE_FRAME_INTERVAL(10);
 
 constexpr float TOUCH_SLOP = 8.0f;
 
@@ -99,7 +99,7 @@ AccessibilityScreenTouch::AccessibilityScreenTouch()
 
     lastUpTime_ = lastUpTime;
 
-    runner_ = Singleton<AccessibleAbilityManagerService>::GetInstance().GetMainRunner();
+    runner_ = Singleton<AccessibleAbilityManagerService>::GetInstance().GetInputRunner();
     if (!runner_) {
         HILOG_ERROR("get runner failed");
         return;
@@ -127,6 +127,9 @@ AccessibilityScreenTouch::~AccessibilityScreenTouch()
 {
     lastUpTime = lastUpTime_;
     if (drawCircleThread_ && drawCircleThread_->joinable()) {
+        DrawCircleCommand command;
+        command.type = DRAW_CIRCLE_EXIT;
+        PostDrawCircleCommand(command);
         drawCircleThread_->join();
     }
     drawCircleThread_ = nullptr;
@@ -136,7 +139,7 @@ AccessibilityScreenTouch::~AccessibilityScreenTouch()
 void AccessibilityScreenTouch::SendInterceptedEvent()
 {
     HILOG_DEBUG();
-    isStopDrawCircle_ = true;
+    StopDrawCircle();
 
     if (cachedDownPointerEvents_.empty()) {
         HILOG_ERROR("Cached down pointer event is empty!");
@@ -211,25 +214,127 @@ void AccessibilityScreenTouch::ConversionCoordinates(MMI::PointerEvent::PointerI
 #endif
 }
 
-void AccessibilityScreenTouch::DrawCircleProgress()
+void AccessibilityScreenTouch::StartDrawCircle()
+{
+    isStopDrawCircle_ = false;
+    if (drawCircleThread_ == nullptr) {
+        drawCircleThread_ = std::make_shared<std::thread>([this] {this->DrawCircleLoop();});
+        if (drawCircleThread_ == nullptr) {
+            HILOG_ERROR("create draw circle progress fail");
+            return;
+        }
+    }
+
+    DrawCircleCommand command;
+    command.type = DRAW_CIRCLE_START;
+    command.physicalX = circleCenterPhysicalX_;
+    command.physicalY = circleCenterPhysicalY_;
+    command.startAngle = startAngle_;
+    command.screenId = screenId_;
+    command.duration = GetRealClickResponseTime();
+    PostDrawCircleCommand(command);
+}
+
+void AccessibilityScreenTouch::UpdateDrawCircle()
+{
+    DrawCircleCommand command;
+    command.type = DRAW_CIRCLE_UPDATE;
+    command.physicalX = circleCenterPhysicalX_;
+    command.physicalY = circleCenterPhysicalY_;
+    PostDrawCircleCommand(command);
+}
+
+void AccessibilityScreenTouch::StopDrawCircle()
+{
+    isStopDrawCircle_ = true;
+    DrawCircleCommand command;
+    command.type = DRAW_CIRCLE_STOP;
+    PostDrawCircleCommand(command);
+}
+
+void AccessibilityScreenTouch::PostDrawCircleCommand(const DrawCircleCommand &command)
+{
+    if (drawCircleThread_ == nullptr) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(drawCircleMutex_);
+        if (command.type == DRAW_CIRCLE_UPDATE && !drawCircleCommands_.empty() &&
+            drawCircleCommands_.back().type == DRAW_CIRCLE_UPDATE) {
+            // only the latest position matters
+            drawCircleCommands_.back() = command;
+        } else {
+            drawCircleCommands_.push_back(command);
+        }
+    }
+    drawCircleCondition_.notify_one();
+}
+
+void AccessibilityScreenTouch::DrawCircleLoop()
 {
     HILOG_DEBUG();
+    while (true) {
+        DrawCircleCommand command;
+        {
+            std::unique_lock<std::mutex> lock(drawCircleMutex_);
+            drawCircleCondition_.wait(lock, [this] { return !drawCircleCommands_.empty(); });
+            command = drawCircleCommands_.front();
+            drawCircleCommands_.pop_front();
+        }
+        if (command.type == DRAW_CIRCLE_EXIT) {
+            return;
+        }
+        if (command.type == DRAW_CIRCLE_START) {
+            DrawCircleProgress(command);
+        }
+    }
+}
+
+void AccessibilityScreenTouch::DrawCircleProgress(const DrawCircleCommand &startCommand)
+{
+    HILOG_DEBUG();
+    std::shared_ptr<AccessibilityCircleDrawingManager> drawingMgr = AccessibilityCircleDrawingManager::GetInstance();
+    int32_t physicalX = startCommand.physicalX;
+    int32_t physicalY = startCommand.physicalY;
+    uint64_t screenId = static_cast<uint64_t>(startCommand.screenId);
+    std::chrono::milliseconds duration(startCommand.duration);
+
+    drawingMgr->DrawPointer(physicalX, physicalY, 0, screenId, startCommand.startAngle);
+    auto startTime = std::chrono::steady_clock::now();
+    auto nextFrameTime = startTime + DRAW_CIRCLE_FRAME_INTERVAL;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(drawCircleMutex_);
+            drawCircleCondition_.wait_until(lock, nextFrameTime, [this] { return !drawCircleCommands_.empty(); });
+            while (!drawCircleCommands_.empty() && drawCircleCommands_.front().type == DRAW_CIRCLE_UPDATE) {
+                physicalX = drawCircleCommands_.front().physicalX;
+                physicalY = drawCircleCommands_.front().physicalY;
+                drawCircleCommands_.pop_front();
+            }
+            // stop, exit and a new start end this progress and are handled by the loop
+            if (!drawCircleCommands_.empty()) {
+                break;
+            }
+        }
+
+        // the angle follows the elapsed time, so a late frame catches up instead of slowing the circle down
+        auto now = std::chrono::steady_clock::now();
+        if (now < nextFrameTime) {
+            continue;
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - startTime);
+        if (elapsed >= duration) {
+            break;
+        }
+        int32_t angle = static_cast<int32_t>(CIRCLE_ANGLE * elapsed.count() / duration.count());
+        drawingMgr->DrawPointer(physicalX, physicalY, angle, screenId, startCommand.startAngle);
+        nextFrameTime += DRAW_CIRCLE_FRAME_INTERVAL;
+        if (nextFrameTime < now) {
+            nextFrameTime = now + DRAW_CIRCLE_FRAME_INTERVAL;
+        }
+    }
 
-    AccessibilityCircleDrawingManager::GetInstance()->DrawPointer(circleCenterPhysicalX_,
-        circleCenterPhysicalY_, 0, screenId_, startAngle_);
-    AccessibilityCircleDrawingManager::GetInstance()->UpdatePointerVisible(true);
-    uint32_t times = GetRealClickResponseTime() / NUMBER_10;
-    uint32_t step = CIRCLE_ANGLE / times;
-    uint32_t time = 0;
-    while (time < times && isStopDrawCircle_ == false) {
-        AccessibilityCircleDrawingManager::GetInstance()->DrawPointer(circleCenterPhysicalX_,
-            circleCenterPhysicalY_, step * time, screenId_, startAngle_);
-        time++;
-        std::this_thread::yield();
-        std::this_thread::sleep_for(std::chrono::milliseconds(NUMBER_10));
-    }
-
-    AccessibilityCircleDrawingManager::GetInstance()->UpdatePointerVisible(false);
+    drawingMgr->UpdatePointerVisible(false);
 }
 
 void AccessibilityScreenTouch::HandleResponseDelayStateInnerDown(MMI::PointerEvent &event)
@@ -263,16 +368,7 @@ void AccessibilityScreenTouch::HandleResponseDelayStateInnerDown(MMI::PointerEve
     isMoveBeyondThreshold_ = false;
 
     ConversionCoordinates(pointerItem);
-    isStopDrawCircle_ = false;
-    if (drawCircleThread_ && drawCircleThread_->joinable()) {
-        drawCircleThread_->join();
-    }
-
-    drawCircleThread_ = nullptr;
-    drawCircleThread_ = std::make_shared<std::thread>([this] {this->DrawCircleProgress();});
-    if (drawCircleThread_ == nullptr) {
-        HILOG_ERROR("create draw circle progress fail");
-    }
+    StartDrawCircle();
 
     handler_->RemoveEvent(FINGER_DOWN_DELAY_MSG);
     cachedDownPointerEvents_.clear();
@@ -323,12 +419,13 @@ void AccessibilityScreenTouch::HandleResponseDelayStateInnerMove(MMI::PointerEve
         }
         EventTransmission::OnPointerEvent(event);
         isMoveBeyondThreshold_ = true;
-        isStopDrawCircle_ = true;
+        StopDrawCircle();
         return;
     }
 
     if (isStopDrawCircle_ != true) {
         ConversionCoordinates(pointerItem);
+        UpdateDrawCircle();
         return;
     }
 
@@ -342,7 +439,7 @@ void AccessibilityScreenTouch::HandleResponseDelayStateInnerUp(MMI::PointerEvent
     if (cachedDownPointerEvents_.empty()) {
         HILOG_ERROR("cached down pointer event is empty!");
         handler_->RemoveEvent(FINGER_DOWN_DELAY_MSG);
-        isStopDrawCircle_ = true;
+        StopDrawCircle();
         return;
     }
 
@@ -360,7 +457,7 @@ void AccessibilityScreenTouch::HandleResponseDelayStateInnerUp(MMI::PointerEvent
 
     if (startPointer_ != nullptr && event.GetPointerId() == startPointer_->GetPointerId()) {
         handler_->RemoveEvent(FINGER_DOWN_DELAY_MSG);
-        isStopDrawCircle_ = true;
+        StopDrawCircle();
         cachedDownPointerEvents_.clear();
     } else {
         auto iter = std::find_if(cachedDownPointerEvents_.begin(), cachedDownPointerEvents_.end(),
@@ -69,6 +69,17 @@ namespace {
     constexpr int DISPLAY_DALTONIZER_BLUE = 13;
     constexpr int INVALID_MASTER_MONO_VALUE = -1;
     constexpr float INVALID_MASTER_BALANCE_VALUE = 2.0;
+    constexpr int64_t SETTINGS_FLUSH_DELAY = 500; // ms
+    constexpr int64_t US_PER_MS = 1000;
+    // keys read by InitCaption and InitSetting
+    const std::vector<std::string> INIT_SETTING_KEYS = {
+        CAPTION_KEY, FONT_FAMILY, FONT_SCALE, FONT_COLOR, FONT_EDGE_TYPE, BACKGROUND_COLOR, WINDOW_COLOR,
+        SCREEN_MAGNIFICATION_KEY, MOUSEKEY, SHORTCUT_ENABLED, SHORTCUT_ENABLED_ON_LOCK_SCREEN, SHORTCUT_TIMEOUT,
+        ANIMATION_OFF_KEY, INVERT_COLOR_KEY, HIGH_CONTRAST_TEXT_KEY, DALTONIZATION_STATE, AUDIO_MONO_KEY,
+        IGNORE_REPEAT_CLICK_SWITCH, "ShortkeyTarget", SHORTCUT_SERVICE, ENABLED_ACCESSIBILITY_SERVICES,
+        "MouseAutoClick", DALTONIZATION_COLOR_FILTER_KEY, CONTENT_TIMEOUT_KEY, BRIGHTNESS_DISCOUNT_KEY,
+        AUDIO_BALANCE_KEY, SCREEN_MAGNIFICATION_TYPE, CLICK_RESPONCE_TIME, IGNORE_REPEAT_CLICK_TIME
+    };
 } // namespace
 AccessibilitySettingsConfig::AccessibilitySettingsConfig(int32_t id)
 {
@@ -143,11 +154,7 @@ RetError AccessibilitySettingsConfig::SetShortKeyTimeout(const int32_t time)
 {
     HILOG_DEBUG("time = [%{public}u]", time);
     shortKeyTimeout_ = time;
-    if (!datashare_) {
-        return RET_ERR_NULLPTR;
-    }
-
-    return datashare_->PutIntValue(SHORTCUT_TIMEOUT, static_cast<int32_t>(time));
+    return PutDeferredValue(SHORTCUT_TIMEOUT, std::to_string(time));
 }
 
 RetError AccessibilitySettingsConfig::SetStartFromAtoHosState(const bool state)
@@ -173,7 +180,7 @@ RetError AccessibilitySettingsConfig::SetMouseAutoClick(const int32_t time)
         return RET_ERR_NULLPTR;
     }
     mouseAutoClick_ = time;
-    return datashare_->PutIntValue("MouseAutoClick", time);
+    return PutDeferredValue("MouseAutoClick", std::to_string(time));
 }
 
 RetError AccessibilitySettingsConfig::SetShortkeyTarget(const std::string &name)
@@ -267,11 +274,7 @@ RetError AccessibilitySettingsConfig::SetDaltonizationColorFilter(const uint32_t
 {
     HILOG_DEBUG("filter = [%{public}u]", filter);
     daltonizationColorFilter_ = filter;
-    if (!datashare_) {
-        return RET_ERR_NULLPTR;
-    }
-
-    return datashare_->PutIntValue(DALTONIZATION_COLOR_FILTER_KEY, static_cast<int32_t>(filter));
+    return PutDeferredValue(DALTONIZATION_COLOR_FILTER_KEY, std::to_string(static_cast<int32_t>(filter)));
 }
 
 
@@ -279,44 +282,28 @@ RetError AccessibilitySettingsConfig::SetContentTimeout(const uint32_t time)
 {
     HILOG_DEBUG("time = [%{public}u]", time);
     contentTimeout_ = time;
-    if (!datashare_) {
-        return RET_ERR_NULLPTR;
-    }
-
-    return datashare_->PutIntValue(CONTENT_TIMEOUT_KEY, static_cast<int32_t>(time));
+    return PutDeferredValue(CONTENT_TIMEOUT_KEY, std::to_string(static_cast<int32_t>(time)));
 }
 
 RetError AccessibilitySettingsConfig::SetBrightnessDiscount(const float discount)
 {
     HILOG_DEBUG("discount = [%{public}f]", discount);
     brightnessDiscount_ = discount;
-    if (!datashare_) {
-        return RET_ERR_NULLPTR;
-    }
-
-    return datashare_->PutFloatValue(BRIGHTNESS_DISCOUNT_KEY, discount);
+    return PutDeferredValue(BRIGHTNESS_DISCOUNT_KEY, std::to_string(discount));
 }
 
 RetError AccessibilitySettingsConfig::SetAudioBalance(const float balance)
 {
     HILOG_DEBUG("balance = [%{public}f]", balance);
     audioBalance_ = balance;
-    if (!datashare_) {
-        return RET_ERR_NULLPTR;
-    }
-
-    return datashare_->PutFloatValue(AUDIO_BALANCE_KEY, balance);
+    return PutDeferredValue(AUDIO_BALANCE_KEY, std::to_string(balance));
 }
 
 RetError AccessibilitySettingsConfig::SetClickResponseTime(const uint32_t time)
 {
     HILOG_DEBUG("clickResponseTime = [%{public}u]", time);
     clickResponseTime_ = time;
-    if (!datashare_) {
-        return RET_ERR_NULLPTR;
-    }
-
-    return datashare_->PutIntValue(CLICK_RESPONCE_TIME, time);
+    return PutDeferredValue(CLICK_RESPONCE_TIME, std::to_string(static_cast<int32_t>(time)));
 }
 
 RetError AccessibilitySettingsConfig::SetIgnoreRepeatClickState(const bool state)
@@ -330,10 +317,7 @@ RetError AccessibilitySettingsConfig::SetIgnoreRepeatClickTime(const uint32_t ti
 {
     HILOG_DEBUG("ignoreRepeatClickTime = [%{public}u]", time);
     ignoreRepeatClickTime_ = time;
-    if (!datashare_) {
-        return RET_ERR_NULLPTR;
-    }
-    return datashare_->PutIntValue(IGNORE_REPEAT_CLICK_TIME, time);
+    return PutDeferredValue(IGNORE_REPEAT_CLICK_TIME, std::to_string(static_cast<int32_t>(time)));
 }
 
 RetError AccessibilitySettingsConfig::SetCaptionProperty(const AccessibilityConfig::CaptionProperty& caption)
@@ -344,12 +328,12 @@ RetError AccessibilitySettingsConfig::SetCaptionProperty(const AccessibilityConf
         return RET_ERR_NULLPTR;
     }
 
-    datashare_->PutStringValue(FONT_FAMILY, captionProperty_.GetFontFamily());
-    datashare_->PutIntValue(FONT_COLOR, static_cast<int32_t>(captionProperty_.GetFontColor()));
-    datashare_->PutStringValue(FONT_EDGE_TYPE, captionProperty_.GetFontEdgeType());
-    datashare_->PutIntValue(BACKGROUND_COLOR, static_cast<int32_t>(captionProperty_.GetBackgroundColor()));
-    datashare_->PutIntValue(WINDOW_COLOR, static_cast<int32_t>(captionProperty_.GetWindowColor()));
-    datashare_->PutIntValue(FONT_SCALE, captionProperty_.GetFontScale());
+    PutDeferredValue(FONT_FAMILY, captionProperty_.GetFontFamily());
+    PutDeferredValue(FONT_COLOR, std::to_string(static_cast<int32_t>(captionProperty_.GetFontColor())));
+    PutDeferredValue(FONT_EDGE_TYPE, captionProperty_.GetFontEdgeType());
+    PutDeferredValue(BACKGROUND_COLOR, std::to_string(static_cast<int32_t>(captionProperty_.GetBackgroundColor())));
+    PutDeferredValue(WINDOW_COLOR, std::to_string(static_cast<int32_t>(captionProperty_.GetWindowColor())));
+    PutDeferredValue(FONT_SCALE, std::to_string(captionProperty_.GetFontScale()));
     return RET_OK;
 }
 
@@ -688,6 +672,82 @@ RetError AccessibilitySettingsConfig::SetConfigState(const std::string& key, boo
     return datashare_->PutBoolValue(key, value);
 }
 
+RetError AccessibilitySettingsConfig::PutDeferredValue(const std::string& key, const std::string& value)
+{
+    if (!datashare_) {
+        return RET_ERR_NULLPTR;
+    }
+
+    std::weak_ptr<AccessibilitySettingsConfig> weakConfig = weak_from_this();
+    if (weakConfig.expired()) {
+        // not owned by a shared_ptr, so no flush task can be scheduled
+        return datashare_->PutStringValue(key, value);
+    }
+
+    std::lock_guard<ffrt::mutex> lock(pendingMutex_);
+    pendingValues_[key] = value;
+    if (isFlushScheduled_) {
+        return RET_OK;
+    }
+    isFlushScheduled_ = true;
+    ffrt::submit([weakConfig]() {
+        std::shared_ptr<AccessibilitySettingsConfig> config = weakConfig.lock();
+        if (config) {
+            config->FlushPendingSettings();
+        }
+        }, {}, {}, ffrt::task_attr().delay(SETTINGS_FLUSH_DELAY * US_PER_MS));
+    return RET_OK;
+}
+
+RetError AccessibilitySettingsConfig::FlushPendingSettings()
+{
+    // keeps the commits in order when the flush task and an explicit flush run at the same time
+    std::lock_guard<ffrt::mutex> flushLock(flushMutex_);
+    std::map<std::string, std::string> pendingValues;
+    {
+        std::lock_guard<ffrt::mutex> lock(pendingMutex_);
+        pendingValues.swap(pendingValues_);
+        isFlushScheduled_ = false;
+    }
+    if (pendingValues.empty()) {
+        return RET_OK;
+    }
+    if (!datashare_) {
+        HILOG_ERROR("drop %{public}zu settings without datashare", pendingValues.size());
+        flushStats_.failedCount += pendingValues.size();
+        return RET_ERR_NULLPTR;
+    }
+
+    HILOG_DEBUG("flush %{public}zu settings", pendingValues.size());
+    RetError rtn = RET_OK;
+    for (auto& pendingValue : pendingValues) {
+        RetError ret = datashare_->PutStringValue(pendingValue.first, pendingValue.second);
+        if (ret != RET_OK) {
+            HILOG_ERROR("put key failed key = %{public}s, ret = %{public}d", pendingValue.first.c_str(), ret);
+            flushStats_.failedCount++;
+            rtn = ret;
+        } else {
+            flushStats_.committedCount++;
+        }
+    }
+    return rtn;
+}
+
+SettingsFlushStats AccessibilitySettingsConfig::GetSettingsFlushStats()
+{
+    std::lock_guard<ffrt::mutex> flushLock(flushMutex_);
+    return flushStats_;
+}
+
+void AccessibilitySettingsConfig::DropPendingSettings()
+{
+    std::lock_guard<ffrt::mutex> lock(pendingMutex_);
+    if (!pendingValues_.empty()) {
+        HILOG_WARN("drop %{public}zu pending settings", pendingValues_.size());
+    }
+    pendingValues_.clear();
+}
+
 void AccessibilitySettingsConfig::Init()
 {
     HILOG_DEBUG();
@@ -696,8 +756,16 @@ void AccessibilitySettingsConfig::Init()
         return;
     }
     datashare_->Initialize(POWER_MANAGER_SERVICE_ID);
+
+    int64_t startTime = Utils::GetSystemTime();
+    loadStats_.isBatchLoaded = (datashare_->BeginBatchLoad(INIT_SETTING_KEYS) == RET_OK);
     InitCaption();
     InitSetting();
+    loadStats_.defaultCount = datashare_->EndBatchLoad();
+    loadStats_.keyCount = loadStats_.isBatchLoaded ? INIT_SETTING_KEYS.size() : 0;
+    loadStats_.loadTime = Utils::GetSystemTime() - startTime;
+    HILOG_INFO("settings of account %{public}d loaded in %{public}" PRId64 " ms, batched: %{public}d",
+        accountId_, loadStats_.loadTime, loadStats_.isBatchLoaded);
 
     systemDatashare_ = std::make_shared<AccessibilityDatashareHelper>(DATASHARE_TYPE::SYSTEM, accountId_);
     if (systemDatashare_ == nullptr) {
@@ -732,6 +800,8 @@ void AccessibilitySettingsConfig::CloneAudioState()
 
 void AccessibilitySettingsConfig::OnDataClone()
 {
+    // the cloned database overrides the values changed before
+    DropPendingSettings();
     InitSetting();
     CloneAudioState();
 
@@ -18,12 +18,16 @@
 #include "hilog_wrapper.h"
 #include "utils.h"
 #include <cinttypes>
+#include <ctime>
 
 namespace OHOS {
 namespace Accessibility {
 namespace {
     constexpr int32_t MS_TO_US = 1000;
+    constexpr int64_t US_PER_S = 1000000;
+    constexpr int64_t NS_PER_US = 1000;
     constexpr int32_t MOVE_GESTURE_MIN_PATH_COUNT = 2;
+    constexpr size_t INJECTED_EVENTS_CAPACITY = 128;
 } // namespace
 
 TouchInjectHandler::TouchInjectHandler(const std::shared_ptr<AppExecFwk::EventRunner> &runner,
@@ -33,19 +37,13 @@ TouchInjectHandler::TouchInjectHandler(const std::shared_ptr<AppExecFwk::EventRu
 
 void TouchInjectHandler::ProcessEvent(const AppExecFwk::InnerEvent::Pointer &event)
 {
-    std::shared_ptr<SendEventArgs> parameters = nullptr;
     if (!event) {
         HILOG_ERROR("event is nullptr");
         return;
     }
     switch (event->GetInnerEventId()) {
         case TouchEventInjector::SEND_TOUCH_EVENT_MSG:
-            parameters = event->GetSharedObject<SendEventArgs>();
-            if (!parameters->event_) {
-                HILOG_WARN("pointer event is nullptr");
-                return;
-            }
-            server_.SendPointerEvent(*parameters->event_);
+            server_.SendInjectedEvents();
             break;
         default:
             break;
@@ -54,7 +52,8 @@ void TouchInjectHandler::ProcessEvent(const AppExecFwk::InnerEvent::Pointer &eve
 
 TouchEventInjector::TouchEventInjector()
 {
-    runner_ = Singleton<AccessibleAbilityManagerService>::GetInstance().GetMainRunner();
+    injectedEvents_.reserve(INJECTED_EVENTS_CAPACITY);
+    runner_ = Singleton<AccessibleAbilityManagerService>::GetInstance().GetInputRunner();
     if (!runner_) {
         HILOG_ERROR("get runner failed");
         return;
@@ -119,10 +118,15 @@ void TouchEventInjector::CancelGesture()
 void TouchEventInjector::CancelInjectedEvents()
 {
     HILOG_DEBUG();
-    if (handler_->HasInnerEvent(SEND_TOUCH_EVENT_MSG)) {
+    if (nextEventIndex_ >= injectedEvents_.size()) {
+        return;
+    }
+    if (handler_) {
         handler_->RemoveEvent(SEND_TOUCH_EVENT_MSG);
-        CancelGesture();
     }
+    injectedEvents_.clear();
+    nextEventIndex_ = 0;
+    CancelGesture();
 }
 
 std::shared_ptr<MMI::PointerEvent> TouchEventInjector::obtainTouchEvent(int32_t action,
@@ -149,7 +153,10 @@ int64_t TouchEventInjector::GetSystemTime()
 {
     HILOG_DEBUG();
 
-    int64_t microsecond = Utils::GetSystemTime() * 1000;
+    // Read at microsecond resolution, the injection times and the jitter are kept in microseconds.
+    struct timespec times = {0, 0};
+    clock_gettime(CLOCK_MONOTONIC, &times);
+    int64_t microsecond = static_cast<int64_t>(times.tv_sec * US_PER_S + times.tv_nsec / NS_PER_US);
     return microsecond;
 }
 
@@ -171,19 +178,66 @@ void TouchEventInjector::InjectEvents(const std::shared_ptr<AccessibilityGesture
         HILOG_WARN("No injected events");
         return;
     }
-    for (size_t i = 0; i < injectedEvents_.size(); i++) {
-        std::shared_ptr<SendEventArgs> parameters = std::make_shared<SendEventArgs>();
-        parameters->event_ = injectedEvents_[i];
-        if (injectedEvents_[i]) {
-            int64_t timeout = (injectedEvents_[i]->GetActionTime() - curTime) / MS_TO_US;
-            if (timeout < 0) {
-                HILOG_WARN("timeout is error.%{public}" PRId64 "", timeout);
-            } else {
-                handler_->SendEvent(SEND_TOUCH_EVENT_MSG, parameters, timeout);
-            }
+    nextEventIndex_ = 0;
+    ScheduleNextEvent();
+}
+
+void TouchEventInjector::ScheduleNextEvent()
+{
+    if (nextEventIndex_ >= injectedEvents_.size()) {
+        injectedEvents_.clear();
+        nextEventIndex_ = 0;
+        return;
+    }
+    if (!handler_) {
+        HILOG_ERROR("handler_ is nullptr");
+        injectedEvents_.clear();
+        nextEventIndex_ = 0;
+        return;
+    }
+    int64_t delayTime = (injectedEvents_[nextEventIndex_]->GetActionTime() - GetSystemTime()) / MS_TO_US;
+    handler_->SendEvent(SEND_TOUCH_EVENT_MSG, delayTime > 0 ? delayTime : 0);
+}
+
+void TouchEventInjector::SendInjectedEvents()
+{
+    HILOG_DEBUG();
+    while (nextEventIndex_ < injectedEvents_.size()) {
+        // The timer has millisecond granularity, so an event due within the next millisecond is sent now.
+        int64_t jitter = GetSystemTime() - injectedEvents_[nextEventIndex_]->GetActionTime();
+        if (jitter <= -MS_TO_US) {
+            break;
         }
+        std::shared_ptr<MMI::PointerEvent> event = injectedEvents_[nextEventIndex_++];
+        UpdateJitterStats(jitter);
+        SendPointerEvent(*event);
     }
-    injectedEvents_.clear();
+    ScheduleNextEvent();
+}
+
+void TouchEventInjector::UpdateJitterStats(int64_t jitter)
+{
+    // only written on the input runner
+    int64_t absJitter = jitter < 0 ? -jitter : jitter;
+    injectedCount_.fetch_add(1, std::memory_order_relaxed);
+    lastJitter_.store(jitter, std::memory_order_relaxed);
+    totalJitter_.fetch_add(absJitter, std::memory_order_relaxed);
+    if (absJitter > maxJitter_.load(std::memory_order_relaxed)) {
+        maxJitter_.store(absJitter, std::memory_order_relaxed);
+    }
+}
+
+InjectionJitterStats TouchEventInjector::GetInjectionJitterStats() const
+{
+    InjectionJitterStats stats;
+    stats.injectedCount = injectedCount_.load(std::memory_order_relaxed);
+    stats.lastJitter = lastJitter_.load(std::memory_order_relaxed);
+    stats.maxJitter = maxJitter_.load(std::memory_order_relaxed);
+    if (stats.injectedCount > 0) {
+        stats.averageJitter = totalJitter_.load(std::memory_order_relaxed) /
+            static_cast<int64_t>(stats.injectedCount);
+    }
+    return stats;
 }
 
 void TouchEventInjector::ParseTapsEvents(int64_t startTime,
@@ -51,7 +51,7 @@ void TouchGuider::StartUp()
     gestureRecognizer_.RegisterListener(*touchGuideListener_.get());
     multiFingerGestureRecognizer_.RegisterListener(*touchGuideListener_.get());
 
-    runner_ = Singleton<AccessibleAbilityManagerService>::GetInstance().GetMainRunner();
+    runner_ = Singleton<AccessibleAbilityManagerService>::GetInstance().GetInputRunner();
     if (!runner_) {
         HILOG_ERROR("get runner failed");
         return;
@@ -23,6 +23,10 @@
 
 namespace OHOS {
 namespace Accessibility {
+namespace {
+    constexpr size_t MAX_INDEXED_ELEMENT_NUM = 10000;
+} // namespace
+
 AccessibilityWindowManager::AccessibilityWindowManager()
 {
 }
@@ -953,13 +957,92 @@ void AccessibilityWindowManager::GetSceneBoardInnerWinId(int32_t windowId, int64
 void AccessibilityWindowManager::SceneBoardElementIdMap::InsertPair(const int32_t windowId, const int64_t elementId)
 {
     std::lock_guard<ffrt::mutex> lock(mapMutex_);
+    auto iter = windowElementMap_.find(windowId);
+    if (iter != windowElementMap_.end()) {
+        if (iter->second == elementId) {
+            return;
+        }
+        int64_t rootElementId = iter->second;
+        windowElementMap_.erase(iter);
+        RemoveElements(windowId, rootElementId);
+    }
     windowElementMap_[windowId] = elementId;
+    rootElementMap_.emplace(elementId, windowId);
 }
 
 void AccessibilityWindowManager::SceneBoardElementIdMap::RemovePair(const int32_t windowId)
 {
     std::lock_guard<ffrt::mutex> lock(mapMutex_);
-    windowElementMap_.erase(windowId);
+    auto iter = windowElementMap_.find(windowId);
+    if (iter == windowElementMap_.end()) {
+        return;
+    }
+    int64_t rootElementId = iter->second;
+    windowElementMap_.erase(iter);
+    RemoveElements(windowId, rootElementId);
+}
+
+void AccessibilityWindowManager::SceneBoardElementIdMap::RemoveElements(const int32_t windowId,
+    const int64_t rootElementId)
+{
+    auto rootIter = rootElementMap_.find(rootElementId);
+    if (rootIter != rootElementMap_.end() && rootIter->second == windowId) {
+        rootElementMap_.erase(rootIter);
+        // another inner window may share the root element
+        for (auto& pair : windowElementMap_) {
+            if (pair.second == rootElementId) {
+                rootElementMap_.emplace(rootElementId, pair.first);
+                break;
+            }
+        }
+    }
+    for (auto iter = elementWindowMap_.begin(); iter != elementWindowMap_.end();) {
+        if (iter->second == windowId) {
+            iter = elementWindowMap_.erase(iter);
+        } else {
+            iter++;
+        }
+    }
+}
+
+bool AccessibilityWindowManager::SceneBoardElementIdMap::IsRootElement(const int64_t elementId)
+{
+    std::lock_guard<ffrt::mutex> lock(mapMutex_);
+    return rootElementMap_.count(elementId);
+}
+
+bool AccessibilityWindowManager::SceneBoardElementIdMap::GetInnerWindowId(const int64_t elementId,
+    int32_t& windowId)
+{
+    std::lock_guard<ffrt::mutex> lock(mapMutex_);
+    auto iter = rootElementMap_.find(elementId);
+    if (iter != rootElementMap_.end()) {
+        windowId = iter->second;
+        return true;
+    }
+    iter = elementWindowMap_.find(elementId);
+    if (iter != elementWindowMap_.end()) {
+        windowId = iter->second;
+        return true;
+    }
+    return false;
+}
+
+void AccessibilityWindowManager::SceneBoardElementIdMap::InsertElements(const int32_t windowId,
+    const std::vector<int64_t>& elementIds)
+{
+    std::lock_guard<ffrt::mutex> lock(mapMutex_);
+    if (!windowElementMap_.count(windowId)) {
+        HILOG_DEBUG("inner window %{public}d is removed", windowId);
+        return;
+    }
+    if (elementWindowMap_.size() + elementIds.size() > MAX_INDEXED_ELEMENT_NUM) {
+        HILOG_DEBUG("element index is full, clear it");
+        elementWindowMap_.clear();
+    }
+    for (auto elementId : elementIds) {
+        elementWindowMap_[elementId] = windowId;
+    }
 }
 
 bool AccessibilityWindowManager::SceneBoardElementIdMap::CheckWindowIdPair(const int32_t windowId)
@@ -972,6 +1055,8 @@ void AccessibilityWindowManager::SceneBoardElementIdMap::Clear()
 {
     std::lock_guard<ffrt::mutex> lock(mapMutex_);
     windowElementMap_.clear();
+    rootElementMap_.clear();
+    elementWindowMap_.clear();
 }
 
 std::map<int32_t, int64_t> AccessibilityWindowManager::SceneBoardElementIdMap::GetAllPairs()
@@ -996,13 +1081,7 @@ RetError AccessibilityWindowManager::GetFocusedWindowId(int32_t &focusedWindowId
 bool AccessibilityWindowManager::IsInnerWindowRootElement(int64_t elementId)
 {
     HILOG_DEBUG("IsInnerWindowRootElement elementId: %{public}" PRId64 "", elementId);
-    auto mapTable = sceneBoardElementIdMap_.GetAllPairs();
-    for (auto iter = mapTable.begin(); iter != mapTable.end(); iter++) {
-        if (elementId == iter->second) {
-            return true;
-        }
-    }
-    return false;
+    return sceneBoardElementIdMap_.IsRootElement(elementId);
 }
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
@@ -50,7 +50,7 @@ AccessibilityZoomGesture::AccessibilityZoomGesture()
     HILOG_DEBUG();
 
     zoomGestureEventHandler_ = std::make_shared<ZoomGestureEventHandler>(
-        Singleton<AccessibleAbilityManagerService>::GetInstance().GetMainRunner(), *this);
+        Singleton<AccessibleAbilityManagerService>::GetInstance().GetInputRunner(), *this);
 
     tapDistance_ = TAP_MIN_DISTANCE;
 
@@ -148,7 +148,8 @@ void AccessibilityZoomGesture::CacheEvents(MMI::PointerEvent &event)
 
     int32_t action = event.GetPointerAction();
     size_t pointerCount = event.GetPointerIds().size();
-    std::shared_ptr<MMI::PointerEvent> pointerEvent = std::make_shared<MMI::PointerEvent>(event);
+    // A cached event only goes down the chain when the cache is sent, so it can share the dispatched event.
+    std::shared_ptr<MMI::PointerEvent> pointerEvent = KeepPointerEvent(event);
 
     switch (action) {
         case MMI::PointerEvent::POINTER_ACTION_DOWN:
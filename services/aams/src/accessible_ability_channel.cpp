@@ -58,52 +58,34 @@ RetError AccessibleAbilityChannel::SearchElementInfoByAccessibilityId(const Elem
     HILOG_DEBUG("elementId:%{public}" PRId64 " winId: %{public}d treeId: %{public}d", elementId, windowId, treeId);
     Singleton<AccessibleAbilityManagerService>::GetInstance().PostDelayUnloadTask();
 
-    if (eventHandler_ == nullptr) {
-        HILOG_ERROR("eventHandler_ is nullptr.");
-        return RET_ERR_NULLPTR;
-    }
     if (callback == nullptr) {
         HILOG_ERROR("callback is nullptr.");
         return RET_ERR_NULLPTR;
     }
 
-    std::shared_ptr<ffrt::promise<RetError>> syncPromise = std::make_shared<ffrt::promise<RetError>>();
-    ffrt::future syncFuture = syncPromise->get_future();
-    eventHandler_->PostTask([this, syncPromise, windowId, elementId, treeId, requestId,
-        callback, mode, isFilter]() {
-        HILOG_DEBUG("search element accountId[%{public}d], name[%{public}s]", accountId_, clientName_.c_str());
-        sptr<IAccessibilityElementOperator> elementOperator = nullptr;
-        RetError ret = GetElementOperator(accountId_, windowId, FOCUS_TYPE_INVALID, clientName_,
-            elementOperator, treeId);
-        if (ret != RET_OK) {
-            HILOG_ERROR("Get elementOperator failed! accessibilityWindowId[%{public}d]", windowId);
-            std::vector<AccessibilityElementInfo> infos = {};
-            callback->SetSearchElementInfoByAccessibilityIdResult(infos, requestId);
-            syncPromise->set_value(ret);
-            return;
-        }
-
-        auto& awm = Singleton<AccessibilityWindowManager>::GetInstance();
-        if (windowId == SCENE_BOARD_WINDOW_ID && awm.IsInnerWindowRootElement(elementId)) {
-            std::vector<AccessibilityElementInfo> infos = {};
-            callback->SetSearchElementInfoByAccessibilityIdResult(infos, requestId);
-            HILOG_DEBUG("IsInnerWindowRootElement elementId: %{public}" PRId64 "", elementId);
-        } else {
-            int64_t realElementId = awm.GetSceneBoardElementId(windowId, elementId);
-            Singleton<AccessibleAbilityManagerService>::GetInstance().AddRequestId(windowId, treeId,
-                requestId, callback);
-            elementOperator->SearchElementInfoByAccessibilityId(realElementId, requestId, callback, mode, isFilter);
-            HILOG_DEBUG("AccessibleAbilityChannel::SearchElementInfoByAccessibilityId successfully");
-        }
-        syncPromise->set_value(RET_OK);
-        }, "SearchElementInfoByAccessibilityId");
+    HILOG_DEBUG("search element accountId[%{public}d], name[%{public}s]", accountId_, clientName_.c_str());
+    sptr<IAccessibilityElementOperator> elementOperator = nullptr;
+    RetError ret = GetElementOperator(accountId_, windowId, FOCUS_TYPE_INVALID, clientName_,
+        elementOperator, treeId);
+    if (ret != RET_OK) {
+        HILOG_ERROR("Get elementOperator failed! accessibilityWindowId[%{public}d]", windowId);
+        std::vector<AccessibilityElementInfo> infos = {};
+        callback->SetSearchElementInfoByAccessibilityIdResult(infos, requestId);
+        return ret;
+    }
 
-    ffrt::future_status wait = syncFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
-    if (wait != ffrt::future_status::ready) {
-        HILOG_ERROR("Failed to wait SearchElementInfoByAccessibilityId result");
-        return RET_ERR_TIME_OUT;
+    auto& awm = Singleton<AccessibilityWindowManager>::GetInstance();
+    if (windowId == SCENE_BOARD_WINDOW_ID && awm.IsInnerWindowRootElement(elementId)) {
+        std::vector<AccessibilityElementInfo> infos = {};
+        callback->SetSearchElementInfoByAccessibilityIdResult(infos, requestId);
+        HILOG_DEBUG("IsInnerWindowRootElement elementId: %{public}" PRId64 "", elementId);
+        return RET_OK;
     }
-    return syncFuture.get();
+    int64_t realElementId = awm.GetSceneBoardElementId(windowId, elementId);
+    Singleton<AccessibleAbilityManagerService>::GetInstance().AddRequestId(windowId, treeId, requestId, callback);
+    elementOperator->SearchElementInfoByAccessibilityId(realElementId, requestId, callback, mode, isFilter);
+    HILOG_DEBUG("AccessibleAbilityChannel::SearchElementInfoByAccessibilityId successfully");
+    return RET_OK;
 }
 
 RetError AccessibleAbilityChannel::SearchElementInfosByText(const int32_t accessibilityWindowId,
@@ -114,47 +96,30 @@ RetError AccessibleAbilityChannel::SearchElementInfosByText(const int32_t access
         elementId, accessibilityWindowId);
     Singleton<AccessibleAbilityManagerService>::GetInstance().PostDelayUnloadTask();
 
-    if (eventHandler_ == nullptr) {
-        HILOG_ERROR("eventHandler_ is nullptr.");
-        return RET_ERR_NULLPTR;
-    }
     if (callback == nullptr) {
         HILOG_ERROR("callback is nullptr.");
         return RET_ERR_NULLPTR;
     }
 
     int32_t treeId = AccessibleAbilityManagerService::GetTreeIdBySplitElementId(elementId);
-    HILOG_DEBUG("SearchElementInfosByText :channel SearchElementInfo treeId: %{public}d", treeId);
-    std::shared_ptr<ffrt::promise<RetError>> syncPromise = std::make_shared<ffrt::promise<RetError>>();
-    ffrt::future syncFuture = syncPromise->get_future();
-    eventHandler_->PostTask([this, syncPromise, accessibilityWindowId, elementId, treeId, text, requestId,
-        callback]() {
-        HILOG_DEBUG("accountId[%{public}d], name[%{public}s]", accountId_, clientName_.c_str());
-        sptr<IAccessibilityElementOperator> elementOperator = nullptr;
-        RetError ret = GetElementOperator(accountId_, accessibilityWindowId, FOCUS_TYPE_INVALID,
-            clientName_, elementOperator, treeId);
-        if (ret != RET_OK) {
-            HILOG_ERROR("Get elementOperator failed! accessibilityWindowId[%{public}d]", accessibilityWindowId);
-            std::vector<AccessibilityElementInfo> infos = {};
-            callback->SetSearchElementInfoByAccessibilityIdResult(infos, requestId);
-            syncPromise->set_value(ret);
-            return;
-        }
-
-        auto& awm = Singleton<AccessibilityWindowManager>::GetInstance();
-        int64_t realElementId = awm.GetSceneBoardElementId(accessibilityWindowId, elementId);
-        Singleton<AccessibleAbilityManagerService>::GetInstance().AddRequestId(accessibilityWindowId, treeId,
-            requestId, callback);
-        elementOperator->SearchElementInfosByText(realElementId, text, requestId, callback);
-        syncPromise->set_value(RET_OK);
-        }, "SearchElementInfosByText");
-
-    ffrt::future_status wait = syncFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
-    if (wait != ffrt::future_status::ready) {
-        HILOG_ERROR("Failed to wait SearchElementInfosByText result");
-        return RET_ERR_TIME_OUT;
-    }
-    return syncFuture.get();
+    HILOG_DEBUG("SearchElementInfosByText :channel SearchElementInfosByText treeId: %{public}d", treeId);
+    HILOG_DEBUG("accountId[%{public}d], name[%{public}s]", accountId_, clientName_.c_str());
+    sptr<IAccessibilityElementOperator> elementOperator = nullptr;
+    RetError ret = GetElementOperator(accountId_, accessibilityWindowId, FOCUS_TYPE_INVALID, clientName_,
+        elementOperator, treeId);
+    if (ret != RET_OK) {
+        HILOG_ERROR("Get elementOperator failed! accessibilityWindowId[%{public}d]", accessibilityWindowId);
+        std::vector<AccessibilityElementInfo> infos = {};
+        callback->SetSearchElementInfoByAccessibilityIdResult(infos, requestId);
+        return ret;
+    }
+
+    auto& awm = Singleton<AccessibilityWindowManager>::GetInstance();
+    int64_t realElementId = awm.GetSceneBoardElementId(accessibilityWindowId, elementId);
+    Singleton<AccessibleAbilityManagerService>::GetInstance().AddRequestId(accessibilityWindowId, treeId,
+        requestId, callback);
+    elementOperator->SearchElementInfosByText(realElementId, text, requestId, callback);
+    return RET_OK;
 }
 
 RetError AccessibleAbilityChannel::FindFocusedElementInfo(const int32_t accessibilityWindowId,
@@ -165,47 +130,30 @@ RetError AccessibleAbilityChannel::FindFocusedElementInfo(const int32_t accessib
         elementId, accessibilityWindowId);
     Singleton<AccessibleAbilityManagerService>::GetInstance().PostDelayUnloadTask();
 
-    if (eventHandler_== nullptr) {
-        HILOG_ERROR("eventHandler_ is nullptr.");
-        return RET_ERR_NULLPTR;
-    }
     if (callback == nullptr) {
         HILOG_ERROR("callback is nullptr.");
         return RET_ERR_NULLPTR;
     }
 
-    std::shared_ptr<ffrt::promise<RetError>> syncPromise = std::make_shared<ffrt::promise<RetError>>();
-    ffrt::future syncFuture = syncPromise->get_future();
     int32_t treeId = AccessibleAbilityManagerService::GetTreeIdBySplitElementId(elementId);
     HILOG_DEBUG("FindFocusedElementInfo :channel FindFocusedElementInfo treeId: %{public}d", treeId);
-    eventHandler_->PostTask([this, syncPromise, accessibilityWindowId, elementId, treeId,
-        focusType, requestId, callback]() {
-        HILOG_DEBUG("accountId[%{public}d], name[%{public}s]", accountId_, clientName_.c_str());
-        sptr<IAccessibilityElementOperator> elementOperator = nullptr;
-        RetError ret = GetElementOperator(accountId_, accessibilityWindowId, focusType,
-            clientName_, elementOperator, treeId);
-        if (ret != RET_OK) {
-            HILOG_ERROR("Get elementOperator failed! accessibilityWindowId[%{public}d]", accessibilityWindowId);
-            std::vector<AccessibilityElementInfo> infos = {};
-            callback->SetSearchElementInfoByAccessibilityIdResult(infos, requestId);
-            syncPromise->set_value(ret);
-            return;
-        }
-
-        auto& awm = Singleton<AccessibilityWindowManager>::GetInstance();
-        int64_t realElementId = awm.GetSceneBoardElementId(accessibilityWindowId, elementId);
-        Singleton<AccessibleAbilityManagerService>::GetInstance().AddRequestId(accessibilityWindowId, treeId,
-            requestId, callback);
-        elementOperator->FindFocusedElementInfo(realElementId, focusType, requestId, callback);
-        syncPromise->set_value(RET_OK);
-        }, "FindFocusedElementInfo");
-    
-    ffrt::future_status wait = syncFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
-    if (wait != ffrt::future_status::ready) {
-        HILOG_ERROR("Failed to wait FindFocusedElementInfo result");
-        return RET_ERR_TIME_OUT;
-    }
-    return syncFuture.get();
+    HILOG_DEBUG("accountId[%{public}d], name[%{public}s]", accountId_, clientName_.c_str());
+    sptr<IAccessibilityElementOperator> elementOperator = nullptr;
+    RetError ret = GetElementOperator(accountId_, accessibilityWindowId, focusType, clientName_,
+        elementOperator, treeId);
+    if (ret != RET_OK) {
+        HILOG_ERROR("Get elementOperator failed! accessibilityWindowId[%{public}d]", accessibilityWindowId);
+        std::vector<AccessibilityElementInfo> infos = {};
+        callback->SetSearchElementInfoByAccessibilityIdResult(infos, requestId);
+        return ret;
+    }
+
+    auto& awm = Singleton<AccessibilityWindowManager>::GetInstance();
+    int64_t realElementId = awm.GetSceneBoardElementId(accessibilityWindowId, elementId);
+    Singleton<AccessibleAbilityManagerService>::GetInstance().AddRequestId(accessibilityWindowId, treeId,
+        requestId, callback);
+    elementOperator->FindFocusedElementInfo(realElementId, focusType, requestId, callback);
+    return RET_OK;
 }
 
 RetError AccessibleAbilityChannel::FocusMoveSearch(const int32_t accessibilityWindowId, const int64_t elementId,
@@ -215,47 +163,30 @@ RetError AccessibleAbilityChannel::FocusMoveSearch(const int32_t accessibilityWi
         elementId, accessibilityWindowId);
     Singleton<AccessibleAbilityManagerService>::GetInstance().PostDelayUnloadTask();
 
-    if (eventHandler_ == nullptr) {
-        HILOG_ERROR("eventHandler_ is nullptr.");
-        return RET_ERR_NULLPTR;
-    }
     if (callback == nullptr) {
         HILOG_ERROR("callback is nullptr.");
         return RET_ERR_NULLPTR;
     }
 
-    std::shared_ptr<ffrt::promise<RetError>> syncPromise = std::make_shared<ffrt::promise<RetError>>();
-    ffrt::future syncFuture = syncPromise->get_future();
     int32_t treeId = AccessibleAbilityManagerService::GetTreeIdBySplitElementId(elementId);
     HILOG_DEBUG("FocusMoveSearch :channel FocusMoveSearch treeId: %{public}d", treeId);
-    eventHandler_->PostTask([this, syncPromise, accessibilityWindowId,
-        elementId, treeId, direction, requestId, callback]() {
-        HILOG_DEBUG("accountId[%{public}d], name[%{public}s]", accountId_, clientName_.c_str());
-        sptr<IAccessibilityElementOperator> elementOperator = nullptr;
-        RetError ret = GetElementOperator(accountId_, accessibilityWindowId, FOCUS_TYPE_INVALID,
-            clientName_, elementOperator, treeId);
-        if (ret != RET_OK) {
-            HILOG_ERROR("Get elementOperator failed! accessibilityWindowId[%{public}d]", accessibilityWindowId);
-            std::vector<AccessibilityElementInfo> infos = {};
-            callback->SetSearchElementInfoByAccessibilityIdResult(infos, requestId);
-            syncPromise->set_value(ret);
-            return;
-        }
-
-        auto& awm = Singleton<AccessibilityWindowManager>::GetInstance();
-        int64_t realElementId = awm.GetSceneBoardElementId(accessibilityWindowId, elementId);
-        Singleton<AccessibleAbilityManagerService>::GetInstance().AddRequestId(accessibilityWindowId, treeId,
-            requestId, callback);
-        elementOperator->FocusMoveSearch(realElementId, direction, requestId, callback);
-        syncPromise->set_value(RET_OK);
-        }, "FocusMoveSearch");
-    
-    ffrt::future_status wait = syncFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
-    if (wait != ffrt::future_status::ready) {
-        HILOG_ERROR("Failed to wait FocusMoveSearch result");
-        return RET_ERR_TIME_OUT;
-    }
-    return syncFuture.get();
+    HILOG_DEBUG("accountId[%{public}d], name[%{public}s]", accountId_, clientName_.c_str());
+    sptr<IAccessibilityElementOperator> elementOperator = nullptr;
+    RetError ret = GetElementOperator(accountId_, accessibilityWindowId, FOCUS_TYPE_INVALID, clientName_,
+        elementOperator, treeId);
+    if (ret != RET_OK) {
+        HILOG_ERROR("Get elementOperator failed! accessibilityWindowId[%{public}d]", accessibilityWindowId);
+        std::vector<AccessibilityElementInfo> infos = {};
+        callback->SetSearchElementInfoByAccessibilityIdResult(infos, requestId);
+        return ret;
+    }
+
+    auto& awm = Singleton<AccessibilityWindowManager>::GetInstance();
+    int64_t realElementId = awm.GetSceneBoardElementId(accessibilityWindowId, elementId);
+    Singleton<AccessibleAbilityManagerService>::GetInstance().AddRequestId(accessibilityWindowId, treeId,
+        requestId, callback);
+    elementOperator->FocusMoveSearch(realElementId, direction, requestId, callback);
+    return RET_OK;
 }
 
 void AccessibleAbilityChannel::SetKeyCodeToMmi(std::shared_ptr<MMI::KeyEvent>& keyEvent, const bool isPress,
@@ -337,10 +268,6 @@ RetError AccessibleAbilityChannel::ExecuteAction(const int32_t accessibilityWind
     HILOG_DEBUG("ExecuteAction elementId:%{public}" PRId64 " winId:%{public}d, action:%{public}d, requestId:%{public}d",
         elementId, accessibilityWindowId, action, requestId);
     Singleton<AccessibleAbilityManagerService>::GetInstance().PostDelayUnloadTask();
-    if (eventHandler_== nullptr) {
-        HILOG_ERROR("eventHandler_ is nullptr.");
-        return RET_ERR_NULLPTR;
-    }
     if (callback == nullptr) {
         HILOG_ERROR("callback is nullptr.");
         return RET_ERR_NULLPTR;
@@ -357,34 +284,21 @@ RetError AccessibleAbilityChannel::ExecuteAction(const int32_t accessibilityWind
         return RET_OK;
     }
     SetFocusWindowIdAndElementId(accessibilityWindowId, elementId, action);
-    std::shared_ptr<ffrt::promise<RetError>> syncPromise = std::make_shared<ffrt::promise<RetError>>();
-    ffrt::future syncFuture = syncPromise->get_future();
     int32_t treeId = AccessibleAbilityManagerService::GetTreeIdBySplitElementId(elementId);
-    eventHandler_->PostTask([this, syncPromise, accessibilityWindowId, elementId, treeId, action,
-        actionArguments, requestId, callback]() {
-        sptr<IAccessibilityElementOperator> elementOperator = nullptr;
-        RetError ret = GetElementOperator(accountId_, accessibilityWindowId, FOCUS_TYPE_INVALID, clientName_,
-            elementOperator, treeId);
-        if (ret != RET_OK) {
-            HILOG_ERROR("Get elementOperator failed! accessibilityWindowId[%{public}d]", accessibilityWindowId);
-            syncPromise->set_value(ret);
-            return;
-        }
-
-        auto& awm = Singleton<AccessibilityWindowManager>::GetInstance();
-        int64_t realElementId = awm.GetSceneBoardElementId(accessibilityWindowId, elementId);
-        Singleton<AccessibleAbilityManagerService>::GetInstance().AddRequestId(accessibilityWindowId, treeId,
-            requestId, callback);
-        elementOperator->ExecuteAction(realElementId, action, actionArguments, requestId, callback);
-        syncPromise->set_value(RET_OK);
-        }, "ExecuteAction");
-
-    ffrt::future_status wait = syncFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
-    if (wait != ffrt::future_status::ready) {
-        HILOG_ERROR("Failed to wait ExecuteAction result");
-        return RET_ERR_TIME_OUT;
-    }
-    return syncFuture.get();
+    sptr<IAccessibilityElementOperator> elementOperator = nullptr;
+    RetError ret = GetElementOperator(accountId_, accessibilityWindowId, FOCUS_TYPE_INVALID, clientName_,
+        elementOperator, treeId);
+    if (ret != RET_OK) {
+        HILOG_ERROR("Get elementOperator failed! accessibilityWindowId[%{public}d]", accessibilityWindowId);
+        return ret;
+    }
+
+    auto& awm = Singleton<AccessibilityWindowManager>::GetInstance();
+    int64_t realElementId = awm.GetSceneBoardElementId(accessibilityWindowId, elementId);
+    Singleton<AccessibleAbilityManagerService>::GetInstance().AddRequestId(accessibilityWindowId, treeId,
+        requestId, callback);
+    elementOperator->ExecuteAction(realElementId, action, actionArguments, requestId, callback);
+    return RET_OK;
 }
 
 void AccessibleAbilityChannel::SetFocusWindowIdAndElementId(const int32_t accessibilityWindowId,
@@ -404,43 +318,20 @@ RetError AccessibleAbilityChannel::GetWindow(const int32_t windowId, Accessibili
 {
     HILOG_DEBUG("windowId:%{public}d", windowId);
     Singleton<AccessibleAbilityManagerService>::GetInstance().PostDelayUnloadTask();
-    if (eventHandler_== nullptr) {
-        HILOG_ERROR("eventHandler_ is nullptr.");
-        return RET_ERR_NULLPTR;
+    sptr<AccessibleAbilityConnection> clientConnection = GetConnection(accountId_, clientName_);
+    if (!clientConnection) {
+        HILOG_ERROR("There is no client connection");
+        return RET_ERR_NO_CONNECTION;
     }
- 
-    std::shared_ptr<ffrt::promise<RetError>> syncPromise = std::make_shared<ffrt::promise<RetError>>();
-    std::shared_ptr<AccessibilityWindowInfo> tmpWindowInfo = std::make_shared<AccessibilityWindowInfo>(windowInfo);
-    ffrt::future syncFuture = syncPromise->get_future();
-    eventHandler_->PostTask([this, windowId, tmpWindowInfo, syncPromise]() {
-        HILOG_DEBUG("windowId:%{public}d", windowId);
-        sptr<AccessibleAbilityConnection> clientConnection = GetConnection(accountId_, clientName_);
-        if (!clientConnection) {
-            HILOG_ERROR("There is no client connection");
-            syncPromise->set_value(RET_ERR_NO_CONNECTION);
-            return;
-        }
-        if (!(clientConnection->GetAbilityInfo().GetCapabilityValues() & Capability::CAPABILITY_RETRIEVE)) {
-            HILOG_ERROR("AccessibleAbilityChannel::GetWindow failed: no capability");
-            syncPromise->set_value(RET_ERR_NO_CAPABILITY);
-            return;
-        }
-
-        if (Singleton<AccessibilityWindowManager>::GetInstance().GetAccessibilityWindow(windowId, *tmpWindowInfo)) {
-            syncPromise->set_value(RET_OK);
-        } else {
-            syncPromise->set_value(RET_ERR_NO_WINDOW_CONNECTION);
-        }
-        }, "GetWindow");
-
-    ffrt::future_status wait = syncFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
-    if (wait != ffrt::future_status::ready) {
-        HILOG_ERROR("Failed to wait GetWindow result");
-        return RET_ERR_TIME_OUT;
+    if (!(clientConnection->GetAbilityInfo().GetCapabilityValues() & Capability::CAPABILITY_RETRIEVE)) {
+        HILOG_ERROR("AccessibleAbilityChannel::GetWindow failed: no capability");
+        return RET_ERR_NO_CAPABILITY;
     }
 
-    windowInfo = *tmpWindowInfo;
-    return syncFuture.get();
+    if (!Singleton<AccessibilityWindowManager>::GetInstance().GetAccessibilityWindow(windowId, windowInfo)) {
+        return RET_ERR_NO_WINDOW_CONNECTION;
+    }
+    return RET_OK;
 }
 
 RetError AccessibleAbilityChannel::GetWindows(std::vector<AccessibilityWindowInfo> &windows)
@@ -466,53 +357,32 @@ RetError AccessibleAbilityChannel::GetWindowsByDisplayId(const uint64_t displayI
 
 RetError AccessibleAbilityChannel::GetWindows(uint64_t displayId, std::vector<AccessibilityWindowInfo> &windows) const
 {
-    if (eventHandler_== nullptr) {
-        HILOG_ERROR("eventHandler_ is nullptr.");
-        return RET_ERR_NULLPTR;
+    HILOG_DEBUG();
+    sptr<AccessibleAbilityConnection> clientConnection = GetConnection(accountId_, clientName_);
+    if (!clientConnection) {
+        HILOG_ERROR("There is no client connection");
+        return RET_ERR_NO_CONNECTION;
     }
 
-    std::shared_ptr<ffrt::promise<RetError>> syncPromise = std::make_shared<ffrt::promise<RetError>>();
-    auto tmpWindows = std::make_shared<std::vector<AccessibilityWindowInfo>>(windows);
-    ffrt::future syncFuture = syncPromise->get_future();
-    eventHandler_->PostTask([this, displayId, tmpWindows, syncPromise]() {
-        HILOG_DEBUG();
-        sptr<AccessibleAbilityConnection> clientConnection = GetConnection(accountId_, clientName_);
-        if (!clientConnection) {
-            HILOG_ERROR("There is no client connection");
-            syncPromise->set_value(RET_ERR_NO_CONNECTION);
-            return;
-        }
-
-        if (!(clientConnection->GetAbilityInfo().GetCapabilityValues() & Capability::CAPABILITY_RETRIEVE)) {
-            HILOG_ERROR("GetWindows failed: no capability");
-            syncPromise->set_value(RET_ERR_NO_CAPABILITY);
-            return;
-        }
+    if (!(clientConnection->GetAbilityInfo().GetCapabilityValues() & Capability::CAPABILITY_RETRIEVE)) {
+        HILOG_ERROR("GetWindows failed: no capability");
+        return RET_ERR_NO_CAPABILITY;
+    }
 
-        std::vector<AccessibilityWindowInfo> windowInfos =
-            Singleton<AccessibilityWindowManager>::GetInstance().GetAccessibilityWindows();
+    std::vector<AccessibilityWindowInfo> windowInfos =
+        Singleton<AccessibilityWindowManager>::GetInstance().GetAccessibilityWindows();
 #ifdef OHOS_BUILD_ENABLE_DISPLAY_MANAGER
-        for (auto &window : windowInfos) {
-            if (window.GetDisplayId() == displayId) {
-                tmpWindows->emplace_back(window);
-            }
+    for (auto &window : windowInfos) {
+        if (window.GetDisplayId() == displayId) {
+            windows.emplace_back(window);
         }
+    }
 #else
-        for (auto &window : windowInfos) {
-            tmpWindows->emplace_back(window);
-        }
-#endif
-        syncPromise->set_value(RET_OK);
-        }, "GetWindows");
-    
-    ffrt::future_status wait = syncFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
-    if (wait != ffrt::future_status::ready) {
-        HILOG_ERROR("Failed to wait GetWindows result");
-        return RET_ERR_TIME_OUT;
+    for (auto &window : windowInfos) {
+        windows.emplace_back(window);
     }
-
-    windows = *tmpWindows;
-    return syncFuture.get();
+#endif
+    return RET_OK;
 }
 
 void AccessibleAbilityChannel::SetOnKeyPressEventResult(const bool handled, const int32_t sequence)
@@ -536,7 +406,17 @@ void AccessibleAbilityChannel::SetOnKeyPressEventResult(const bool handled, cons
             HILOG_ERROR("There is no client connection");
             return;
         }
-        keyEventFilter->SetServiceOnKeyEventResult(*clientConnection, handled, sequence);
+
+        // The key event filter lives on the input runner.
+        std::shared_ptr<AAMSEventHandler> &inputHandler =
+            Singleton<AccessibleAbilityManagerService>::GetInstance().GetInputHandler();
+        if (!inputHandler) {
+            HILOG_ERROR("inputHandler is nullptr.");
+            return;
+        }
+        inputHandler->PostTask([keyEventFilter, clientConnection, handled, sequence]() {
+            keyEventFilter->SetServiceOnKeyEventResult(*clientConnection, handled, sequence);
+            }, "SetServiceOnKeyEventResult");
         }, "SetOnKeyPressEventResult");
 }
 
@@ -546,40 +426,29 @@ RetError AccessibleAbilityChannel::GetCursorPosition(const int32_t accessibility
     HILOG_DEBUG("GetCursorPosition :channel GetCursorPosition elementId: %{public}" PRId64 " winId: %{public}d",
         elementId, accessibilityWindowId);
     Singleton<AccessibleAbilityManagerService>::GetInstance().PostDelayUnloadTask();
-    if (eventHandler_== nullptr) {
-        HILOG_ERROR("eventHandler_ is nullptr.");
+
+    if (callback == nullptr) {
+        HILOG_ERROR("callback is nullptr.");
         return RET_ERR_NULLPTR;
     }
-    std::shared_ptr<ffrt::promise<RetError>> syncPromise = std::make_shared<ffrt::promise<RetError>>();
-    ffrt::future syncFuture = syncPromise->get_future();
+
     int32_t treeId = AccessibleAbilityManagerService::GetTreeIdBySplitElementId(elementId);
     HILOG_DEBUG("GetCursorPosition :channel GetCursorPosition treeId: %{public}d", treeId);
-    eventHandler_->PostTask([this, syncPromise, accessibilityWindowId, elementId, treeId,
-        requestId, callback]() {
-        HILOG_DEBUG("accountId[%{public}d], name[%{public}s]", accountId_, clientName_.c_str());
-        sptr<IAccessibilityElementOperator> elementOperator = nullptr;
-        RetError ret = GetElementOperator(accountId_, accessibilityWindowId, FOCUS_TYPE_INVALID, clientName_,
-            elementOperator, treeId);
-        if (ret != RET_OK) {
-            HILOG_ERROR("Get elementOperator failed! accessibilityWindowId[%{public}d]", accessibilityWindowId);
-            syncPromise->set_value(ret);
-            return;
-        }
-
-        auto& awm = Singleton<AccessibilityWindowManager>::GetInstance();
-        int64_t realElementId = awm.GetSceneBoardElementId(accessibilityWindowId, elementId);
-        Singleton<AccessibleAbilityManagerService>::GetInstance().AddRequestId(accessibilityWindowId, treeId,
-            requestId, callback);
-        elementOperator->GetCursorPosition(realElementId, requestId, callback);
-        syncPromise->set_value(RET_OK);
-        }, "GetCursorPosition");
-    
-    ffrt::future_status wait = syncFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
-    if (wait != ffrt::future_status::ready) {
-        HILOG_ERROR("Failed to wait GetCursorPosition result");
-        return RET_ERR_TIME_OUT;
-    }
-    return syncFuture.get();
+    HILOG_DEBUG("accountId[%{public}d], name[%{public}s]", accountId_, clientName_.c_str());
+    sptr<IAccessibilityElementOperator> elementOperator = nullptr;
+    RetError ret = GetElementOperator(accountId_, accessibilityWindowId, FOCUS_TYPE_INVALID, clientName_,
+        elementOperator, treeId);
+    if (ret != RET_OK) {
+        HILOG_ERROR("Get elementOperator failed! accessibilityWindowId[%{public}d]", accessibilityWindowId);
+        return ret;
+    }
+
+    auto& awm = Singleton<AccessibilityWindowManager>::GetInstance();
+    int64_t realElementId = awm.GetSceneBoardElementId(accessibilityWindowId, elementId);
+    Singleton<AccessibleAbilityManagerService>::GetInstance().AddRequestId(accessibilityWindowId, treeId,
+        requestId, callback);
+    elementOperator->GetCursorPosition(realElementId, requestId, callback);
+    return RET_OK;
 }
 
 RetError AccessibleAbilityChannel::SendSimulateGesture(
@@ -616,7 +485,18 @@ RetError AccessibleAbilityChannel::SendSimulateGesture(
             syncPromise->set_value(RET_ERR_NO_INJECTOR);
             return;
         }
-        touchEventInjector->InjectEvents(gesturePath);
+
+        // The touch event injector lives on the input runner.
+        std::shared_ptr<AAMSEventHandler> &inputHandler =
+            Singleton<AccessibleAbilityManagerService>::GetInstance().GetInputHandler();
+        if (!inputHandler) {
+            HILOG_ERROR("inputHandler is nullptr");
+            syncPromise->set_value(RET_ERR_NULLPTR);
+            return;
+        }
+        inputHandler->PostTask([touchEventInjector, gesturePath]() {
+            touchEventInjector->InjectEvents(gesturePath);
+            }, "InjectEvents");
         syncPromise->set_value(RET_OK);
         }, "SendSimulateGesture");
 
@@ -698,16 +578,15 @@ RetError AccessibleAbilityChannel::GetElementOperator(
         return RET_ERR_NULLPTR;
     }
     int32_t realId = Singleton<AccessibilityWindowManager>::GetInstance().ConvertToRealWindowId(windowId, focusType);
-    sptr<AccessibilityWindowConnection> connection =  nullptr;
-    connection = accountData->GetAccessibilityWindowConnection(realId);
-    if (connection == nullptr) {
+    std::shared_ptr<const ElementOperatorSnapshot> snapshot = accountData->GetElementOperatorSnapshot();
+    auto windowIter = snapshot->find(realId);
+    if (windowIter == snapshot->end()) {
         HILOG_ERROR("windowId[%{public}d] has no connection", realId);
         return RET_ERR_NO_WINDOW_CONNECTION;
     }
-    if (treeId <= 0) {
-        elementOperator = connection->GetProxy();
-    } else {
-        elementOperator = connection->GetCardProxy(treeId);
+    auto operatorIter = windowIter->second.find(treeId <= 0 ? 0 : treeId);
+    if (operatorIter != windowIter->second.end()) {
+        elementOperator = operatorIter->second;
     }
     if (!elementOperator) {
         HILOG_ERROR("The proxy of window connection is nullptr");
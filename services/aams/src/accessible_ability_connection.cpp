@@ -28,6 +28,8 @@ AccessibleAbilityConnection::AccessibleAbilityConnection(int32_t accountId, int3
     AccessibilityAbilityInfo &abilityInfo)
     : accountId_(accountId), connectionId_(connectionId), abilityInfo_(abilityInfo)
 {
+    std::vector<std::string> filterBundleNames = abilityInfo_.GetFilterBundleNames();
+    filterBundleNames_.insert(filterBundleNames.begin(), filterBundleNames.end());
     eventHandler_ = std::make_shared<AppExecFwk::EventHandler>(
         Singleton<AccessibleAbilityManagerService>::GetInstance().GetMainRunner());
 }
@@ -107,9 +109,8 @@ void AccessibleAbilityConnection::OnAccessibilityEvent(AccessibilityEventInfo &e
         return;
     }
 
-    std::vector<std::string> filterBundleNames = abilityInfo_.GetFilterBundleNames();
-    if (IsWantedEvent(eventInfo.GetEventType()) && (filterBundleNames.empty() || find(filterBundleNames.begin(),
-        filterBundleNames.end(), eventInfo.GetBundleName()) != filterBundleNames.end())) {
+    if (IsWantedEvent(eventInfo.GetEventType()) && (filterBundleNames_.empty() ||
+        filterBundleNames_.count(eventInfo.GetBundleName()))) {
         abilityClient_->OnAccessibilityEvent(eventInfo);
         HILOG_DEBUG("windowId[%{public}d] evtType[%{public}d] windowChangeType[%{public}d] GestureId[%{public}d]",
             eventInfo.GetWindowId(), eventInfo.GetEventType(), eventInfo.GetWindowChangeTypes(),
@@ -137,6 +138,8 @@ void AccessibleAbilityConnection::SetAbilityInfoTargetBundleName(const std::vect
 {
     HILOG_DEBUG();
     abilityInfo_.SetFilterBundleNames(targetBundleNames);
+    filterBundleNames_.clear();
+    filterBundleNames_.insert(targetBundleNames.begin(), targetBundleNames.end());
 }
 
 bool AccessibleAbilityConnection::IsWantedEvent(int32_t eventType)
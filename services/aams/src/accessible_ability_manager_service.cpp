@@ -15,10 +15,13 @@
 
 #include "accessible_ability_manager_service.h"
 
+#include <algorithm>
+#include <cerrno>
 #include <cinttypes>
 #include <new>
 #include <string>
 #include <unistd.h>
+#include <sys/resource.h>
 #include <functional>
 #include <hitrace_meter.h>
 
@@ -47,6 +50,7 @@ namespace Accessibility {
 namespace {
     const std::string AAMS_SERVICE_NAME = "AccessibleAbilityManagerService";
     const std::string AAMS_ACTION_RUNNER_NAME = "AamsActionRunner";
+    const std::string AAMS_INPUT_RUNNER_NAME = "AamsInputRunner";
     const std::string UI_TEST_BUNDLE_NAME = "ohos.uitest";
     const std::string UI_TEST_ABILITY_NAME = "uitestability";
     const std::string SYSTEM_PARAMETER_AAMS_NAME = "accessibility.config.ready";
@@ -88,6 +92,10 @@ namespace {
     const std::string TIMER_GET_ALL_CONFIG = "accessibility:getAllConfig";
     const std::string TIMER_REGISTER_CONFIG_OBSERVER = "accessibility:registerConfigObserver";
     constexpr int32_t XCOLLIE_TIMEOUT = 1; // s
+    constexpr int64_t SCROLLED_EVENT_COALESCING_WINDOW = 16; // ms, one frame
+    constexpr int64_t TEXT_UPDATE_EVENT_COALESCING_WINDOW = 50; // ms
+    constexpr int64_t CONTENT_UPDATE_EVENT_COALESCING_WINDOW = 100; // ms
+    constexpr int32_t INPUT_RUNNER_NICE_VALUE = -8; // the urgent display level, ahead of the other service threads
 } // namespace
 
 const bool REGISTER_RESULT =
@@ -154,6 +162,25 @@ void AccessibleAbilityManagerService::OnStart()
         }
     }
 
+    // Input events get their own thread so that touch latency does not depend on main runner load.
+    // The runner lives as long as the process, the interceptor and its transmitters keep handlers bound to it.
+    if (!inputRunner_) {
+        inputRunner_ = AppExecFwk::EventRunner::Create(AAMS_INPUT_RUNNER_NAME, AppExecFwk::ThreadMode::NEW_THREAD);
+        if (!inputRunner_) {
+            HILOG_ERROR("AccessibleAbilityManagerService::OnStart failed:create AAMS input runner failed");
+            return;
+        }
+    }
+
+    if (!inputHandler_) {
+        inputHandler_ = std::make_shared<AAMSEventHandler>(inputRunner_);
+        if (!inputHandler_) {
+            HILOG_ERROR("AccessibleAbilityManagerService::OnStart failed:create AAMS input handler failed");
+            return;
+        }
+        SetInputRunnerPriority();
+    }
+
     SetParameter(SYSTEM_PARAMETER_AAMS_NAME.c_str(), "false");
 
     HILOG_DEBUG("AddAbilityListener!");
@@ -168,6 +195,16 @@ void AccessibleAbilityManagerService::OnStart()
     accessibilitySettings_->RegisterSettingsHandler(handler_);
 }
 
+void AccessibleAbilityManagerService::SetInputRunnerPriority()
+{
+    inputHandler_->PostTask([]() {
+        // EventRunner has no priority option, raise the nice value of its thread instead.
+        if (setpriority(PRIO_PROCESS, static_cast<id_t>(gettid()), INPUT_RUNNER_NICE_VALUE) != 0) {
+            HILOG_WARN("set input runner priority failed, errno: %{public}d", errno);
+        }
+        }, "SetInputRunnerPriority", 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+}
+
 void AccessibleAbilityManagerService::OnStop()
 {
     HILOG_INFO("stop AccessibleAbilityManagerService");
@@ -185,6 +222,11 @@ void AccessibleAbilityManagerService::OnStop()
         Singleton<AccessibilityDisplayManager>::GetInstance().UnregisterDisplayListener();
         Singleton<AccessibilityWindowManager>::GetInstance().DeregisterWindowListener();
 
+        sptr<AccessibilityAccountData> accountData = a11yAccountsData_.GetAccountData(currentAccountId_);
+        if (accountData && accountData->GetConfig()) {
+            accountData->GetConfig()->FlushPendingSettings();
+        }
+
         currentAccountId_ = -1;
         a11yAccountsData_.Clear();
         stateObservers_.Clear();
@@ -368,21 +410,83 @@ RetError AccessibleAbilityManagerService::SendEvent(const AccessibilityEventInfo
     UpdateAccessibilityWindowStateByEvent(uiEvent);
     handler_->PostTask([this, uiEvent]() {
         HILOG_DEBUG();
-        sptr<AccessibilityAccountData> accountData = GetCurrentAccountData();
-        if (!accountData) {
-            HILOG_ERROR("accountData is nullptr.");
-            return;
+        CoalesceEvent(uiEvent);
+        }, "TASK_SEND_EVENT");
+    return RET_OK;
+}
+
+RetError AccessibleAbilityManagerService::SendEvents(const std::vector<AccessibilityEventInfo> &uiEvents,
+    const int32_t flag)
+{
+    HILOG_DEBUG("size[%{public}zu]", uiEvents.size());
+    RetError result = RET_OK;
+    for (auto &uiEvent : uiEvents) {
+        RetError ret = SendEvent(uiEvent, flag);
+        if (ret != RET_OK) {
+            result = ret;
         }
+    }
+    return result;
+}
 
-        const_cast<AccessibilityEventInfo&>(uiEvent).SetTimeStamp(Utils::GetSystemTime());
-        map<string, sptr<AccessibleAbilityConnection>> abilities = accountData->GetConnectedA11yAbilities();
-        for (auto &ability : abilities) {
-            if (ability.second) {
-                ability.second->OnAccessibilityEvent(const_cast<AccessibilityEventInfo&>(uiEvent));
+void AccessibleAbilityManagerService::CoalesceEvent(const AccessibilityEventInfo &uiEvent)
+{
+    std::vector<AccessibilityEventInfo> readyEvents;
+    int64_t window = eventCoalescer_.GetWindow(uiEvent.GetEventType());
+    if (window <= 0) {
+        // Deliver what the window is holding first, the abilities must see its events in order.
+        eventCoalescer_.TakeEvents(uiEvent.GetWindowId(), readyEvents);
+        eventCoalescer_.CountPassThrough();
+        readyEvents.push_back(uiEvent);
+    } else if (eventCoalescer_.HoldEvent(uiEvent, readyEvents)) {
+        int32_t windowId = uiEvent.GetWindowId();
+        handler_->PostTask([this, windowId]() {
+            // Flush every event the window holds, a held event of another type must not be overtaken.
+            std::vector<AccessibilityEventInfo> events;
+            eventCoalescer_.TakeEvents(windowId, events);
+            for (auto &event : events) {
+                DispatchEvent(event);
             }
-        }
-        }, "TASK_SEND_EVENT");
-    return RET_OK;
+            }, "TASK_FLUSH_COALESCED_EVENT", window);
+    }
+
+    for (auto &event : readyEvents) {
+        DispatchEvent(event);
+    }
+}
+
+void AccessibleAbilityManagerService::DispatchEvent(AccessibilityEventInfo &uiEvent)
+{
+    sptr<AccessibilityAccountData> accountData = GetCurrentAccountData();
+    if (!accountData) {
+        HILOG_ERROR("accountData is nullptr.");
+        return;
+    }
+
+    uiEvent.SetTimeStamp(Utils::GetSystemTime());
+    std::vector<sptr<AccessibleAbilityConnection>> subscribers;
+    accountData->GetEventSubscribers(static_cast<uint32_t>(uiEvent.GetEventType()), subscribers);
+    for (auto &subscriber : subscribers) {
+        subscriber->OnAccessibilityEvent(uiEvent);
+    }
+}
+
+void AccessibleAbilityManagerService::SetEventCoalescingWindow(const EventType eventType, const int64_t window)
+{
+    if (!handler_) {
+        HILOG_ERROR("handler_ is nullptr.");
+        return;
+    }
+
+    handler_->PostTask([this, eventType, window]() {
+        HILOG_INFO("eventType[%{public}u] window[%{public}" PRId64 "]", static_cast<uint32_t>(eventType), window);
+        eventCoalescer_.SetWindow(eventType, window);
+        }, "TASK_SET_EVENT_COALESCING_WINDOW");
+}
+
+void AccessibleAbilityManagerService::GetEventCoalescingStats(EventCoalescingStats& stats)
+{
+    eventCoalescer_.GetStats(stats);
 }
 
 uint32_t AccessibleAbilityManagerService::RegisterStateObserver(
@@ -860,6 +964,7 @@ RetError AccessibleAbilityManagerService::RegisterElementOperatorChildWork(const
         } else {
             oldConnection->SetCardProxy(treeId, operation);
             SetTokenIdMapAndRootParentId(oldConnection, treeId, nodeId, tokenId);
+            accountData->UpdateElementOperatorSnapshot();
         }
     }
     return RET_OK;
@@ -1031,6 +1136,7 @@ RetError AccessibleAbilityManagerService::DeregisterElementOperator(int32_t wind
         auto object = connection->GetCardProxy(treeId)->AsObject();
         if (object) {
             RemoveTreeDeathRecipient(windowId, treeId, connection);
+            accountData->UpdateElementOperatorSnapshot();
         }
         }, "TASK_DEREGISTER_ELEMENT_OPERATOR");
     return RET_OK;
@@ -1907,16 +2013,16 @@ bool AccessibleAbilityManagerService::GetParentElementRecursively(int32_t window
 void AccessibleAbilityManagerService::FindInnerWindowId(const AccessibilityEventInfo &event, int32_t& windowId)
 {
     HILOG_DEBUG();
-    auto mapTable = Singleton<AccessibilityWindowManager>::GetInstance().sceneBoardElementIdMap_.GetAllPairs();
+    auto& elementIdMap = Singleton<AccessibilityWindowManager>::GetInstance().sceneBoardElementIdMap_;
     int64_t elementId = event.GetAccessibilityId();
+    std::vector<int64_t> walkedElementIds;
     while (1) {
-        for (auto iter = mapTable.begin(); iter != mapTable.end(); iter++) {
-            if (elementId == iter->second) {
-                windowId = iter->first;
-                HILOG_DEBUG("inner windowId %{public}d", windowId);
-                return;
-            }
+        if (elementIdMap.GetInnerWindowId(elementId, windowId)) {
+            elementIdMap.InsertElements(windowId, walkedElementIds);
+            HILOG_DEBUG("inner windowId %{public}d", windowId);
+            return;
         }
+        walkedElementIds.push_back(elementId);
 
         std::vector<AccessibilityElementInfo> infos = {};
         if (GetParentElementRecursively(event.GetWindowId(), elementId, infos) == false || infos.size() == 0) {
@@ -1933,24 +2039,50 @@ void AccessibleAbilityManagerService::FindInnerWindowId(const AccessibilityEvent
     }
 }
 
+void AccessibleAbilityManagerService::FindInnerWindowIdAsync(const AccessibilityEventInfo &event,
+    const uint64_t sequence)
+{
+    if (!actionHandler_) {
+        HILOG_ERROR("actionHandler_ is nullptr.");
+        return;
+    }
+
+    actionHandler_->PostTask([this, event, sequence]() {
+        int32_t windowId = event.GetWindowId();
+        FindInnerWindowId(event, windowId);
+        std::lock_guard<ffrt::mutex> lock(windowStateMutex_);
+        if (sequence != windowStateSequence_) {
+            HILOG_DEBUG("window state is updated by a later event");
+            return;
+        }
+        Singleton<AccessibilityWindowManager>::GetInstance().SetActiveWindow(windowId, false);
+        Singleton<AccessibilityWindowManager>::GetInstance().SetAccessibilityFocusedWindow(windowId);
+        }, "FindInnerWindowId");
+}
+
 void AccessibleAbilityManagerService::UpdateAccessibilityWindowStateByEvent(const AccessibilityEventInfo &event)
 {
     EventType evtType = event.GetEventType();
     HILOG_DEBUG("windowId is %{public}d", event.GetWindowId());
     int32_t windowId = event.GetWindowId();
-    if (windowId == 1 && (evtType == TYPE_VIEW_HOVER_ENTER_EVENT || evtType == TYPE_VIEW_ACCESSIBILITY_FOCUSED_EVENT)) {
-        FindInnerWindowId(event, windowId);
-    }
-
     switch (evtType) {
         case TYPE_VIEW_HOVER_ENTER_EVENT:
         case TYPE_VIEW_ACCESSIBILITY_FOCUSED_EVENT:
-            Singleton<AccessibilityWindowManager>::GetInstance().SetActiveWindow(windowId, false);
-            Singleton<AccessibilityWindowManager>::GetInstance().SetAccessibilityFocusedWindow(windowId);
             break;
         default:
-            break;
+            return;
     }
+
+    auto& elementIdMap = Singleton<AccessibilityWindowManager>::GetInstance().sceneBoardElementIdMap_;
+    std::lock_guard<ffrt::mutex> lock(windowStateMutex_);
+    windowStateSequence_++;
+    // an element not indexed yet is resolved by walking its parents off the event delivery path
+    if (windowId == 1 && !elementIdMap.GetInnerWindowId(event.GetAccessibilityId(), windowId)) {
+        FindInnerWindowIdAsync(event, windowStateSequence_);
+        return;
+    }
+    Singleton<AccessibilityWindowManager>::GetInstance().SetActiveWindow(windowId, false);
+    Singleton<AccessibilityWindowManager>::GetInstance().SetAccessibilityFocusedWindow(windowId);
 }
 
 void AccessibleAbilityManagerService::UpdateAccessibilityManagerService()
@@ -2950,76 +3082,232 @@ int32_t AccessibleAbilityManagerService::GetTreeIdBySplitElementId(const int64_t
 void AccessibleAbilityManagerService::AddRequestId(int32_t windowId, int32_t treeId, int32_t requestId,
     sptr<IAccessibilityElementOperatorCallback> callback)
 {
-    std::lock_guard<ffrt::mutex> lock(mutex_);
     HILOG_DEBUG("Add windowId: %{public}d treeId: %{public}d requestId: %{public}d", windowId, treeId, requestId);
-    if (!windowRequestIdMap_.count(windowId)) {
-        windowRequestIdMap_[windowId] = {};
+    requestIdRegistry_.AddRequestId(windowId, treeId, requestId, callback);
+}
+
+void AccessibleAbilityManagerService::RemoveRequestId(int32_t requestId)
+{
+    HILOG_DEBUG("RemoveRequestId requestId: %{public}d", requestId);
+    requestIdRegistry_.RemoveRequestId(requestId);
+}
+
+void AccessibleAbilityManagerService::GetPendingRequestNums(std::map<int32_t, size_t>& requestNums)
+{
+    requestIdRegistry_.GetPendingRequestNums(requestNums);
+}
+
+void AccessibleAbilityManagerService::StopCallbackWait(int32_t windowId)
+{
+    HILOG_INFO("StopCallbackWait start windowId: %{public}d", windowId);
+    std::vector<std::pair<int32_t, sptr<IAccessibilityElementOperatorCallback>>> callbacks;
+    requestIdRegistry_.RemoveRequestIds(windowId, callbacks);
+    for (auto& callback : callbacks) {
+        HILOG_DEBUG("stop callback wait windowId: %{public}d, requestId: %{public}d", windowId, callback.first);
+        if (callback.second != nullptr) {
+            callback.second->SetExecuteActionResult(false, callback.first);
+        }
     }
-    if (!windowRequestIdMap_[windowId].count(treeId)) {
-        windowRequestIdMap_[windowId][treeId] = {};
+}
+
+void AccessibleAbilityManagerService::StopCallbackWait(int32_t windowId, int32_t treeId)
+{
+    HILOG_INFO("StopCallbackWait start windowId: %{public}d treeId: %{public}d", windowId, treeId);
+    std::vector<std::pair<int32_t, sptr<IAccessibilityElementOperatorCallback>>> callbacks;
+    requestIdRegistry_.RemoveRequestIds(windowId, treeId, callbacks);
+    for (auto& callback : callbacks) {
+        HILOG_DEBUG("stop callback wait windowId: %{public}d, requestId: %{public}d", windowId, callback.first);
+        if (callback.second != nullptr) {
+            callback.second->SetExecuteActionResult(false, callback.first);
+        }
     }
-    if (!windowRequestIdMap_[windowId][treeId].count(requestId)) {
-        windowRequestIdMap_[windowId][treeId].insert(requestId);
-        requestIdMap_[requestId] = callback;
+}
+
+AccessibleAbilityManagerService::EventCoalescer::EventCoalescer()
+{
+    windows_[TYPE_VIEW_SCROLLED_EVENT] = SCROLLED_EVENT_COALESCING_WINDOW;
+    windows_[TYPE_VIEW_TEXT_UPDATE_EVENT] = TEXT_UPDATE_EVENT_COALESCING_WINDOW;
+    windows_[TYPE_PAGE_CONTENT_UPDATE] = CONTENT_UPDATE_EVENT_COALESCING_WINDOW;
+}
+
+int64_t AccessibleAbilityManagerService::EventCoalescer::GetWindow(const EventType eventType) const
+{
+    auto iter = windows_.find(eventType);
+    if (iter == windows_.end()) {
+        return 0;
     }
+    return iter->second;
 }
 
-void AccessibleAbilityManagerService::RemoveRequestId(int32_t requestId)
+void AccessibleAbilityManagerService::EventCoalescer::SetWindow(const EventType eventType, const int64_t window)
+{
+    if (window <= 0) {
+        windows_.erase(eventType);
+        return;
+    }
+    windows_[eventType] = window;
+}
+
+bool AccessibleAbilityManagerService::EventCoalescer::HoldEvent(const AccessibilityEventInfo& event,
+    std::vector<AccessibilityEventInfo>& readyEvents)
+{
+    receivedCount_++;
+    auto key = std::make_pair(event.GetWindowId(), static_cast<uint32_t>(event.GetEventType()));
+    auto iter = pendingEvents_.find(key);
+    if (iter == pendingEvents_.end()) {
+        pendingEvents_.emplace(key, HeldEvent { nextSequence_++, event });
+        return true;
+    }
+
+    if (iter->second.event.GetAccessibilityId() != event.GetAccessibilityId()) {
+        // Events of another component are not redundant, deliver what the window holds and keep the new one.
+        TakeEvents(event.GetWindowId(), readyEvents);
+        pendingEvents_.emplace(key, HeldEvent { nextSequence_++, event });
+        return false;
+    }
+
+    // Keep the latest state, but the text before the whole burst.
+    std::string beforeText = iter->second.event.GetBeforeText();
+    iter->second.sequence = nextSequence_++;
+    iter->second.event = event;
+    iter->second.event.SetBeforeText(beforeText);
+    mergedCount_++;
+    return false;
+}
+
+void AccessibleAbilityManagerService::EventCoalescer::TakeEvents(const int32_t windowId,
+    std::vector<AccessibilityEventInfo>& events)
+{
+    std::vector<HeldEvent> heldEvents;
+    auto iter = pendingEvents_.lower_bound(std::make_pair(windowId, 0u));
+    while (iter != pendingEvents_.end() && iter->first.first == windowId) {
+        heldEvents.push_back(std::move(iter->second));
+        iter = pendingEvents_.erase(iter);
+        deliveredCount_++;
+    }
+    std::sort(heldEvents.begin(), heldEvents.end(), [](const HeldEvent& lhs, const HeldEvent& rhs) {
+        return lhs.sequence < rhs.sequence;
+    });
+    for (auto& heldEvent : heldEvents) {
+        events.push_back(std::move(heldEvent.event));
+    }
+}
+
+void AccessibleAbilityManagerService::EventCoalescer::CountPassThrough()
+{
+    passThroughCount_++;
+}
+
+void AccessibleAbilityManagerService::EventCoalescer::GetStats(EventCoalescingStats& stats) const
+{
+    stats.receivedCount = receivedCount_.load();
+    stats.mergedCount = mergedCount_.load();
+    stats.deliveredCount = deliveredCount_.load();
+    stats.passThroughCount = passThroughCount_.load();
+}
+
+void AccessibleAbilityManagerService::RequestIdRegistry::AddRequestId(int32_t windowId, int32_t treeId,
+    int32_t requestId, const sptr<IAccessibilityElementOperatorCallback>& callback)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
-    HILOG_DEBUG("RemoveRequestId requestId: %{public}d", requestId);
-    for (auto &window : windowRequestIdMap_) {
-        for (auto &tree : window.second) {
-            auto it = tree.second.find(requestId);
-            if (it != tree.second.end()) {
-                HILOG_DEBUG("tree.second.erase requestId:%{public}d", requestId);
-                tree.second.erase(it);
-            }
-            auto ite = requestIdMap_.find(requestId);
-            if (ite != requestIdMap_.end()) {
-                HILOG_DEBUG("requestIdMap_.erase requestId:%{public}d", requestId);
-                requestIdMap_.erase(ite);
-            }
+    auto iter = requests_.find(requestId);
+    if (iter != requests_.end()) {
+        if (iter->second.windowId == windowId && iter->second.treeId == treeId) {
+            return;
         }
+        // the request id is reused by another window, the latest callback wins
+        EraseRequestId(requestId, iter->second);
+        requests_.erase(iter);
     }
+    requests_.emplace(requestId, RequestInfo { windowId, treeId, callback });
+    windowRequestIds_[windowId][treeId].insert(requestId);
 }
 
-void AccessibleAbilityManagerService::StopCallbackWait(int32_t windowId)
+void AccessibleAbilityManagerService::RequestIdRegistry::RemoveRequestId(int32_t requestId)
 {
-    HILOG_INFO("StopCallbackWait start windowId: %{public}d", windowId);
-    if (!windowRequestIdMap_.count(windowId)) {
-        HILOG_DEBUG("windowId not exists");
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto iter = requests_.find(requestId);
+    if (iter == requests_.end()) {
+        return;
+    }
+    EraseRequestId(requestId, iter->second);
+    requests_.erase(iter);
+}
+
+void AccessibleAbilityManagerService::RequestIdRegistry::EraseRequestId(int32_t requestId, const RequestInfo& info)
+{
+    auto windowIter = windowRequestIds_.find(info.windowId);
+    if (windowIter == windowRequestIds_.end()) {
         return;
     }
-    for (auto iter = windowRequestIdMap_[windowId].begin(); iter != windowRequestIdMap_[windowId].end(); ++iter) {
-        HILOG_DEBUG("stop callback wait windowId: %{public}d, treeId: %{public}d", windowId, iter->first);
-        StopCallbackWait(windowId, iter->first);
+    auto treeIter = windowIter->second.find(info.treeId);
+    if (treeIter == windowIter->second.end()) {
+        return;
+    }
+    treeIter->second.erase(requestId);
+    if (treeIter->second.empty()) {
+        windowIter->second.erase(treeIter);
+    }
+    if (windowIter->second.empty()) {
+        windowRequestIds_.erase(windowIter);
     }
 }
 
-void AccessibleAbilityManagerService::StopCallbackWait(int32_t windowId, int32_t treeId)
+void AccessibleAbilityManagerService::RequestIdRegistry::RemoveRequestIds(int32_t windowId, int32_t treeId,
+    std::vector<std::pair<int32_t, sptr<IAccessibilityElementOperatorCallback>>>& callbacks)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
-    HILOG_INFO("StopCallbackWait start windowId: %{public}d treeId: %{public}d", windowId, treeId);
-    if (!windowRequestIdMap_.count(windowId)) {
+    auto windowIter = windowRequestIds_.find(windowId);
+    if (windowIter == windowRequestIds_.end()) {
+        return;
+    }
+    auto treeIter = windowIter->second.find(treeId);
+    if (treeIter == windowIter->second.end()) {
         return;
     }
-    if (!windowRequestIdMap_[windowId].count(treeId)) {
+    for (auto requestId : treeIter->second) {
+        auto iter = requests_.find(requestId);
+        if (iter != requests_.end()) {
+            callbacks.emplace_back(requestId, iter->second.callback);
+            requests_.erase(iter);
+        }
+    }
+    windowIter->second.erase(treeIter);
+    if (windowIter->second.empty()) {
+        windowRequestIds_.erase(windowIter);
+    }
+}
+
+void AccessibleAbilityManagerService::RequestIdRegistry::RemoveRequestIds(int32_t windowId,
+    std::vector<std::pair<int32_t, sptr<IAccessibilityElementOperatorCallback>>>& callbacks)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto windowIter = windowRequestIds_.find(windowId);
+    if (windowIter == windowRequestIds_.end()) {
+        HILOG_DEBUG("windowId not exists");
         return;
     }
-    auto requestIds = windowRequestIdMap_[windowId][treeId];
-    for (auto requestId = requestIds.begin(); requestId != requestIds.end();) {
-        HILOG_DEBUG("stop callback wait windowId: %{public}d, requestId: %{public}d", windowId, *requestId);
-        auto iter = requestIdMap_.find(*requestId);
-        if (iter != requestIdMap_.end()) {
-            HILOG_DEBUG("requestIdMap_ set callback and erase requestId:%{public}d", *requestId);
-            sptr<IAccessibilityElementOperatorCallback> callback = requestIdMap_[*requestId];
-            if (callback != nullptr) {
-                callback->SetExecuteActionResult(false, *requestId);
+    for (auto& tree : windowIter->second) {
+        for (auto requestId : tree.second) {
+            auto iter = requests_.find(requestId);
+            if (iter != requests_.end()) {
+                callbacks.emplace_back(requestId, iter->second.callback);
+                requests_.erase(iter);
             }
-            requestIdMap_.erase(iter);
         }
-        requestId = requestIds.erase(requestId);
+    }
+    windowRequestIds_.erase(windowIter);
+}
+
+void AccessibleAbilityManagerService::RequestIdRegistry::GetPendingRequestNums(std::map<int32_t, size_t>& requestNums)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    for (auto& window : windowRequestIds_) {
+        size_t requestNum = 0;
+        for (auto& tree : window.second) {
+            requestNum += tree.second.size();
+        }
+        requestNums[window.first] = requestNum;
     }
 }
 
@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <mutex>
+#include "accessibility_account_data.h"
+#include "mock_accessibility_element_operator_proxy.h"
+#include "mock_accessibility_element_operator_stub.h"
+#include "mock_accessible_ability_connection.h"
+
+using namespace OHOS;
+using namespace OHOS::Accessibility;
+
+namespace {
+    // Allocations made by the calling thread, counted by the replaced operator new below.
+    thread_local uint64_t g_allocCount = 0;
+}
+
+void* operator new(std::size_t size)
+{
+    g_allocCount++;
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr) {
+        std::abort();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t size) noexcept
+{
+    (void)size;
+    std::free(ptr);
+}
+
+namespace {
+    constexpr int32_t ACCOUNT_ID = 100;
+    constexpr int32_t CHURN_WINDOW_ID = 10000;
+    constexpr int64_t WRITE_INTERVAL = 64;
+
+    class AccessibilityAccountDataTest : public benchmark::Fixture {
+    public:
+        AccessibilityAccountDataTest()
+        {
+            Iterations(iterations);
+            Repetitions(repetitions);
+            ReportAggregatesOnly();
+        }
+
+        ~AccessibilityAccountDataTest() override = default;
+
+        void SetUp(const ::benchmark::State &state) override;
+        void TearDown(const ::benchmark::State &) override;
+
+    protected:
+        void ReportAllocations(benchmark::State &state, const uint64_t allocCount);
+        void AddWindowConnection(const int32_t windowId);
+
+        const int32_t repetitions = 3;
+        const int32_t iterations = 100000;
+        std::mutex setUpMutex_;
+        int64_t connectionNum_ = 0;
+        sptr<AccessibilityAccountData> accountData_ = nullptr;
+        sptr<IAccessibilityElementOperator> operation_ = nullptr;
+    };
+
+    void AccessibilityAccountDataTest::SetUp(const ::benchmark::State &state)
+    {
+        // Every thread of a run calls SetUp, the account data is shared by all of them.
+        std::lock_guard<std::mutex> lock(setUpMutex_);
+        if (accountData_ != nullptr && connectionNum_ == state.range(0)) {
+            return;
+        }
+        connectionNum_ = state.range(0);
+        accountData_ = new AccessibilityAccountData(ACCOUNT_ID);
+        sptr<AccessibilityElementOperatorStub> stub = new MockAccessibilityElementOperatorStub();
+        operation_ = new MockAccessibilityElementOperatorProxy(stub);
+        for (int64_t i = 0; i < connectionNum_; i++) {
+            AccessibilityAbilityInitParams initParams;
+            AccessibilityAbilityInfo abilityInfo(initParams);
+            sptr<AccessibleAbilityConnection> connection =
+                new MockAccessibleAbilityConnection(ACCOUNT_ID, static_cast<int32_t>(i), abilityInfo);
+            connection->GetElementName().SetBundleName("com.example.benchmark" + std::to_string(i));
+            connection->GetElementName().SetAbilityName("AccessibilityExtAbility");
+            accountData_->AddConnectedAbility(connection);
+            AddWindowConnection(static_cast<int32_t>(i));
+        }
+    }
+
+    void AccessibilityAccountDataTest::TearDown(const ::benchmark::State &)
+    {
+    }
+
+    void AccessibilityAccountDataTest::AddWindowConnection(const int32_t windowId)
+    {
+        sptr<AccessibilityWindowConnection> connection =
+            new AccessibilityWindowConnection(windowId, operation_, ACCOUNT_ID);
+        accountData_->AddAccessibilityWindowConnection(windowId, connection);
+    }
+
+    void AccessibilityAccountDataTest::ReportAllocations(benchmark::State &state, const uint64_t allocCount)
+    {
+        state.counters["allocs"] = benchmark::Counter(static_cast<double>(g_allocCount - allocCount),
+            benchmark::Counter::kAvgIterations);
+    }
+
+    /**
+     * @tc.name: ConnectedAbilitiesCopyTestCase
+     * @tc.desc: Testcase for copying the connected abilities as the event and key paths used to do.
+     * @tc.type: PERF
+     * @tc.require: Issue Number
+     */
+    BENCHMARK_DEFINE_F(AccessibilityAccountDataTest, ConnectedAbilitiesCopyTestCase)(
+        benchmark::State &state)
+    {
+        uint64_t allocCount = g_allocCount;
+        while (state.KeepRunning()) {
+            std::map<std::string, sptr<AccessibleAbilityConnection>> connections =
+                accountData_->GetConnectedA11yAbilities();
+            benchmark::DoNotOptimize(connections);
+        }
+        ReportAllocations(state, allocCount);
+    }
+
+    /**
+     * @tc.name: ConnectedAbilitiesSnapshotTestCase
+     * @tc.desc: Testcase for reading the connected abilities through the shared snapshot.
+     * @tc.type: PERF
+     * @tc.require: Issue Number
+     */
+    BENCHMARK_DEFINE_F(AccessibilityAccountDataTest, ConnectedAbilitiesSnapshotTestCase)(
+        benchmark::State &state)
+    {
+        uint64_t allocCount = g_allocCount;
+        while (state.KeepRunning()) {
+            std::shared_ptr<const AbilityConnectionMap> connections =
+                accountData_->GetConnectedA11yAbilitiesSnapshot();
+            benchmark::DoNotOptimize(connections);
+        }
+        ReportAllocations(state, allocCount);
+    }
+
+    /**
+     * @tc.name: WindowConnectionLookupTestCase
+     * @tc.desc: Testcase for looking up window connections and their element operators.
+     * @tc.type: PERF
+     * @tc.require: Issue Number
+     */
+    BENCHMARK_DEFINE_F(AccessibilityAccountDataTest, WindowConnectionLookupTestCase)(
+        benchmark::State &state)
+    {
+        uint64_t allocCount = g_allocCount;
+        int32_t windowId = 0;
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(accountData_->GetAccessibilityWindowConnection(windowId));
+            benchmark::DoNotOptimize(accountData_->GetElementOperatorSnapshot());
+            windowId = (windowId + 1) % static_cast<int32_t>(connectionNum_);
+        }
+        ReportAllocations(state, allocCount);
+    }
+
+    /**
+     * @tc.name: ConnectionChurnTestCase
+     * @tc.desc: Testcase for readers running while windows keep connecting and disconnecting.
+     * @tc.type: PERF
+     * @tc.require: Issue Number
+     */
+    BENCHMARK_DEFINE_F(AccessibilityAccountDataTest, ConnectionChurnTestCase)(
+        benchmark::State &state)
+    {
+        uint64_t allocCount = g_allocCount;
+        int64_t count = 0;
+        while (state.KeepRunning()) {
+            if (++count % WRITE_INTERVAL == 0) {
+                AddWindowConnection(CHURN_WINDOW_ID);
+                accountData_->RemoveAccessibilityWindowConnection(CHURN_WINDOW_ID);
+            }
+            benchmark::DoNotOptimize(accountData_->GetConnectedA11yAbilitiesSnapshot());
+            benchmark::DoNotOptimize(accountData_->GetAccessibilityWindowConnection(0));
+        }
+        ReportAllocations(state, allocCount);
+    }
+
+    BENCHMARK_REGISTER_F(AccessibilityAccountDataTest, ConnectedAbilitiesCopyTestCase)
+        ->Arg(8)->Arg(64)->Threads(1)->Threads(4)->Threads(8)->UseRealTime();
+    BENCHMARK_REGISTER_F(AccessibilityAccountDataTest, ConnectedAbilitiesSnapshotTestCase)
+        ->Arg(8)->Arg(64)->Threads(1)->Threads(4)->Threads(8)->UseRealTime();
+    BENCHMARK_REGISTER_F(AccessibilityAccountDataTest, WindowConnectionLookupTestCase)
+        ->Arg(8)->Arg(64)->Threads(1)->Threads(4)->Threads(8)->UseRealTime();
+    BENCHMARK_REGISTER_F(AccessibilityAccountDataTest, ConnectionChurnTestCase)
+        ->Arg(8)->Arg(64)->Threads(1)->Threads(4)->Threads(8)->UseRealTime();
+}
+
+BENCHMARK_MAIN();
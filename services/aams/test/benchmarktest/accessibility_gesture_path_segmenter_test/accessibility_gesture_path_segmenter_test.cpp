@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include "accessibility_gesture_path_segmenter.h"
+
+using namespace OHOS;
+using namespace OHOS::Accessibility;
+
+namespace {
+    // Allocations made by the calling thread, counted by the replaced operator new below.
+    thread_local uint64_t g_allocCount = 0;
+}
+
+void* operator new(std::size_t size)
+{
+    g_allocCount++;
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr) {
+        std::abort();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t size) noexcept
+{
+    (void)size;
+    std::free(ptr);
+}
+
+namespace {
+    constexpr float EPSINON = 0.0001f;
+    constexpr float START_X = 200.0f;
+    constexpr float START_Y = 1800.0f;
+    constexpr float MOVE_STEP = 2.0f; // px per move, a slow finger
+    constexpr int32_t JITTER_PERIOD = 7;
+    constexpr float JITTER = 1.0f;
+    constexpr double NS_PER_US = 1000.0;
+
+    /**
+     * The segmentation the recognizer ran over the whole route once the finger lifted.
+     */
+    std::vector<Pointer> GetPointerPath(std::vector<Pointer> &route)
+    {
+        std::vector<Pointer> pointerPath;
+        Pointer firstSeparation = route[0];
+        Pointer nextPoint;
+        Pointer newSeparation;
+        float xUnitVector = 0;
+        float yUnitVector = 0;
+        float xVector = 0;
+        float yVector = 0;
+        float vectorLength = 0;
+        int32_t numSinceFirstSep = 0;
+
+        pointerPath.push_back(firstSeparation);
+        for (size_t i = 1; i < route.size(); i++) {
+            nextPoint = route[i];
+            if (numSinceFirstSep > 0) {
+                xVector = xUnitVector / numSinceFirstSep;
+                yVector = yUnitVector / numSinceFirstSep;
+                newSeparation.px_ = vectorLength * xVector + firstSeparation.px_;
+                newSeparation.py_ = vectorLength * yVector + firstSeparation.py_;
+
+                float xNextUnitVector = nextPoint.px_ - newSeparation.px_;
+                float yNextUnitVector = nextPoint.py_ - newSeparation.py_;
+                float nextVectorLength = hypot(xNextUnitVector, yNextUnitVector);
+                if (nextVectorLength > EPSINON) {
+                    xNextUnitVector /= nextVectorLength;
+                    yNextUnitVector /= nextVectorLength;
+                }
+
+                if ((xVector * xNextUnitVector + yVector * yNextUnitVector) < DEGREES_THRESHOLD) {
+                    pointerPath.push_back(newSeparation);
+                    firstSeparation = newSeparation;
+                    xUnitVector = 0;
+                    yUnitVector = 0;
+                    numSinceFirstSep = 0;
+                }
+            }
+            xVector = nextPoint.px_ - firstSeparation.px_;
+            yVector = nextPoint.py_ - firstSeparation.py_;
+            vectorLength = hypot(xVector, yVector);
+            numSinceFirstSep += 1;
+            if (vectorLength > EPSINON) {
+                xUnitVector += xVector / vectorLength;
+                yUnitVector += yVector / vectorLength;
+            }
+        }
+        pointerPath.push_back(nextPoint);
+        return pointerPath;
+    }
+
+    class AccessibilityGesturePathSegmenterTest : public benchmark::Fixture {
+    public:
+        AccessibilityGesturePathSegmenterTest()
+        {
+            Iterations(iterations);
+            Repetitions(repetitions);
+            ReportAggregatesOnly();
+        }
+
+        ~AccessibilityGesturePathSegmenterTest() override = default;
+
+        void SetUp(const ::benchmark::State &state) override;
+        void TearDown(const ::benchmark::State &) override;
+
+    protected:
+        void RecordSwipe(const int32_t moveNum);
+        bool IsSamePath(std::vector<Pointer> &batchPath, const AccessibilityGesturePathSegmenter &segmenter);
+        void ReportCounters(benchmark::State &state, uint64_t allocCount, int64_t upTime, size_t stateBytes);
+
+        const int32_t repetitions = 3;
+        const int32_t iterations = 200;
+        std::vector<Pointer> moves_ {};
+    };
+
+    void AccessibilityGesturePathSegmenterTest::SetUp(const ::benchmark::State &state)
+    {
+        RecordSwipe(static_cast<int32_t>(state.range(0)));
+    }
+
+    void AccessibilityGesturePathSegmenterTest::TearDown(const ::benchmark::State &)
+    {
+        moves_.clear();
+    }
+
+    void AccessibilityGesturePathSegmenterTest::RecordSwipe(const int32_t moveNum)
+    {
+        // A slow swipe right then up with a little jitter, the longer the swipe the more moves it reports.
+        moves_.clear();
+        Pointer point = {START_X, START_Y};
+        moves_.push_back(point);
+        for (int32_t i = 1; i <= moveNum; i++) {
+            float jitter = (i % JITTER_PERIOD == 0) ? JITTER : 0;
+            if (i <= moveNum / 2) {
+                point.px_ += MOVE_STEP;
+                point.py_ = START_Y + jitter;
+            } else {
+                point.py_ -= MOVE_STEP;
+                point.px_ = START_X + MOVE_STEP * (moveNum / 2) + jitter;
+            }
+            moves_.push_back(point);
+        }
+    }
+
+    bool AccessibilityGesturePathSegmenterTest::IsSamePath(std::vector<Pointer> &batchPath,
+        const AccessibilityGesturePathSegmenter &segmenter)
+    {
+        if (segmenter.IsRejected() || batchPath.size() != segmenter.GetPathSize()) {
+            return false;
+        }
+        for (size_t i = 0; i < batchPath.size(); i++) {
+            if (batchPath[i].px_ != segmenter.GetPathPoint(i).px_ ||
+                batchPath[i].py_ != segmenter.GetPathPoint(i).py_) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void AccessibilityGesturePathSegmenterTest::ReportCounters(benchmark::State &state, uint64_t allocCount,
+        int64_t upTime, size_t stateBytes)
+    {
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(moves_.size()));
+        state.counters["allocs"] = benchmark::Counter(static_cast<double>(allocCount),
+            benchmark::Counter::kAvgIterations);
+        state.counters["touchUp(us)"] = benchmark::Counter(static_cast<double>(upTime) / NS_PER_US,
+            benchmark::Counter::kAvgIterations);
+        state.counters["stateBytes"] = static_cast<double>(stateBytes);
+    }
+
+    /**
+     * @tc.name: BatchSegmentTestCase
+     * @tc.desc: Testcase for keeping the whole route and segmenting it when the finger lifts.
+     * @tc.type: PERF
+     * @tc.require: Issue Number
+     */
+    BENCHMARK_DEFINE_F(AccessibilityGesturePathSegmenterTest, BatchSegmentTestCase)(
+        benchmark::State &state)
+    {
+        std::vector<Pointer> route;
+        std::vector<Pointer> pointerPath;
+        uint64_t allocCount = g_allocCount;
+        int64_t upTime = 0;
+        size_t stateBytes = 0;
+        while (state.KeepRunning()) {
+            route.clear();
+            route.shrink_to_fit();
+            for (auto &point : moves_) {
+                route.push_back(point);
+            }
+            auto upStart = std::chrono::steady_clock::now();
+            pointerPath = GetPointerPath(route);
+            upTime += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - upStart).count();
+            benchmark::DoNotOptimize(pointerPath.data());
+            stateBytes = route.capacity() * sizeof(Pointer);
+        }
+        ReportCounters(state, g_allocCount - allocCount, upTime, stateBytes);
+    }
+
+    /**
+     * @tc.name: StreamSegmentTestCase
+     * @tc.desc: Testcase for segmenting the route move by move with the path segmenter.
+     * @tc.type: PERF
+     * @tc.require: Issue Number
+     */
+    BENCHMARK_DEFINE_F(AccessibilityGesturePathSegmenterTest, StreamSegmentTestCase)(
+        benchmark::State &state)
+    {
+        AccessibilityGesturePathSegmenter segmenter;
+        std::vector<Pointer> route = moves_;
+        std::vector<Pointer> batchPath = GetPointerPath(route);
+        segmenter.Reset(moves_[0]);
+        for (size_t i = 1; i < moves_.size(); i++) {
+            segmenter.AddPoint(moves_[i]);
+        }
+        if (!IsSamePath(batchPath, segmenter)) {
+            state.SkipWithError("The streamed path differs from the batch path.");
+            return;
+        }
+
+        uint64_t allocCount = g_allocCount;
+        int64_t upTime = 0;
+        while (state.KeepRunning()) {
+            segmenter.Reset(moves_[0]);
+            for (size_t i = 1; i < moves_.size(); i++) {
+                segmenter.AddPoint(moves_[i]);
+            }
+            auto upStart = std::chrono::steady_clock::now();
+            benchmark::DoNotOptimize(segmenter.GetPathPoint(segmenter.GetPathSize() - 1));
+            upTime += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - upStart).count();
+        }
+        ReportCounters(state, g_allocCount - allocCount, upTime, sizeof(segmenter));
+    }
+
+    BENCHMARK_REGISTER_F(AccessibilityGesturePathSegmenterTest, BatchSegmentTestCase)
+        ->Arg(64)->Arg(512)->Arg(4096)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(AccessibilityGesturePathSegmenterTest, StreamSegmentTestCase)
+        ->Arg(64)->Arg(512)->Arg(4096)->Unit(benchmark::kMicrosecond);
+}
+
+BENCHMARK_MAIN();
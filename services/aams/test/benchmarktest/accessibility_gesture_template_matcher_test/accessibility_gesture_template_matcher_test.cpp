@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <limits>
+#include <string>
+#include <vector>
+#include "accessibility_gesture_template_matcher.h"
+
+using namespace OHOS;
+using namespace OHOS::Accessibility;
+
+namespace {
+    constexpr int32_t MIN_VERTEX_NUM = 3;
+    constexpr int32_t MAX_VERTEX_NUM = 6;
+    constexpr uint32_t RANDOM_SEED = 20240601;
+    constexpr uint32_t RANDOM_MULTIPLIER = 1664525;
+    constexpr uint32_t RANDOM_INCREMENT = 1013904223;
+    constexpr uint32_t RANDOM_RANGE = 1000;
+    constexpr int32_t SAMPLE_NUM_PER_STROKE = 20;
+    constexpr float STROKE_SIZE = 300.0f;
+
+    class AccessibilityGestureTemplateMatcherTest : public benchmark::Fixture {
+    public:
+        AccessibilityGestureTemplateMatcherTest()
+        {
+            Iterations(iterations);
+            Repetitions(repetitions);
+            ReportAggregatesOnly();
+        }
+
+        ~AccessibilityGestureTemplateMatcherTest() override = default;
+
+        void SetUp(const ::benchmark::State &state) override;
+        void TearDown(const ::benchmark::State &) override;
+
+    protected:
+        uint32_t NextRandom();
+        void RegisterVocabulary(const int32_t templateNum);
+        void RecordRoute();
+        void ReportCounters(benchmark::State &state, size_t comparedCount);
+
+        const int32_t repetitions = 3;
+        const int32_t iterations = 1000;
+        uint32_t random_ = RANDOM_SEED;
+        AccessibilityGestureTemplateMatcher matcher_ {};
+        std::vector<Pointer> route_ {};
+    };
+
+    void AccessibilityGestureTemplateMatcherTest::SetUp(const ::benchmark::State &state)
+    {
+        RegisterVocabulary(static_cast<int32_t>(state.range(0)));
+        RecordRoute();
+    }
+
+    void AccessibilityGestureTemplateMatcherTest::TearDown(const ::benchmark::State &)
+    {
+        matcher_.Clear();
+        route_.clear();
+    }
+
+    uint32_t AccessibilityGestureTemplateMatcherTest::NextRandom()
+    {
+        random_ = random_ * RANDOM_MULTIPLIER + RANDOM_INCREMENT;
+        return (random_ >> 16) % RANDOM_RANGE; // 16: drop the low bits of the generator
+    }
+
+    void AccessibilityGestureTemplateMatcherTest::RegisterVocabulary(const int32_t templateNum)
+    {
+        // Random polylines stand in for a large vocabulary, the zigzag drawn by RecordRoute is one of them.
+        random_ = RANDOM_SEED;
+        matcher_.Clear();
+        Pointer zigzag[] = {{0, 0}, {1, 1}, {2, 0}, {3, 1}};
+        matcher_.AddTemplate("zigzag", GestureType::GESTURE_SWIPE_SLOWLY, zigzag, sizeof(zigzag) / sizeof(Pointer));
+        while (static_cast<int32_t>(matcher_.GetTemplates().size()) < templateNum) {
+            int32_t vertexNum = MIN_VERTEX_NUM + static_cast<int32_t>(NextRandom()) % (MAX_VERTEX_NUM - MIN_VERTEX_NUM);
+            std::vector<Pointer> points;
+            for (int32_t i = 0; i < vertexNum; i++) {
+                points.push_back({static_cast<float>(NextRandom()), static_cast<float>(NextRandom())});
+            }
+            matcher_.AddTemplate("random_" + std::to_string(matcher_.GetTemplates().size()),
+                GestureType::GESTURE_DRAG, points.data(), points.size());
+        }
+    }
+
+    void AccessibilityGestureTemplateMatcherTest::RecordRoute()
+    {
+        route_.clear();
+        Pointer point = {100.0f, 500.0f};
+        route_.push_back(point);
+        const float directions[] = {1.0f, -1.0f, 1.0f};
+        for (float direction : directions) {
+            for (int32_t i = 0; i < SAMPLE_NUM_PER_STROKE; i++) {
+                point.px_ += STROKE_SIZE / SAMPLE_NUM_PER_STROKE;
+                point.py_ += direction * STROKE_SIZE / SAMPLE_NUM_PER_STROKE;
+                route_.push_back(point);
+            }
+        }
+    }
+
+    void AccessibilityGestureTemplateMatcherTest::ReportCounters(benchmark::State &state, size_t comparedCount)
+    {
+        double templateNum = static_cast<double>(matcher_.GetTemplates().size());
+        state.SetItemsProcessed(state.iterations());
+        state.counters["templates"] = templateNum;
+        state.counters["compared"] = static_cast<double>(comparedCount);
+        // Seconds spent per template, shown as time per template by the reporter.
+        state.counters["perTemplate"] = benchmark::Counter(templateNum * state.iterations(),
+            benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+    }
+
+    /**
+     * @tc.name: MatchTestCase
+     * @tc.desc: Testcase for matching a route with the aspect index, the straightness check and early abandon.
+     * @tc.type: PERF
+     * @tc.require: Issue Number
+     */
+    BENCHMARK_DEFINE_F(AccessibilityGestureTemplateMatcherTest, MatchTestCase)(
+        benchmark::State &state)
+    {
+        GestureMatchResult result;
+        while (state.KeepRunning()) {
+            result = matcher_.Match(route_.data(), route_.size());
+            benchmark::DoNotOptimize(result);
+        }
+        if (result.gestureId != GestureType::GESTURE_SWIPE_SLOWLY) {
+            state.SkipWithError("The zigzag is not recognized.");
+            return;
+        }
+        ReportCounters(state, result.comparedCount);
+    }
+
+    /**
+     * @tc.name: ExhaustiveMatchTestCase
+     * @tc.desc: Testcase for matching a route against every template without early rejection.
+     * @tc.type: PERF
+     * @tc.require: Issue Number
+     */
+    BENCHMARK_DEFINE_F(AccessibilityGestureTemplateMatcherTest, ExhaustiveMatchTestCase)(
+        benchmark::State &state)
+    {
+        GestureType gestureId = GestureType::GESTURE_INVALID;
+        while (state.KeepRunning()) {
+            GestureTemplate candidate;
+            AccessibilityGestureTemplateMatcher::NormalizeShape(route_.data(), route_.size(), candidate);
+            float best = std::numeric_limits<float>::max();
+            for (auto &shape : matcher_.GetTemplates()) {
+                float distance = AccessibilityGestureTemplateMatcher::GetDistance(shape, candidate,
+                    std::numeric_limits<float>::max());
+                if (distance < best) {
+                    best = distance;
+                    gestureId = shape.gestureId;
+                }
+            }
+            benchmark::DoNotOptimize(gestureId);
+        }
+        if (gestureId != GestureType::GESTURE_SWIPE_SLOWLY) {
+            state.SkipWithError("The zigzag is not recognized.");
+            return;
+        }
+        ReportCounters(state, matcher_.GetTemplates().size());
+    }
+
+    BENCHMARK_REGISTER_F(AccessibilityGestureTemplateMatcherTest, MatchTestCase)
+        ->Arg(16)->Arg(128)->Arg(1024)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(AccessibilityGestureTemplateMatcherTest, ExhaustiveMatchTestCase)
+        ->Arg(16)->Arg(128)->Arg(1024)->Unit(benchmark::kMicrosecond);
+}
+
+BENCHMARK_MAIN();
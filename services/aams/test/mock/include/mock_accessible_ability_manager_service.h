@@ -29,6 +29,7 @@ public:
     MOCK_METHOD0(OnStart, void());
     MOCK_METHOD0(OnStop, void());
     MOCK_METHOD2(SendEvent, RetError(const AccessibilityEventInfo& uiEvent, const int32_t flag));
+    MOCK_METHOD2(SendEvents, RetError(const std::vector<AccessibilityEventInfo>& uiEvents, const int32_t flag));
     MOCK_METHOD2(RegisterStateCallback,
         uint32_t(const sptr<AccessibleAbilityManagerServiceStub>& callback, const int32_t accountId));
     MOCK_METHOD2(RegisterCaptionPropertyCallback,
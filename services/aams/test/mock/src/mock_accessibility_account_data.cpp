@@ -98,8 +98,10 @@ void AccessibilityAccountData::AddAccessibilityWindowConnection(
     const int32_t windowId, const sptr<AccessibilityWindowConnection>& interactionConnection)
 {
     HILOG_DEBUG("windowId(%{public}d)", windowId);
-    if (!asacConnections_.count(windowId)) {
-        asacConnections_.insert(std::make_pair(windowId, interactionConnection));
+    if (!asacConnections_->count(windowId)) {
+        auto asacConnections = std::make_shared<WindowConnectionMap>(*asacConnections_);
+        asacConnections->insert(std::make_pair(windowId, interactionConnection));
+        asacConnections_ = asacConnections;
     }
 }
 
@@ -107,12 +109,38 @@ void AccessibilityAccountData::AddAccessibilityWindowConnection(
 void AccessibilityAccountData::RemoveAccessibilityWindowConnection(const int32_t windowId)
 {
     HILOG_DEBUG("windowId(%{public}d)", windowId);
-    auto iter = asacConnections_.find(windowId);
-    if (iter != asacConnections_.end()) {
-        asacConnections_.erase(iter);
+    if (asacConnections_->count(windowId)) {
+        auto asacConnections = std::make_shared<WindowConnectionMap>(*asacConnections_);
+        asacConnections->erase(windowId);
+        asacConnections_ = asacConnections;
     }
 }
 
+std::shared_ptr<const ElementOperatorSnapshot> AccessibilityAccountData::GetElementOperatorSnapshot()
+{
+    auto snapshot = std::make_shared<ElementOperatorSnapshot>();
+    for (auto &asacConnection : *asacConnections_) {
+        if (!asacConnection.second) {
+            continue;
+        }
+        auto &operators = (*snapshot)[asacConnection.first];
+        operators[0] = asacConnection.second->GetProxy();
+        std::vector<int32_t> treeIds;
+        asacConnection.second->GetAllTreeId(treeIds);
+        for (int32_t treeId : treeIds) {
+            if (treeId > 0) {
+                operators[treeId] = asacConnection.second->GetCardProxy(treeId);
+            }
+        }
+    }
+    return snapshot;
+}
+
+void AccessibilityAccountData::UpdateElementOperatorSnapshot()
+{
+    HILOG_DEBUG("start.");
+}
+
 void AccessibilityAccountData::AddConnectingA11yAbility(const std::string &uri,
     const sptr<AccessibleAbilityConnection> &connection)
 {
@@ -178,8 +206,9 @@ const sptr<AccessibleAbilityConnection> AccessibilityAccountData::GetAccessibleA
 const sptr<AccessibilityWindowConnection> AccessibilityAccountData::GetAccessibilityWindowConnection(
     const int32_t windowId)
 {
-    if (asacConnections_.count(windowId) > 0) {
-        return asacConnections_[windowId];
+    auto iter = asacConnections_->find(windowId);
+    if (iter != asacConnections_->end()) {
+        return iter->second;
     }
     return nullptr;
 }
@@ -192,9 +221,33 @@ const std::map<std::string, sptr<AccessibleAbilityConnection>> AccessibilityAcco
     return connectionMap;
 }
 
+std::shared_ptr<const AbilityConnectionMap> AccessibilityAccountData::GetConnectedA11yAbilitiesSnapshot()
+{
+    return connectedA11yAbilities_.GetAccessibilityAbilitiesSnapshot();
+}
+
+void AccessibilityAccountData::GetEventSubscribers(const uint32_t eventType,
+    std::vector<sptr<AccessibleAbilityConnection>>& subscribers)
+{
+    (void)eventType;
+    std::vector<sptr<AccessibleAbilityConnection>> connectionList;
+    connectedA11yAbilities_.GetAccessibilityAbilities(connectionList);
+    subscribers.clear();
+    for (auto& connection : connectionList) {
+        if (connection) {
+            subscribers.push_back(connection);
+        }
+    }
+}
+
 const std::map<int32_t, sptr<AccessibilityWindowConnection>> AccessibilityAccountData::GetAsacConnections()
 {
     HILOG_DEBUG("GetAsacConnections start");
+    return *asacConnections_;
+}
+
+std::shared_ptr<const WindowConnectionMap> AccessibilityAccountData::GetAsacConnectionsSnapshot()
+{
     return asacConnections_;
 }
 
@@ -413,8 +466,8 @@ void AccessibilityAccountData::UpdateAutoStartEnabledAbilities()
 sptr<AccessibleAbilityConnection> AccessibilityAccountData::AccessibilityAbility::GetAccessibilityAbilityByUri(
     const std::string& uri)
 {
-    auto iter = connectionMap_.find(uri);
-    if (iter != connectionMap_.end()) {
+    auto iter = connectionMap_->find(uri);
+    if (iter != connectionMap_->end()) {
         return iter->second;
     }
 
@@ -423,30 +476,33 @@ sptr<AccessibleAbilityConnection> AccessibilityAccountData::AccessibilityAbility
 
 void AccessibilityAccountData::AccessibilityAbility::Clear()
 {
-    return connectionMap_.clear();
+    PublishConnectionMap(std::make_shared<AbilityConnectionMap>());
 }
 
 void AccessibilityAccountData::AccessibilityAbility::AddAccessibilityAbility(const std::string& uri,
     const sptr<AccessibleAbilityConnection>& connection)
 {
-    if (!connectionMap_.count(uri)) {
-        connectionMap_[uri] = connection;
+    if (!connectionMap_->count(uri)) {
+        auto connectionMap = std::make_shared<AbilityConnectionMap>(*connectionMap_);
+        (*connectionMap)[uri] = connection;
+        PublishConnectionMap(connectionMap);
         return;
     }
 }
 
 void AccessibilityAccountData::AccessibilityAbility::RemoveAccessibilityAbilityByUri(const std::string& uri)
 {
-    auto iter = connectionMap_.find(uri);
-    if (iter != connectionMap_.end()) {
-        connectionMap_.erase(iter);
+    if (connectionMap_->count(uri)) {
+        auto connectionMap = std::make_shared<AbilityConnectionMap>(*connectionMap_);
+        connectionMap->erase(uri);
+        PublishConnectionMap(connectionMap);
     }
 }
 
 void AccessibilityAccountData::AccessibilityAbility::GetAccessibilityAbilities(
     std::vector<sptr<AccessibleAbilityConnection>>& connectionList)
 {
-    for (auto& connection : connectionMap_) {
+    for (auto& connection : *connectionMap_) {
         connectionList.push_back(connection.second);
     }
 }
@@ -454,7 +510,20 @@ void AccessibilityAccountData::AccessibilityAbility::GetAccessibilityAbilities(
 void AccessibilityAccountData::AccessibilityAbility::GetAccessibilityAbilitiesMap(
     std::map<std::string, sptr<AccessibleAbilityConnection>>& connectionMap)
 {
-    connectionMap = connectionMap_;
+    connectionMap = *connectionMap_;
+}
+
+std::shared_ptr<const AbilityConnectionMap>
+    AccessibilityAccountData::AccessibilityAbility::GetAccessibilityAbilitiesSnapshot()
+{
+    return connectionMap_;
+}
+
+void AccessibilityAccountData::AccessibilityAbility::PublishConnectionMap(
+    const std::shared_ptr<AbilityConnectionMap>& connectionMap)
+{
+    connectionMap_ = connectionMap;
+    eventRoutes_.clear();
 }
 
 sptr<AccessibilityAccountData> AccessibilityAccountDataMap::AddAccountData(
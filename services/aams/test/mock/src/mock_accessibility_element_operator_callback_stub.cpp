@@ -33,6 +33,12 @@ int AccessibilityElementOperatorCallbackStub::OnRemoteRequest(
     return 0;
 }
 
+void AccessibilityElementOperatorCallbackStub::OnSearchElementInfoByAccessibilityIdResult(
+    std::vector<AccessibilityElementInfo> &&infos, const int32_t requestId)
+{
+    SetSearchElementInfoByAccessibilityIdResult(infos, requestId);
+}
+
 ErrCode AccessibilityElementOperatorCallbackStub::HandleSetSearchElementInfoByAccessibilityIdResult(
     MessageParcel& data, MessageParcel& reply)
 {
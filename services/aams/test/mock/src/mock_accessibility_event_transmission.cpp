@@ -20,6 +20,8 @@
 
 namespace OHOS {
 namespace Accessibility {
+std::shared_ptr<MMI::PointerEvent> EventTransmission::dispatchingPointerEvent_ = nullptr;
+
 bool EventTransmission::OnPointerEvent(MMI::PointerEvent& event)
 {
     HILOG_DEBUG();
@@ -57,5 +59,18 @@ sptr<EventTransmission> EventTransmission::GetNext()
     HILOG_DEBUG();
     return next_;
 }
+
+void EventTransmission::SetDispatchingPointerEvent(const std::shared_ptr<MMI::PointerEvent> &event)
+{
+    dispatchingPointerEvent_ = event;
+}
+
+std::shared_ptr<MMI::PointerEvent> EventTransmission::KeepPointerEvent(MMI::PointerEvent &event)
+{
+    if (dispatchingPointerEvent_ != nullptr && dispatchingPointerEvent_.get() == &event) {
+        return dispatchingPointerEvent_;
+    }
+    return std::make_shared<MMI::PointerEvent>(event);
+}
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
@@ -98,6 +98,57 @@ void AccessibilityInputInterceptor::SetNextEventTransmitter(
     (void)next;
 }
 
+void AccessibilityInputInterceptor::UpdateAvailableFunctions(uint32_t availableFunctions)
+{
+    availableFunctions_ = availableFunctions;
+}
+
+void AccessibilityInputInterceptor::DispatchInputEvent(AccessibilityInputEventQueue::Item &item)
+{
+    (void)item;
+}
+
+void AccessibilityInputInterceptor::DrainInputEvents()
+{}
+
+InputEventQueueStats AccessibilityInputInterceptor::GetInputQueueStats() const
+{
+    return inputEventQueue_.GetStats();
+}
+
+AccessibilityInputEventQueue::AccessibilityInputEventQueue()
+{}
+
+bool AccessibilityInputEventQueue::Push(Item &item)
+{
+    (void)item;
+    return true;
+}
+
+bool AccessibilityInputEventQueue::Pop(Item &item)
+{
+    (void)item;
+    return false;
+}
+
+bool AccessibilityInputEventQueue::IsEmpty() const
+{
+    return true;
+}
+
+void AccessibilityInputEventQueue::RecordWaitTime(int64_t waitTime)
+{
+    (void)waitTime;
+}
+
+void AccessibilityInputEventQueue::RecordDropped()
+{}
+
+InputEventQueueStats AccessibilityInputEventQueue::GetStats() const
+{
+    return {};
+}
+
 AccessibilityInputEventConsumer::AccessibilityInputEventConsumer()
 {}
 
@@ -405,6 +405,12 @@ void AccessibilitySettingsConfig::ClearData()
     HILOG_DEBUG("start.");
 }
 
+RetError AccessibilitySettingsConfig::FlushPendingSettings()
+{
+    HILOG_DEBUG("start.");
+    return RET_OK;
+}
+
 RetError AccessibilitySettingsConfig::SetIgnoreRepeatClickState(const bool state)
 {
     HILOG_DEBUG("start.");
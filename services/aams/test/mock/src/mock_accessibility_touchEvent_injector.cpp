@@ -28,17 +28,12 @@ TouchInjectHandler::TouchInjectHandler(
 
 void TouchInjectHandler::ProcessEvent(const AppExecFwk::InnerEvent::Pointer& event)
 {
-    std::shared_ptr<SendEventArgs> parameters = nullptr;
     if (!event) {
         return;
     }
     switch (event->GetInnerEventId()) {
         case TouchEventInjector::SEND_TOUCH_EVENT_MSG:
-            parameters = event->GetSharedObject<SendEventArgs>();
-            if (!parameters->event_) {
-                return;
-            }
-            server_.SendPointerEvent(*parameters->event_);
+            server_.SendInjectedEvents();
             break;
         default:
             break;
@@ -87,5 +82,21 @@ int64_t TouchEventInjector::GetSystemTime()
 void TouchEventInjector::InjectEvents(const std::shared_ptr<AccessibilityGestureInjectPath>& gesturePath)
 {
 }
+
+void TouchEventInjector::ScheduleNextEvent()
+{}
+
+void TouchEventInjector::SendInjectedEvents()
+{}
+
+void TouchEventInjector::UpdateJitterStats(int64_t jitter)
+{
+    (void)jitter;
+}
+
+InjectionJitterStats TouchEventInjector::GetInjectionJitterStats() const
+{
+    return InjectionJitterStats();
+}
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
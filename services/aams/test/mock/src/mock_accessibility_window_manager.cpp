@@ -181,6 +181,27 @@ std::map<int32_t, int64_t> AccessibilityWindowManager::SceneBoardElementIdMap::G
     return std::map<int32_t, int64_t>();
 }
 
+bool AccessibilityWindowManager::SceneBoardElementIdMap::IsRootElement(const int64_t elementId)
+{
+    (void)elementId;
+    return true;
+}
+
+bool AccessibilityWindowManager::SceneBoardElementIdMap::GetInnerWindowId(const int64_t elementId,
+    int32_t& windowId)
+{
+    (void)elementId;
+    (void)windowId;
+    return false;
+}
+
+void AccessibilityWindowManager::SceneBoardElementIdMap::InsertElements(const int32_t windowId,
+    const std::vector<int64_t>& elementIds)
+{
+    (void)windowId;
+    (void)elementIds;
+}
+
 RetError AccessibilityWindowManager::GetFocusedWindowId(int32_t &focusedWindowId)
 {
     focusedWindowId = 1;
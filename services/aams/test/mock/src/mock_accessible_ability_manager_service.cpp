@@ -49,6 +49,8 @@ void AccessibleAbilityManagerService::OnStart()
     GTEST_LOG_(INFO) << "###AccessibleAbilityManagerService::OnStart";
     runner_ = AppExecFwk::EventRunner::Create("AccessibleAbilityManagerService", AppExecFwk::ThreadMode::FFRT);
     handler_ = std::make_shared<AAMSEventHandler>(runner_);
+    inputRunner_ = AppExecFwk::EventRunner::Create("AamsInputRunner", AppExecFwk::ThreadMode::NEW_THREAD);
+    inputHandler_ = std::make_shared<AAMSEventHandler>(inputRunner_);
     Singleton<AccessibilityWindowManager>::GetInstance().RegisterWindowListener(handler_);
     Singleton<AccessibilityCommonEvent>::GetInstance().SubscriberEvent(handler_);
 }
@@ -59,6 +61,8 @@ void AccessibleAbilityManagerService::OnStop()
     Singleton<AccessibilityWindowManager>::GetInstance().DeregisterWindowListener();
     runner_.reset();
     handler_.reset();
+    inputRunner_.reset();
+    inputHandler_.reset();
 }
 
 void AccessibleAbilityManagerService::OnAddSystemAbility(int32_t systemAbilityId, const std::string& deviceId)
@@ -100,6 +104,15 @@ RetError AccessibleAbilityManagerService::SendEvent(const AccessibilityEventInfo
     return RET_OK;
 }
 
+RetError AccessibleAbilityManagerService::SendEvents(const std::vector<AccessibilityEventInfo>& uiEvents,
+    const int32_t flag)
+{
+    for (auto &uiEvent : uiEvents) {
+        SendEvent(uiEvent, flag);
+    }
+    return RET_OK;
+}
+
 uint32_t AccessibleAbilityManagerService::RegisterStateObserver(
     const sptr<IAccessibleAbilityManagerStateObserver>& callback)
 {
@@ -633,6 +646,26 @@ void AccessibleAbilityManagerService::AddRequestId(int32_t windowId, int32_t tre
     (void)callback;
 }
 
+void AccessibleAbilityManagerService::GetPendingRequestNums(std::map<int32_t, size_t>& requestNums)
+{
+    (void)requestNums;
+}
+
+void AccessibleAbilityManagerService::SetEventCoalescingWindow(const EventType eventType, const int64_t window)
+{
+    (void)eventType;
+    (void)window;
+}
+
+void AccessibleAbilityManagerService::GetEventCoalescingStats(EventCoalescingStats& stats)
+{
+    (void)stats;
+}
+
+AccessibleAbilityManagerService::EventCoalescer::EventCoalescer()
+{
+}
+
 int64_t AccessibleAbilityManagerService::GetRootParentId(int32_t windowId, int32_t treeId)
 {
     (void)windowId;
@@ -261,6 +261,40 @@ HWTEST_F(AccessibilityAccountDataTest, AccessibilityAccountData_Unittest_RemoveC
     GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_RemoveConnectedAbility001 end";
 }
 
+/**
+ * @tc.number: AccessibilityAccountData_Unittest_GetEventSubscribers001
+ * @tc.name: GetEventSubscribers
+ * @tc.desc: Check the event subscribers follow the connected abilities.
+ */
+HWTEST_F(AccessibilityAccountDataTest, AccessibilityAccountData_Unittest_GetEventSubscribers001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_GetEventSubscribers001 start";
+    const int32_t accountId = 1;
+    int32_t connectCounter = 0;
+    AccessibilityAbilityInitParams initParams;
+    sptr<AccessibilityAccountData> accountData = new AccessibilityAccountData(accountId);
+    std::shared_ptr<AccessibilityAbilityInfo> abilityInfo = std::make_shared<AccessibilityAbilityInfo>(initParams);
+    abilityInfo->SetEventTypes(EventType::TYPE_VIEW_CLICKED_EVENT);
+    sptr<AccessibleAbilityConnection> connection =
+        new MockAccessibleAbilityConnection(accountId, connectCounter++, *abilityInfo);
+    std::vector<sptr<AccessibleAbilityConnection>> subscribers;
+    accountData->GetEventSubscribers(EventType::TYPE_VIEW_CLICKED_EVENT, subscribers);
+    EXPECT_EQ(0, (int)subscribers.size());
+    /* add */
+    accountData->AddConnectedAbility(connection);
+    accountData->GetEventSubscribers(EventType::TYPE_VIEW_CLICKED_EVENT, subscribers);
+    ASSERT_EQ(1, (int)subscribers.size());
+    EXPECT_EQ(connection, subscribers[0]);
+    accountData->GetEventSubscribers(EventType::TYPE_VIEW_FOCUSED_EVENT, subscribers);
+    EXPECT_EQ(0, (int)subscribers.size());
+    /* remove */
+    accountData->RemoveConnectedAbility(connection->GetElementName());
+    accountData->GetEventSubscribers(EventType::TYPE_VIEW_CLICKED_EVENT, subscribers);
+    EXPECT_EQ(0, (int)subscribers.size());
+
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_GetEventSubscribers001 end";
+}
+
 /**
  * @tc.number: AccessibilityAccountData_Unittest_DelAutoStartPrefKeyInRemovePkg001
  * @tc.name: DelAutoStartPrefKeyInRemovePkg
@@ -1865,5 +1899,72 @@ HWTEST_F(AccessibilityAccountDataTest, AccessibilityAccountData_Unittest_AddAbil
     EXPECT_EQ(0, static_cast<int>(accountData->GetInstalledAbilities().size()));
     GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_AddAbility001 end";
 }
+
+/**
+ * @tc.number: AccessibilityAccountData_Unittest_GetElementOperatorSnapshot001
+ * @tc.name: GetElementOperatorSnapshot
+ * @tc.desc: Check the element operator snapshot follows the window connections and card proxies.
+ */
+HWTEST_F(AccessibilityAccountDataTest, AccessibilityAccountData_Unittest_GetElementOperatorSnapshot001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_GetElementOperatorSnapshot001 start";
+    const int32_t accountId = 1;
+    const int32_t windowId = 1;
+    const int32_t treeId = 2;
+    sptr<AccessibilityAccountData> accountData = new AccessibilityAccountData(accountId);
+    sptr<AccessibilityElementOperatorStub> stub = new MockAccessibilityElementOperatorStub();
+    sptr<IAccessibilityElementOperator> operation = new MockAccessibilityElementOperatorProxy(stub);
+    sptr<AccessibilityWindowConnection> connection = new AccessibilityWindowConnection(windowId, operation, accountId);
+    std::shared_ptr<const ElementOperatorSnapshot> snapshot = accountData->GetElementOperatorSnapshot();
+    EXPECT_TRUE(snapshot->empty());
+
+    accountData->AddAccessibilityWindowConnection(windowId, connection);
+    std::shared_ptr<const ElementOperatorSnapshot> added = accountData->GetElementOperatorSnapshot();
+    ASSERT_EQ(1, static_cast<int>(added->count(windowId)));
+    EXPECT_EQ(operation, added->at(windowId).at(0));
+    EXPECT_TRUE(snapshot->empty());
+
+    connection->SetCardProxy(treeId, operation);
+    EXPECT_EQ(0, static_cast<int>(accountData->GetElementOperatorSnapshot()->at(windowId).count(treeId)));
+    accountData->UpdateElementOperatorSnapshot();
+    EXPECT_EQ(operation, accountData->GetElementOperatorSnapshot()->at(windowId).at(treeId));
+
+    accountData->RemoveAccessibilityWindowConnection(windowId);
+    EXPECT_TRUE(accountData->GetElementOperatorSnapshot()->empty());
+    EXPECT_EQ(1, static_cast<int>(added->count(windowId)));
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_GetElementOperatorSnapshot001 end";
+}
+
+/**
+ * @tc.number: AccessibilityAccountData_Unittest_GetConnectedA11yAbilitiesSnapshot001
+ * @tc.name: GetConnectedA11yAbilitiesSnapshot
+ * @tc.desc: Check a snapshot taken before a connection change is left untouched.
+ */
+HWTEST_F(AccessibilityAccountDataTest, AccessibilityAccountData_Unittest_GetConnectedA11yAbilitiesSnapshot001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_GetConnectedA11yAbilitiesSnapshot001 start";
+    const int32_t accountId = 1;
+    int32_t connectCounter = 0;
+    AccessibilityAbilityInitParams initParams;
+    std::shared_ptr<AccessibilityAbilityInfo> abilityInfo = std::make_shared<AccessibilityAbilityInfo>(initParams);
+    sptr<AccessibleAbilityConnection> connection =
+        new MockAccessibleAbilityConnection(accountId, connectCounter++, *abilityInfo);
+    sptr<AccessibilityAccountData> accountData = new AccessibilityAccountData(accountId);
+    std::shared_ptr<const AbilityConnectionMap> before = accountData->GetConnectedA11yAbilitiesSnapshot();
+    EXPECT_TRUE(before->empty());
+
+    accountData->AddConnectedAbility(connection);
+    std::shared_ptr<const AbilityConnectionMap> added = accountData->GetConnectedA11yAbilitiesSnapshot();
+    EXPECT_EQ(1, static_cast<int>(added->size()));
+    EXPECT_EQ(added, accountData->GetConnectedA11yAbilitiesSnapshot());
+    EXPECT_TRUE(before->empty());
+
+    accountData->RemoveConnectedAbility(connection->GetElementName());
+    EXPECT_TRUE(accountData->GetConnectedA11yAbilitiesSnapshot()->empty());
+    EXPECT_EQ(1, static_cast<int>(added->size()));
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_GetConnectedA11yAbilitiesSnapshot001 end";
+}
 } // namespace Accessibility
 } // namespace OHOS
@@ -314,5 +314,21 @@ HWTEST_F(AccessibilityDumperUnitTest, AccessibilityDumper_Unittest_Dump_009, Tes
     currentAccount->RemoveAccessibilityWindowConnection(windowId);
     GTEST_LOG_(INFO) << "AccessibilityDumper_Unittest_Dump_009 end";
 }
+
+/**
+ * @tc.number: AccessibilityDumper_Unittest_Dump_010
+ * @tc.name: Dump
+ * @tc.desc: Test function Dump with performance counters.
+ */
+HWTEST_F(AccessibilityDumperUnitTest, AccessibilityDumper_Unittest_Dump_010, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityDumper_Unittest_Dump_010 start";
+    std::string cmdPerformance("-p");
+    std::vector<std::u16string> args;
+    args.emplace_back(Str8ToStr16(cmdPerformance));
+    int ret = dumper_->Dump(fd_, args);
+    EXPECT_GE(ret, -1);
+    GTEST_LOG_(INFO) << "AccessibilityDumper_Unittest_Dump_010 end";
+}
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include "accessibility_gesture_path_segmenter.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr int32_t SEGMENT_POINT_NUM = 20;
+    constexpr float MOVE_STEP = 10.0f;
+    constexpr float START_X = 500.0f;
+    constexpr float START_Y = 1000.0f;
+    constexpr size_t PATH_SIZE_TWO = 2;
+    constexpr size_t PATH_SIZE_THREE = 3;
+} // namespace
+
+class AccessibilityGesturePathSegmenterUnitTest : public ::testing::Test {
+public:
+    AccessibilityGesturePathSegmenterUnitTest()
+    {}
+    ~AccessibilityGesturePathSegmenterUnitTest()
+    {}
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+
+    Pointer MoveAlong(float dx, float dy);
+
+    AccessibilityGesturePathSegmenter segmenter_ {};
+    Pointer current_ = {};
+};
+
+void AccessibilityGesturePathSegmenterUnitTest::SetUpTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityGesturePathSegmenterUnitTest Start ######################";
+}
+
+void AccessibilityGesturePathSegmenterUnitTest::TearDownTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityGesturePathSegmenterUnitTest End ######################";
+}
+
+void AccessibilityGesturePathSegmenterUnitTest::SetUp()
+{
+    GTEST_LOG_(INFO) << "SetUp";
+    current_.px_ = START_X;
+    current_.py_ = START_Y;
+    segmenter_.Reset(current_);
+}
+
+void AccessibilityGesturePathSegmenterUnitTest::TearDown()
+{
+    GTEST_LOG_(INFO) << "TearDown";
+}
+
+Pointer AccessibilityGesturePathSegmenterUnitTest::MoveAlong(float dx, float dy)
+{
+    for (int32_t i = 0; i < SEGMENT_POINT_NUM; i++) {
+        current_.px_ += dx;
+        current_.py_ += dy;
+        segmenter_.AddPoint(current_);
+    }
+    return current_;
+}
+
+/**
+ * @tc.number: AccessibilityGesturePathSegmenter_Unittest_AddPoint_001
+ * @tc.name: AddPoint
+ * @tc.desc: Test function AddPoint keeps a straight route as one segment.
+ */
+HWTEST_F(AccessibilityGesturePathSegmenterUnitTest, AccessibilityGesturePathSegmenter_Unittest_AddPoint_001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityGesturePathSegmenter_Unittest_AddPoint_001 start";
+    Pointer end = MoveAlong(0, -MOVE_STEP);
+    EXPECT_EQ(segmenter_.GetPointCount(), static_cast<size_t>(SEGMENT_POINT_NUM + 1));
+    EXPECT_FALSE(segmenter_.IsRejected());
+    ASSERT_EQ(segmenter_.GetPathSize(), PATH_SIZE_TWO);
+    EXPECT_EQ(segmenter_.GetPathPoint(0).px_, START_X);
+    EXPECT_EQ(segmenter_.GetPathPoint(0).py_, START_Y);
+    EXPECT_EQ(segmenter_.GetPathPoint(1).px_, end.px_);
+    EXPECT_EQ(segmenter_.GetPathPoint(1).py_, end.py_);
+    GTEST_LOG_(INFO) << "AccessibilityGesturePathSegmenter_Unittest_AddPoint_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityGesturePathSegmenter_Unittest_AddPoint_002
+ * @tc.name: AddPoint
+ * @tc.desc: Test function AddPoint separates a route that turns back.
+ */
+HWTEST_F(AccessibilityGesturePathSegmenterUnitTest, AccessibilityGesturePathSegmenter_Unittest_AddPoint_002,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityGesturePathSegmenter_Unittest_AddPoint_002 start";
+    MoveAlong(MOVE_STEP, 0);
+    Pointer end = MoveAlong(-MOVE_STEP, 0);
+    EXPECT_FALSE(segmenter_.IsRejected());
+    ASSERT_EQ(segmenter_.GetPathSize(), PATH_SIZE_THREE);
+    EXPECT_GT(segmenter_.GetPathPoint(1).px_, START_X);
+    EXPECT_EQ(segmenter_.GetPathPoint(2).px_, end.px_);
+    GTEST_LOG_(INFO) << "AccessibilityGesturePathSegmenter_Unittest_AddPoint_002 end";
+}
+
+/**
+ * @tc.number: AccessibilityGesturePathSegmenter_Unittest_AddPoint_003
+ * @tc.name: AddPoint
+ * @tc.desc: Test function AddPoint rejects a route once it turns back twice.
+ */
+HWTEST_F(AccessibilityGesturePathSegmenterUnitTest, AccessibilityGesturePathSegmenter_Unittest_AddPoint_003,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityGesturePathSegmenter_Unittest_AddPoint_003 start";
+    MoveAlong(MOVE_STEP, 0);
+    MoveAlong(-MOVE_STEP, 0);
+    EXPECT_FALSE(segmenter_.IsRejected());
+    MoveAlong(MOVE_STEP, 0);
+    EXPECT_TRUE(segmenter_.IsRejected());
+    EXPECT_EQ(segmenter_.GetPointCount(), static_cast<size_t>(SEGMENT_POINT_NUM * 3 + 1));
+    GTEST_LOG_(INFO) << "AccessibilityGesturePathSegmenter_Unittest_AddPoint_003 end";
+}
+
+/**
+ * @tc.number: AccessibilityGesturePathSegmenter_Unittest_Clear_001
+ * @tc.name: Clear
+ * @tc.desc: Test function Clear drops the route and the next point starts a new one.
+ */
+HWTEST_F(AccessibilityGesturePathSegmenterUnitTest, AccessibilityGesturePathSegmenter_Unittest_Clear_001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityGesturePathSegmenter_Unittest_Clear_001 start";
+    MoveAlong(MOVE_STEP, 0);
+    segmenter_.Clear();
+    EXPECT_EQ(segmenter_.GetPointCount(), static_cast<size_t>(0));
+    EXPECT_FALSE(segmenter_.IsRejected());
+
+    Pointer start = {START_X, START_Y};
+    segmenter_.AddPoint(start);
+    EXPECT_EQ(segmenter_.GetPointCount(), static_cast<size_t>(1));
+    // The path of a route is its start and its latest point, even if both are the same point.
+    ASSERT_EQ(segmenter_.GetPathSize(), PATH_SIZE_TWO);
+    EXPECT_EQ(segmenter_.GetPathPoint(0).px_, START_X);
+    EXPECT_EQ(segmenter_.GetPathPoint(1).px_, START_X);
+    EXPECT_EQ(segmenter_.GetPathPoint(1).py_, START_Y);
+    GTEST_LOG_(INFO) << "AccessibilityGesturePathSegmenter_Unittest_Clear_001 end";
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "accessibility_gesture_template_matcher.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr size_t TEMPLATE_NUM = 2;
+    constexpr int32_t SAMPLE_NUM_PER_STROKE = 20;
+    constexpr int32_t CIRCLE_SAMPLE_NUM = 40;
+    constexpr float STROKE_SIZE = 300.0f;
+    constexpr float CIRCLE_RADIUS = 200.0f;
+    constexpr float PI = 3.14159265f;
+    constexpr size_t ROUTE_LENGTH = 1000;
+    const std::string TEMPLATES_JSON = R"({
+        "templates": [
+            {"name": "zigzag", "gestureId": 21, "points": [[0, 0], [1, 1], [2, 0], [3, 1]]},
+            {"name": "check", "gestureId": 20, "points": [[0, 0], [1, 1], [3, -1]]},
+            {"name": "unknown_gesture", "gestureId": 0, "points": [[0, 0], [1, 1]]},
+            {"name": "one_point", "gestureId": 21, "points": [[0, 0]]},
+            {"name": "no_points", "gestureId": 21}
+        ]
+    })";
+} // namespace
+
+class AccessibilityGestureTemplateMatcherUnitTest : public ::testing::Test {
+public:
+    AccessibilityGestureTemplateMatcherUnitTest()
+    {}
+    ~AccessibilityGestureTemplateMatcherUnitTest()
+    {}
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+
+    std::vector<Pointer> CreateZigzag();
+    std::vector<Pointer> CreateCircle();
+
+    AccessibilityGestureTemplateMatcher matcher_ {};
+};
+
+void AccessibilityGestureTemplateMatcherUnitTest::SetUpTestCase()
+{
+    GTEST_LOG_(INFO) << "############## AccessibilityGestureTemplateMatcherUnitTest Start ##############";
+}
+
+void AccessibilityGestureTemplateMatcherUnitTest::TearDownTestCase()
+{
+    GTEST_LOG_(INFO) << "############## AccessibilityGestureTemplateMatcherUnitTest End ##############";
+}
+
+void AccessibilityGestureTemplateMatcherUnitTest::SetUp()
+{
+    GTEST_LOG_(INFO) << "SetUp";
+    matcher_.Clear();
+}
+
+void AccessibilityGestureTemplateMatcherUnitTest::TearDown()
+{
+    GTEST_LOG_(INFO) << "TearDown";
+}
+
+std::vector<Pointer> AccessibilityGestureTemplateMatcherUnitTest::CreateZigzag()
+{
+    // Three strokes drawn on screen: down-right, up-right, down-right (y grows downwards).
+    std::vector<Pointer> route;
+    Pointer point = {100.0f, 500.0f};
+    route.push_back(point);
+    const float directions[] = {1.0f, -1.0f, 1.0f};
+    for (float direction : directions) {
+        for (int32_t i = 0; i < SAMPLE_NUM_PER_STROKE; i++) {
+            point.px_ += STROKE_SIZE / SAMPLE_NUM_PER_STROKE;
+            point.py_ += direction * STROKE_SIZE / SAMPLE_NUM_PER_STROKE;
+            route.push_back(point);
+        }
+    }
+    return route;
+}
+
+std::vector<Pointer> AccessibilityGestureTemplateMatcherUnitTest::CreateCircle()
+{
+    std::vector<Pointer> route;
+    for (int32_t i = 0; i <= CIRCLE_SAMPLE_NUM; i++) {
+        float angle = 2 * PI * i / CIRCLE_SAMPLE_NUM;
+        route.push_back({500.0f + CIRCLE_RADIUS * std::cos(angle), 1000.0f + CIRCLE_RADIUS * std::sin(angle)});
+    }
+    return route;
+}
+
+/**
+ * @tc.number: AccessibilityGestureTemplateMatcher_Unittest_ParseTemplates_001
+ * @tc.name: ParseTemplates
+ * @tc.desc: Test function ParseTemplates loads the valid templates and skips the invalid ones.
+ */
+HWTEST_F(AccessibilityGestureTemplateMatcherUnitTest, AccessibilityGestureTemplateMatcher_Unittest_ParseTemplates_001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityGestureTemplateMatcher_Unittest_ParseTemplates_001 start";
+    EXPECT_TRUE(matcher_.ParseTemplates(TEMPLATES_JSON));
+    ASSERT_EQ(matcher_.GetTemplates().size(), TEMPLATE_NUM);
+    EXPECT_LE(matcher_.GetTemplates()[0].aspect, matcher_.GetTemplates()[1].aspect);
+    GTEST_LOG_(INFO) << "AccessibilityGestureTemplateMatcher_Unittest_ParseTemplates_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityGestureTemplateMatcher_Unittest_ParseTemplates_002
+ * @tc.name: ParseTemplates
+ * @tc.desc: Test function ParseTemplates rejects content without a template array.
+ */
+HWTEST_F(AccessibilityGestureTemplateMatcherUnitTest, AccessibilityGestureTemplateMatcher_Unittest_ParseTemplates_002,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityGestureTemplateMatcher_Unittest_ParseTemplates_002 start";
+    EXPECT_FALSE(matcher_.ParseTemplates("{\"templates\": "));
+    EXPECT_FALSE(matcher_.ParseTemplates("{\"templates\": {}}"));
+    EXPECT_TRUE(matcher_.IsEmpty());
+    GTEST_LOG_(INFO) << "AccessibilityGestureTemplateMatcher_Unittest_ParseTemplates_002 end";
+}
+
+/**
+ * @tc.number: AccessibilityGestureTemplateMatcher_Unittest_Match_001
+ * @tc.name: Match
+ * @tc.desc: Test function Match recognizes a route drawn at another position and size.
+ */
+HWTEST_F(AccessibilityGestureTemplateMatcherUnitTest, AccessibilityGestureTemplateMatcher_Unittest_Match_001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityGestureTemplateMatcher_Unittest_Match_001 start";
+    ASSERT_TRUE(matcher_.ParseTemplates(TEMPLATES_JSON));
+    std::vector<Pointer> route = CreateZigzag();
+    GestureMatchResult result = matcher_.Match(route.data(), route.size());
+    EXPECT_EQ(result.gestureId, GestureType::GESTURE_SWIPE_SLOWLY);
+    EXPECT_GE(result.comparedCount, static_cast<size_t>(1));
+    EXPECT_LE(result.comparedCount, TEMPLATE_NUM);
+    GTEST_LOG_(INFO) << "AccessibilityGestureTemplateMatcher_Unittest_Match_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityGestureTemplateMatcher_Unittest_Match_002
+ * @tc.name: Match
+ * @tc.desc: Test function Match reports no gesture for a shape unlike every template.
+ */
+HWTEST_F(AccessibilityGestureTemplateMatcherUnitTest, AccessibilityGestureTemplateMatcher_Unittest_Match_002,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityGestureTemplateMatcher_Unittest_Match_002 start";
+    ASSERT_TRUE(matcher_.ParseTemplates(TEMPLATES_JSON));
+    std::vector<Pointer> route = CreateCircle();
+    GestureMatchResult result = matcher_.Match(route.data(), route.size());
+    EXPECT_EQ(result.gestureId, GestureType::GESTURE_INVALID);
+    GTEST_LOG_(INFO) << "AccessibilityGestureTemplateMatcher_Unittest_Match_002 end";
+}
+
+/**
+ * @tc.number: AccessibilityGestureTemplateMatcher_Unittest_GestureRoute_001
+ * @tc.name: AddPoint
+ * @tc.desc: Test function AddPoint keeps a long route in the fixed buffer with its ends.
+ */
+HWTEST_F(AccessibilityGestureTemplateMatcherUnitTest, AccessibilityGestureTemplateMatcher_Unittest_GestureRoute_001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityGestureTemplateMatcher_Unittest_GestureRoute_001 start";
+    GestureRoute route;
+    route.Reset({0, 0});
+    for (size_t i = 1; i <= ROUTE_LENGTH; i++) {
+        route.AddPoint({static_cast<float>(i), 0});
+    }
+    ASSERT_LE(route.GetPointCount(), GestureRoute::MAX_POINT_NUM);
+    EXPECT_EQ(route.GetPoints()[0].px_, 0);
+    EXPECT_EQ(route.GetPoints()[route.GetPointCount() - 1].px_, static_cast<float>(ROUTE_LENGTH));
+    GTEST_LOG_(INFO) << "AccessibilityGestureTemplateMatcher_Unittest_GestureRoute_001 end";
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -479,5 +479,71 @@ HWTEST_F(AccessibilityInputInterceptorTest, AccessibilityInputInterceptorTest_Un
     inputInterceptor_->ProcessKeyEvent(event);
     GTEST_LOG_(INFO) << "AccessibilityInputInterceptorTest_Unittest_ProcessKeyEvent001 end";
 }
+
+/**
+ * @tc.number: AccessibilityInputInterceptorTest_Unittest_InputEventQueue001
+ * @tc.name: AccessibilityInputEventQueue
+ * @tc.desc: Check the input event queue keeps fifo order and records stats.
+ */
+HWTEST_F(AccessibilityInputInterceptorTest, AccessibilityInputInterceptorTest_Unittest_InputEventQueue001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityInputInterceptorTest_Unittest_InputEventQueue001 start";
+    AccessibilityInputEventQueue queue;
+    EXPECT_TRUE(queue.IsEmpty());
+
+    AccessibilityInputEventQueue::Item first;
+    first.keyEvent = MMI::KeyEvent::Create();
+    AccessibilityInputEventQueue::Item second;
+    second.pointerEvent = MMI::PointerEvent::Create();
+    EXPECT_TRUE(queue.Push(first));
+    EXPECT_TRUE(queue.Push(second));
+    EXPECT_EQ(queue.GetStats().depth, 2);
+
+    AccessibilityInputEventQueue::Item item;
+    EXPECT_TRUE(queue.Pop(item));
+    EXPECT_NE(item.keyEvent, nullptr);
+    queue.RecordWaitTime(10);
+    EXPECT_TRUE(queue.Pop(item));
+    EXPECT_NE(item.pointerEvent, nullptr);
+    queue.RecordWaitTime(30);
+    EXPECT_FALSE(queue.Pop(item));
+    EXPECT_TRUE(queue.IsEmpty());
+
+    InputEventQueueStats stats = queue.GetStats();
+    EXPECT_EQ(stats.depth, 0);
+    EXPECT_EQ(stats.maxDepth, 2);
+    EXPECT_EQ(stats.enqueuedCount, 2);
+    EXPECT_EQ(stats.maxWaitTime, 30);
+    EXPECT_EQ(stats.averageWaitTime, 20);
+    GTEST_LOG_(INFO) << "AccessibilityInputInterceptorTest_Unittest_InputEventQueue001 end";
+}
+
+/**
+ * @tc.number: AccessibilityInputInterceptorTest_Unittest_InputEventQueue002
+ * @tc.name: AccessibilityInputEventQueue
+ * @tc.desc: Check the input event queue is bounded.
+ */
+HWTEST_F(AccessibilityInputInterceptorTest, AccessibilityInputInterceptorTest_Unittest_InputEventQueue002,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityInputInterceptorTest_Unittest_InputEventQueue002 start";
+    AccessibilityInputEventQueue queue;
+    for (uint32_t i = 0; i < AccessibilityInputEventQueue::QUEUE_CAPACITY; i++) {
+        AccessibilityInputEventQueue::Item item;
+        item.pointerEvent = MMI::PointerEvent::Create();
+        EXPECT_TRUE(queue.Push(item));
+    }
+    AccessibilityInputEventQueue::Item overflow;
+    overflow.pointerEvent = MMI::PointerEvent::Create();
+    EXPECT_FALSE(queue.Push(overflow));
+    EXPECT_NE(overflow.pointerEvent, nullptr);
+
+    AccessibilityInputEventQueue::Item item;
+    EXPECT_TRUE(queue.Pop(item));
+    EXPECT_TRUE(queue.Push(overflow));
+    EXPECT_EQ(queue.GetStats().depth, AccessibilityInputEventQueue::QUEUE_CAPACITY);
+    GTEST_LOG_(INFO) << "AccessibilityInputInterceptorTest_Unittest_InputEventQueue002 end";
+}
 } // namespace Accessibility
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#define private public
+#include "accessibility_multifinger_multitap.h"
+#undef private
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr uint32_t MIN_MOVE_POINT_NUM = 2;
+    constexpr int32_t POINTER_ID_0 = 0;
+    constexpr int32_t POINTER_ID_1 = 1;
+    constexpr int32_t POINTER_ID_2 = 2;
+    constexpr int32_t FINGER_NUM_2 = 2;
+    constexpr int32_t DISPLAY_X = 100;
+    constexpr int32_t DISPLAY_Y = 200;
+    constexpr int64_t ACTION_TIME = 1000;
+    using TestPath = std::vector<std::pair<int32_t, int32_t>>;
+} // namespace
+
+class AccessibilityMultiFingerMultiTapUnitTest : public ::testing::Test {
+public:
+    AccessibilityMultiFingerMultiTapUnitTest()
+    {}
+    ~AccessibilityMultiFingerMultiTapUnitTest()
+    {}
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+
+    bool WalkWholePath(const TestPath &path);
+    bool AddWholePath(const int32_t pId, const TestPath &path);
+
+    std::shared_ptr<AccessibilityMultiTapGestureRecognizer> recognizer_ = nullptr;
+};
+
+void AccessibilityMultiFingerMultiTapUnitTest::SetUpTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityMultiFingerMultiTapUnitTest Start ######################";
+}
+
+void AccessibilityMultiFingerMultiTapUnitTest::TearDownTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityMultiFingerMultiTapUnitTest End ######################";
+}
+
+void AccessibilityMultiFingerMultiTapUnitTest::SetUp()
+{
+    GTEST_LOG_(INFO) << "SetUp";
+    recognizer_ = std::make_shared<AccessibilityMultiTapGestureRecognizer>();
+}
+
+void AccessibilityMultiFingerMultiTapUnitTest::TearDown()
+{
+    GTEST_LOG_(INFO) << "TearDown";
+    recognizer_ = nullptr;
+}
+
+// The check the recognizer made on the whole stored path before the route kept only its last point.
+bool AccessibilityMultiFingerMultiTapUnitTest::WalkWholePath(const TestPath &path)
+{
+    if (path.size() < MIN_MOVE_POINT_NUM) {
+        return false;
+    }
+    for (size_t index = 0; index + 1 < path.size(); index++) {
+        int32_t dx = path[index + 1].first - path[index].first;
+        int32_t dy = path[index + 1].second - path[index].second;
+        if (recognizer_->GetSwipeDirection(dx, dy) != recognizer_->moveDirection) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool AccessibilityMultiFingerMultiTapUnitTest::AddWholePath(const int32_t pId, const TestPath &path)
+{
+    recognizer_->pointerRoute_.Clear();
+    for (auto &point : path) {
+        recognizer_->AddRoutePoint(pId, point.first, point.second);
+    }
+    const MultiFingerRoute *route = recognizer_->pointerRoute_.Find(pId);
+    if (route == nullptr) {
+        return false;
+    }
+    return recognizer_->recognizeGesturePath(*route);
+}
+
+/**
+ * @tc.number: MultiFingerRecords_Insert_001
+ * @tc.name: Insert
+ * @tc.desc: Test the pointer ids out of [0, MAX_FINGER_NUM) are not recorded
+ */
+HWTEST_F(AccessibilityMultiFingerMultiTapUnitTest, MultiFingerRecords_Insert_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "MultiFingerRecords_Insert_001 start";
+    MultiFingerRecords<MultiFingerPoint> records;
+    EXPECT_TRUE(records.Insert(MAX_FINGER_NUM) == nullptr);
+    EXPECT_TRUE(records.Insert(-1) == nullptr);
+    EXPECT_FALSE(records.Contains(MAX_FINGER_NUM));
+    EXPECT_TRUE(records.Find(MAX_FINGER_NUM) == nullptr);
+    EXPECT_EQ(records.GetSize(), 0);
+
+    EXPECT_TRUE(records.Insert(MAX_FINGER_NUM - 1) != nullptr);
+    EXPECT_TRUE(records.Contains(MAX_FINGER_NUM - 1));
+    EXPECT_EQ(records.GetSize(), 1);
+    GTEST_LOG_(INFO) << "MultiFingerRecords_Insert_001 end";
+}
+
+/**
+ * @tc.number: MultiFingerRecords_Insert_002
+ * @tc.name: Insert
+ * @tc.desc: Test a slot reused after Clear starts from a default record, and a used slot is kept
+ */
+HWTEST_F(AccessibilityMultiFingerMultiTapUnitTest, MultiFingerRecords_Insert_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "MultiFingerRecords_Insert_002 start";
+    MultiFingerRecords<MultiFingerPoint> records;
+    MultiFingerPoint *point = records.Insert(POINTER_ID_1);
+    ASSERT_TRUE(point != nullptr);
+    point->pointerId = POINTER_ID_1;
+    point->displayX = DISPLAY_X;
+    point->displayY = DISPLAY_Y;
+    point->actionTime = ACTION_TIME;
+
+    point = records.Insert(POINTER_ID_1);
+    ASSERT_TRUE(point != nullptr);
+    EXPECT_EQ(point->displayX, DISPLAY_X);
+    EXPECT_EQ(records.GetSize(), 1);
+
+    records.Clear();
+    EXPECT_FALSE(records.Contains(POINTER_ID_1));
+    point = records.Insert(POINTER_ID_1);
+    ASSERT_TRUE(point != nullptr);
+    EXPECT_EQ(point->pointerId, -1);
+    EXPECT_EQ(point->displayX, 0);
+    EXPECT_EQ(point->displayY, 0);
+    EXPECT_EQ(point->actionTime, 0);
+    EXPECT_EQ(records.GetSize(), 1);
+    GTEST_LOG_(INFO) << "MultiFingerRecords_Insert_002 end";
+}
+
+/**
+ * @tc.number: MultiFingerRoute_IsSameDirection_001
+ * @tc.name: AddRoutePoint
+ * @tc.desc: Test the route checked point by point decides as the walk of the whole path did
+ */
+HWTEST_F(AccessibilityMultiFingerMultiTapUnitTest, MultiFingerRoute_IsSameDirection_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "MultiFingerRoute_IsSameDirection_001 start";
+    std::vector<TestPath> paths = {
+        { {0, 0}, {0, 10}, {1, 20}, {0, 30} }, // down with a small sideways jitter
+        { {0, 0}, {0, 10}, {10, 10}, {10, 20} }, // turns right once
+        { {0, 0}, {5, 5}, {10, 10} }, // diagonal, counted as down
+        { {0, 0}, {0, 0}, {0, 10} }, // a repeated point
+        { {0, 0}, {0, 10}, {0, 5} }, // turns back up
+        { {0, 0}, {0, 10} }, // shortest path
+        { {0, 0} }, // too short
+    };
+    std::vector<int32_t> directions = { MoveGirectionType::SWIPE_DOWN, MoveGirectionType::SWIPE_RIGHT };
+    for (auto direction : directions) {
+        recognizer_->moveDirection = direction;
+        for (size_t index = 0; index < paths.size(); index++) {
+            EXPECT_EQ(AddWholePath(POINTER_ID_0, paths[index]), WalkWholePath(paths[index])) <<
+                "path " << index << " direction " << direction;
+        }
+    }
+    GTEST_LOG_(INFO) << "MultiFingerRoute_IsSameDirection_001 end";
+}
+
+/**
+ * @tc.number: MultiFingerRoute_AddRoutePoint_001
+ * @tc.name: AddRoutePoint
+ * @tc.desc: Test a route point of a pointer id out of range is dropped
+ */
+HWTEST_F(AccessibilityMultiFingerMultiTapUnitTest, MultiFingerRoute_AddRoutePoint_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "MultiFingerRoute_AddRoutePoint_001 start";
+    recognizer_->pointerRoute_.Clear();
+    recognizer_->AddRoutePoint(MAX_FINGER_NUM, DISPLAY_X, DISPLAY_Y);
+    EXPECT_EQ(recognizer_->pointerRoute_.GetSize(), 0);
+    GTEST_LOG_(INFO) << "MultiFingerRoute_AddRoutePoint_001 end";
+}
+
+/**
+ * @tc.number: ParamCheck_001
+ * @tc.name: ParamCheck
+ * @tc.desc: Test ParamCheck fails when a finger has a last up record but no first down record
+ */
+HWTEST_F(AccessibilityMultiFingerMultiTapUnitTest, ParamCheck_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ParamCheck_001 start";
+    recognizer_->lastUpPoint_.Insert(POINTER_ID_0);
+    recognizer_->lastUpPoint_.Insert(POINTER_ID_1);
+    recognizer_->firstDownPoint_.Insert(POINTER_ID_0);
+    recognizer_->firstDownPoint_.Insert(POINTER_ID_2);
+    EXPECT_FALSE(recognizer_->ParamCheck(FINGER_NUM_2));
+
+    recognizer_->firstDownPoint_.Insert(POINTER_ID_1);
+    EXPECT_TRUE(recognizer_->ParamCheck(FINGER_NUM_2));
+    GTEST_LOG_(INFO) << "ParamCheck_001 end";
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -290,6 +290,38 @@ HWTEST_F(AccessibilityScreenTouchUnitTest, AccessibilityScreenTouch_Unittest_OnP
     GTEST_LOG_(INFO) << "AccessibilityScreenTouch_Unittest_OnPointerEvent_007 end";
 }
 
+/**
+ * @tc.number: AccessibilityScreenTouch_Unittest_OnPointerEvent_008
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Test function OnPointerEvent with rapid taps drawn by the same progress worker
+ */
+HWTEST_F(AccessibilityScreenTouchUnitTest, AccessibilityScreenTouch_Unittest_OnPointerEvent_008, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityScreenTouch_Unittest_OnPointerEvent_008 start";
+    sptr<AccessibilityAccountData> accountData =
+        Singleton<AccessibleAbilityManagerService>::GetInstance().GetCurrentAccountData();
+    if (accountData == nullptr) {
+        GTEST_LOG_(INFO) << "accountData is nullptr";
+        return;
+    }
+
+    accountData->GetConfig()->SetClickResponseTime(CLICK_RESPONSE_DELAY_LONG);
+    accountData->GetConfig()->SetIgnoreRepeatClickState(false);
+    screenTouch_ = std::make_shared<AccessibilityScreenTouch>();
+
+    const uint32_t tapCount = 20;
+    for (uint32_t i = 0; i < tapCount; i++) {
+        auto eventDown = SetPointerEvent(TIMESTAMP_1200 + i, MMI::PointerEvent::POINTER_ACTION_DOWN);
+        screenTouch_->OnPointerEvent(*eventDown);
+        auto eventUp = SetPointerEvent(TIMESTAMP_1200 + i, MMI::PointerEvent::POINTER_ACTION_UP);
+        EXPECT_EQ(screenTouch_->OnPointerEvent(*eventUp), true);
+    }
+    // the destructor stops the worker and joins it
+    screenTouch_ = nullptr;
+    accountData->GetConfig()->SetClickResponseTime(0);
+    GTEST_LOG_(INFO) << "AccessibilityScreenTouch_Unittest_OnPointerEvent_008 end";
+}
+
 /**
  * @tc.number: AccessibilityScreenTouch_Unittest_GetRealClickResponseTime_001
  * @tc.name: GetRealClickResponseTime
@@ -14,7 +14,9 @@
  */
 
 #include <gtest/gtest.h>
+#define private public
 #include "accessibility_settings_config.h"
+#undef private
 #include "mock_preferences.h"
 #include "system_ability_definition.h"
 
@@ -29,6 +31,7 @@ namespace {
     constexpr int32_t SHORT_KEY_TIMEOUT = 3000;
     constexpr float BRIGHTNESS_DISCOUNT_VALUE = 0.3f;
     constexpr float AUDIO_BALANCE_VALUE = 0.1f;
+    constexpr int32_t ACCOUNT_ID = 1;
     const std::string CONFIG_ACCESSIBILITY = "accessible";
     const std::string CONFIG_TOUCHGUIDE = "touchGuide";
     const std::string CONFIG_GESTURE = "gesture";
@@ -45,6 +48,7 @@ namespace {
     const std::string CONFIG_IGNOREREPEATCLICKSTATE = "ignoreRepeatClickState";
     const std::string CONFIG_SHORTCUT_ON_LOCK_SCREEN = "shortcutOnLockScreen";
     const std::string CONFIG_SHORTCUT_TIMEOUT = "shortcutTimeout";
+    const std::string BRIGHTNESS_DISCOUNT_KEY = "accessibility_brightness_discount";
 } // namespace
 
 class AccessibilitySettingsConfigTest : public testing::Test {
@@ -98,6 +102,119 @@ HWTEST_F(AccessibilitySettingsConfigTest, AccessibilitySettingsConfig_Unittest_I
     GTEST_LOG_(INFO) << "AccessibilitySettingsConfig_Unittest_Init end";
 }
 
+/**
+ * @tc.number: AccessibilitySettingsConfig_Unittest_BatchLoad_001
+ * @tc.name: BatchLoad
+ * @tc.desc: Test the values read by the batch query are served without writing any default
+ */
+HWTEST_F(AccessibilitySettingsConfigTest, AccessibilitySettingsConfig_Unittest_BatchLoad_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilitySettingsConfig_Unittest_BatchLoad_001 start";
+    AccessibilityDatashareHelper datashare(DATASHARE_TYPE::SECURE, ACCOUNT_ID);
+    // the state left by a batch query which found both keys
+    datashare.batchKeys_ = { CONFIG_CAPTION, CONFIG_SHORTCUT_TIMEOUT };
+    datashare.batchValues_[CONFIG_CAPTION] = "1";
+    datashare.batchValues_[CONFIG_SHORTCUT_TIMEOUT] = std::to_string(SHORT_KEY_TIMEOUT);
+    datashare.isBatchLoading_ = true;
+
+    EXPECT_TRUE(datashare.GetBoolValue(CONFIG_CAPTION, false));
+    EXPECT_EQ(datashare.GetIntValue(CONFIG_SHORTCUT_TIMEOUT, 0), SHORT_KEY_TIMEOUT);
+    EXPECT_TRUE(datashare.batchDefaultValues_.empty());
+    EXPECT_EQ(datashare.EndBatchLoad(), 0u);
+    GTEST_LOG_(INFO) << "AccessibilitySettingsConfig_Unittest_BatchLoad_001 end";
+}
+
+/**
+ * @tc.number: AccessibilitySettingsConfig_Unittest_BatchLoad_002
+ * @tc.name: BatchLoad
+ * @tc.desc: Test the default value of a missing key is kept once and written by EndBatchLoad only
+ */
+HWTEST_F(AccessibilitySettingsConfigTest, AccessibilitySettingsConfig_Unittest_BatchLoad_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilitySettingsConfig_Unittest_BatchLoad_002 start";
+    AccessibilityDatashareHelper datashare(DATASHARE_TYPE::SECURE, ACCOUNT_ID);
+    // the state left by a batch query which found none of the keys
+    datashare.batchKeys_ = { CONFIG_CAPTION, CONFIG_SHORTCUT_TIMEOUT };
+    datashare.isBatchLoading_ = true;
+
+    EXPECT_FALSE(datashare.GetBoolValue(CONFIG_CAPTION, false));
+    EXPECT_FALSE(datashare.GetBoolValue(CONFIG_CAPTION, true));
+    EXPECT_EQ(datashare.GetIntValue(CONFIG_SHORTCUT_TIMEOUT, SHORT_KEY_TIMEOUT), SHORT_KEY_TIMEOUT);
+    ASSERT_EQ(datashare.batchDefaultValues_.size(), 2u);
+    EXPECT_EQ(datashare.batchDefaultValues_[CONFIG_CAPTION], "0");
+
+    EXPECT_EQ(datashare.EndBatchLoad(), 2u);
+    EXPECT_FALSE(datashare.isBatchLoading_);
+    EXPECT_EQ(datashare.EndBatchLoad(), 0u);
+    GTEST_LOG_(INFO) << "AccessibilitySettingsConfig_Unittest_BatchLoad_002 end";
+}
+
+/**
+ * @tc.number: AccessibilitySettingsConfig_Unittest_BatchLoad_003
+ * @tc.name: BatchLoad
+ * @tc.desc: Test a put during the batch load replaces the default value of the key
+ */
+HWTEST_F(AccessibilitySettingsConfigTest, AccessibilitySettingsConfig_Unittest_BatchLoad_003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilitySettingsConfig_Unittest_BatchLoad_003 start";
+    AccessibilityDatashareHelper datashare(DATASHARE_TYPE::SECURE, ACCOUNT_ID);
+    datashare.batchKeys_ = { CONFIG_CAPTION };
+    datashare.isBatchLoading_ = true;
+
+    EXPECT_FALSE(datashare.GetBoolValue(CONFIG_CAPTION, false));
+    EXPECT_EQ(datashare.batchDefaultValues_.size(), 1u);
+    datashare.PutBoolValue(CONFIG_CAPTION, true);
+    EXPECT_TRUE(datashare.batchDefaultValues_.empty());
+    EXPECT_TRUE(datashare.GetBoolValue(CONFIG_CAPTION, false));
+    EXPECT_EQ(datashare.EndBatchLoad(), 0u);
+    GTEST_LOG_(INFO) << "AccessibilitySettingsConfig_Unittest_BatchLoad_003 end";
+}
+
+/**
+ * @tc.number: AccessibilitySettingsConfig_Unittest_BatchLoad_004
+ * @tc.name: BatchLoad
+ * @tc.desc: Test the Get functions fall back to the query of each key when the batch query fails
+ */
+HWTEST_F(AccessibilitySettingsConfigTest, AccessibilitySettingsConfig_Unittest_BatchLoad_004, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilitySettingsConfig_Unittest_BatchLoad_004 start";
+    // no datashare helper is created without Initialize, so the batch query fails
+    AccessibilityDatashareHelper datashare(DATASHARE_TYPE::SECURE, ACCOUNT_ID);
+    EXPECT_NE(datashare.BeginBatchLoad({ CONFIG_CAPTION }), RET_OK);
+    EXPECT_FALSE(datashare.isBatchLoading_);
+
+    EXPECT_TRUE(datashare.GetBoolValue(CONFIG_CAPTION, true));
+    EXPECT_TRUE(datashare.batchValues_.empty());
+    EXPECT_TRUE(datashare.batchDefaultValues_.empty());
+    EXPECT_EQ(datashare.EndBatchLoad(), 0u);
+    GTEST_LOG_(INFO) << "AccessibilitySettingsConfig_Unittest_BatchLoad_004 end";
+}
+
+/**
+ * @tc.number: AccessibilitySettingsConfig_Unittest_BatchLoad_005
+ * @tc.name: BatchLoad
+ * @tc.desc: Test the values read by the batch query match the values read by the query of each key
+ */
+HWTEST_F(AccessibilitySettingsConfigTest, AccessibilitySettingsConfig_Unittest_BatchLoad_005, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilitySettingsConfig_Unittest_BatchLoad_005 start";
+    AccessibilityDatashareHelper datashare(DATASHARE_TYPE::SECURE, ACCOUNT_ID);
+    datashare.Initialize(POWER_MANAGER_SERVICE_ID);
+    std::vector<std::string> keys = { CONFIG_CAPTION, CONFIG_SHORTCUT_TIMEOUT };
+    std::map<std::string, std::string> values;
+    for (auto &key : keys) {
+        values[key] = datashare.GetStringValue(key, "");
+    }
+
+    // a failed batch query falls back to the query of each key, the values match either way
+    datashare.BeginBatchLoad(keys);
+    for (auto &key : keys) {
+        EXPECT_EQ(datashare.GetStringValue(key, ""), values[key]) << key;
+    }
+    EXPECT_EQ(datashare.EndBatchLoad(), 0u);
+    GTEST_LOG_(INFO) << "AccessibilitySettingsConfig_Unittest_BatchLoad_005 end";
+}
+
 /**
  * @tc.number: AccessibilitySettingsConfig_Unittest_SetEnabled_001
  * @tc.name: SetEnabled
@@ -747,6 +864,35 @@ HWTEST_F(AccessibilitySettingsConfigTest,
     GTEST_LOG_(INFO) << "AccessibilitySettingsConfig_Unittest_SetBrightnessDiscount_002 end";
 }
 
+/**
+ * @tc.number: AccessibilitySettingsConfig_Unittest_SetBrightnessDiscount_003
+ * @tc.name: SetBrightnessDiscount
+ * @tc.desc: Test repeated SetBrightnessDiscount calls reach the datashare as one write of the last value
+ */
+HWTEST_F(AccessibilitySettingsConfigTest,
+    AccessibilitySettingsConfig_Unittest_SetBrightnessDiscount_003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilitySettingsConfig_Unittest_SetBrightnessDiscount_003 start";
+    settingConfig_->Init();
+    const int32_t setCount = 100;
+    for (int32_t i = 1; i <= setCount; i++) {
+        float discount = static_cast<float>(i) / setCount;
+        EXPECT_EQ(RET_OK, settingConfig_->SetBrightnessDiscount(discount));
+        EXPECT_EQ(discount, settingConfig_->GetBrightnessDiscount());
+    }
+    // the puts are coalesced into the last value of the key
+    ASSERT_EQ(settingConfig_->pendingValues_.size(), 1u);
+    EXPECT_EQ(settingConfig_->pendingValues_[BRIGHTNESS_DISCOUNT_KEY], std::to_string(1.0f));
+
+    settingConfig_->FlushPendingSettings();
+    EXPECT_TRUE(settingConfig_->pendingValues_.empty());
+    SettingsFlushStats flushStats = settingConfig_->GetSettingsFlushStats();
+    EXPECT_EQ(flushStats.committedCount + flushStats.failedCount, 1u);
+    EXPECT_EQ(RET_OK, settingConfig_->FlushPendingSettings());
+    EXPECT_EQ(1.0f, settingConfig_->GetBrightnessDiscount());
+    GTEST_LOG_(INFO) << "AccessibilitySettingsConfig_Unittest_SetBrightnessDiscount_003 end";
+}
+
 /**
  * @tc.number: AccessibilitySettingsConfig_Unittest_SetAudioBalance_001
  * @tc.name: SetAudioBalance
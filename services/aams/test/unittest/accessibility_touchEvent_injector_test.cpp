@@ -212,5 +212,36 @@ HWTEST_F(TouchEventInjectorTest, TouchEventInjector_Unittest_TouchEventInjector_
 
     GTEST_LOG_(INFO) << "TouchEventInjector_Unittest_TouchEventInjector_006 end";
 }
+
+/**
+ * @tc.number: TouchEventInjector007
+ * @tc.name:TouchEventInjector
+ * @tc.desc: Check the jitter statistics of a long move gesture.
+ */
+HWTEST_F(TouchEventInjectorTest, TouchEventInjector_Unittest_TouchEventInjector_007, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "TouchEventInjector_Unittest_TouchEventInjector_007 start";
+
+    touchEventInjector_->SetNext(inputInterceptor_);
+
+    const int32_t positionNum = 20;
+    std::shared_ptr<AccessibilityGestureInjectPath> gesturePath = std::make_shared<AccessibilityGestureInjectPath>();
+    for (int32_t i = 0; i < positionNum; i++) {
+        AccessibilityGesturePosition point {10.0f, 10.0f + i * 10.0f};
+        gesturePath->AddPosition(point);
+    }
+    gesturePath->SetDurationTime(190);
+
+    uint64_t injectedCount = touchEventInjector_->GetInjectionJitterStats().injectedCount;
+    touchEventInjector_->InjectEvents(gesturePath);
+    sleep(SLEEP_TIME_2);
+    InjectionJitterStats stats = touchEventInjector_->GetInjectionJitterStats();
+    // down, the moves of every other position, the move and up of the last position
+    EXPECT_EQ(stats.injectedCount - injectedCount, static_cast<uint64_t>(positionNum + 1));
+    EXPECT_GE(stats.maxJitter, stats.averageJitter);
+    AccessibilityAbilityHelper::GetInstance().ClearTouchEventActionVector();
+
+    GTEST_LOG_(INFO) << "TouchEventInjector_Unittest_TouchEventInjector_007 end";
+}
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
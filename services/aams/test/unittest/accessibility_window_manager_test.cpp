@@ -1745,6 +1745,38 @@ HWTEST_F(AccessibilityWindowManagerTest, AccessibilityWindowManager_Unittest_IsI
     GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_IsInnerWindowRootElement001 end";
 }
 
+/**
+ * @tc.number: AccessibilityWindowManager_Unittest_GetInnerWindowId001
+ * @tc.name: GetInnerWindowId
+ * @tc.desc: Test the inner window of an element is indexed until its window is removed
+ */
+HWTEST_F(AccessibilityWindowManagerTest, AccessibilityWindowManager_Unittest_GetInnerWindowId001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_GetInnerWindowId001 start";
+    const int64_t rootElementId = 1;
+    const int64_t childElementId = 2;
+    int32_t windowId = INVALID_WINDOW_ID;
+    AccessibilityWindowManager& mgr = Singleton<AccessibilityWindowManager>::GetInstance();
+    mgr.sceneBoardElementIdMap_.Clear();
+
+    mgr.sceneBoardElementIdMap_.InsertPair(INNER_WINDOW_ID, rootElementId);
+    EXPECT_TRUE(mgr.sceneBoardElementIdMap_.GetInnerWindowId(rootElementId, windowId));
+    EXPECT_EQ(windowId, INNER_WINDOW_ID);
+    EXPECT_FALSE(mgr.sceneBoardElementIdMap_.GetInnerWindowId(childElementId, windowId));
+
+    mgr.sceneBoardElementIdMap_.InsertElements(INNER_WINDOW_ID, { childElementId });
+    windowId = INVALID_WINDOW_ID;
+    EXPECT_TRUE(mgr.sceneBoardElementIdMap_.GetInnerWindowId(childElementId, windowId));
+    EXPECT_EQ(windowId, INNER_WINDOW_ID);
+
+    mgr.sceneBoardElementIdMap_.RemovePair(INNER_WINDOW_ID);
+    EXPECT_FALSE(mgr.sceneBoardElementIdMap_.GetInnerWindowId(rootElementId, windowId));
+    EXPECT_FALSE(mgr.sceneBoardElementIdMap_.GetInnerWindowId(childElementId, windowId));
+    mgr.sceneBoardElementIdMap_.Clear();
+    GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_GetInnerWindowId001 end";
+}
+
 /**
  * @tc.number: AccessibilityWindowManager_Unittest_GetSceneBoardElementId001
  * @tc.name: GetSceneBoardElementId
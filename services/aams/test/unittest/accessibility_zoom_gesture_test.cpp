@@ -504,5 +504,34 @@ HWTEST_F(AccessibilityZoomGestureUnitTest, AccessibilityZoomGesture_Unittest_OnP
 
     GTEST_LOG_(INFO) << "AccessibilityZoomGesture_Unittest_OnPointerEvent_011 end";
 }
+
+/**
+ * @tc.number: AccessibilityZoomGesture_Unittest_OnPointerEvent_012
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Test the cached event shares the dispatched event and copies any other event
+ */
+HWTEST_F(AccessibilityZoomGestureUnitTest, AccessibilityZoomGesture_Unittest_OnPointerEvent_012, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityZoomGesture_Unittest_OnPointerEvent_012 start";
+    std::shared_ptr<MMI::PointerEvent> event = CreatePointerEvent(MMI::PointerEvent::SOURCE_TYPE_TOUCHSCREEN,
+        MMI::PointerEvent::POINTER_ACTION_DOWN);
+    if (!event) {
+        return;
+    }
+    MMI::PointerEvent::PointerItem item;
+    event->AddPointerItem(item);
+
+    // Not dispatched, the cached event is a copy.
+    zoomGesture_->OnPointerEvent(*event);
+    EXPECT_EQ(event.use_count(), 1);
+
+    zoomGesture_ = std::make_shared<AccessibilityZoomGesture>();
+    EventTransmission::SetDispatchingPointerEvent(event);
+    zoomGesture_->OnPointerEvent(*event);
+    EventTransmission::SetDispatchingPointerEvent(nullptr);
+    EXPECT_GT(event.use_count(), 1);
+
+    GTEST_LOG_(INFO) << "AccessibilityZoomGesture_Unittest_OnPointerEvent_012 end";
+}
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
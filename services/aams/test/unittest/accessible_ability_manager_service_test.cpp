@@ -2107,6 +2107,36 @@ HWTEST_F(AccessibleAbilityManagerServiceUnitTest, FindInnerWindowId_001, TestSiz
     GTEST_LOG_(INFO) << "Accessible_Ability_Manager_ServiceUnittest_FindInnerWindowId_001 end";
 }
 
+/**
+ * @tc.number: Accessible_Ability_Manager_ServiceUnittest_GetPendingRequestNums_001
+ * @tc.name: GetPendingRequestNums
+ * @tc.desc: Test the pending requests of a window are counted until they complete
+ */
+HWTEST_F(AccessibleAbilityManagerServiceUnitTest, GetPendingRequestNums_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "Accessible_Ability_Manager_ServiceUnittest_GetPendingRequestNums_001 start";
+    const int32_t windowId = 1;
+    const int32_t treeId = 0;
+    const int32_t requestId = 100;
+    auto &aams = Singleton<AccessibleAbilityManagerService>::GetInstance();
+    aams.AddRequestId(windowId, treeId, requestId, nullptr);
+    aams.AddRequestId(windowId, treeId, requestId + 1, nullptr);
+    std::map<int32_t, size_t> requestNums;
+    aams.GetPendingRequestNums(requestNums);
+    EXPECT_EQ(requestNums[windowId], 2);
+
+    aams.RemoveRequestId(requestId);
+    requestNums.clear();
+    aams.GetPendingRequestNums(requestNums);
+    EXPECT_EQ(requestNums[windowId], 1);
+
+    aams.RemoveRequestId(requestId + 1);
+    requestNums.clear();
+    aams.GetPendingRequestNums(requestNums);
+    EXPECT_EQ(requestNums.count(windowId), 0);
+    GTEST_LOG_(INFO) << "Accessible_Ability_Manager_ServiceUnittest_GetPendingRequestNums_001 end";
+}
+
 /**
  * @tc.number: Accessible_Ability_Manager_ServiceUnittest_GetFocusedWindowId_001
  * @tc.name: GetFocusedWindowId
@@ -2212,6 +2242,39 @@ HWTEST_F(AccessibleAbilityManagerServiceUnitTest, SendEvent_002, TestSize.Level1
     GTEST_LOG_(INFO) << "AccessibleAbilityManagerServiceUnitTest_SendEvent_002 end";
 }
 
+/**
+ * @tc.number: AccessibleAbilityManagerServiceUnitTest_SendEvent_003
+ * @tc.name: SendEvent
+ * @tc.desc: Test a burst of scrolled events is merged and a focus event passes through
+ */
+HWTEST_F(AccessibleAbilityManagerServiceUnitTest, SendEvent_003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibleAbilityManagerServiceUnitTest_SendEvent_003 start";
+    const int32_t eventNum = 3;
+    auto &aams = Singleton<AccessibleAbilityManagerService>::GetInstance();
+    EventCoalescingStats before;
+    aams.GetEventCoalescingStats(before);
+
+    AccessibilityEventInfo event;
+    event.SetWindowId(1);
+    event.SetSource(1);
+    event.SetEventType(TYPE_VIEW_SCROLLED_EVENT);
+    for (int32_t i = 0; i < eventNum; i++) {
+        EXPECT_EQ(aams.SendEvent(event), RET_OK);
+    }
+    event.SetEventType(TYPE_VIEW_FOCUSED_EVENT);
+    EXPECT_EQ(aams.SendEvent(event), RET_OK);
+    sleep(SLEEP_TIME_1);
+
+    EventCoalescingStats after;
+    aams.GetEventCoalescingStats(after);
+    EXPECT_EQ(after.receivedCount - before.receivedCount, static_cast<uint64_t>(eventNum));
+    EXPECT_EQ(after.mergedCount - before.mergedCount, static_cast<uint64_t>(eventNum - 1));
+    EXPECT_EQ(after.deliveredCount - before.deliveredCount, 1u);
+    EXPECT_EQ(after.passThroughCount - before.passThroughCount, 1u);
+    GTEST_LOG_(INFO) << "AccessibleAbilityManagerServiceUnitTest_SendEvent_003 end";
+}
+
 
 /**
  * @tc.number: AccessibleAbility_ManagerService_UnitTest_DeregisterElementOperator_003
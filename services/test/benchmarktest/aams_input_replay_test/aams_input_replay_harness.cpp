@@ -0,0 +1,532 @@
+/*
+ * Copyright (C) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "aams_input_replay_harness.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <thread>
+
+#define private public
+#include "accessibility_input_interceptor.h"
+#include "accessibility_zoom_gesture.h"
+#undef private
+#include "accessibility_common_helper.h"
+#include "accessibility_keyevent_filter.h"
+#include "accessibility_mouse_autoclick.h"
+#include "accessibility_mouse_key.h"
+#include "accessibility_mt_helper.h"
+#include "accessibility_screen_touch.h"
+#include "accessibility_touchEvent_injector.h"
+#include "accessibility_touch_guider.h"
+#include "accessible_ability_channel.h"
+#include "accessible_ability_connection.h"
+#include "accessible_ability_manager_service.h"
+#include "ffrt.h"
+#include "hilog_wrapper.h"
+#include "mock_input_manager.h"
+
+namespace {
+    // Allocations made by the calling thread, counted by the replaced operator new below.
+    thread_local uint64_t g_allocCount = 0;
+}
+
+void* operator new(std::size_t size)
+{
+    g_allocCount++;
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr) {
+        std::abort();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t size) noexcept
+{
+    (void)size;
+    std::free(ptr);
+}
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr double NS_PER_US = 1000.0;
+    constexpr int32_t PERCENT_50 = 50;
+    constexpr int32_t PERCENT_90 = 90;
+    constexpr int32_t PERCENT_99 = 99;
+    constexpr int32_t PERCENT_100 = 100;
+    const std::map<std::string, uint32_t> TRACE_FEATURES = {
+        {"screen_magnification", AccessibilityInputInterceptor::FEATURE_SCREEN_MAGNIFICATION},
+        {"touch_exploration", AccessibilityInputInterceptor::FEATURE_TOUCH_EXPLORATION},
+        {"filter_key", AccessibilityInputInterceptor::FEATURE_FILTER_KEY_EVENTS},
+        {"inject_touch", AccessibilityInputInterceptor::FEATURE_INJECT_TOUCH_EVENTS},
+        {"mouse_autoclick", AccessibilityInputInterceptor::FEATURE_MOUSE_AUTOCLICK},
+        {"mouse_key", AccessibilityInputInterceptor::FEATURE_MOUSE_KEY},
+        {"screen_touch", AccessibilityInputInterceptor::FEATURE_SCREEN_TOUCH}
+    };
+
+    // Time already charged to the probes called from inside the probe on top of the stack.
+    thread_local std::vector<int64_t> g_nestedTimes;
+    thread_local std::vector<uint64_t> g_nestedAllocs;
+
+    int64_t GetSteadyTimeNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    int64_t GetSteadyTimeUs()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Skips the blanks left on the line, true when nothing else is left.
+    bool IsLineEnd(std::istringstream &line)
+    {
+        line >> std::ws;
+        return line.eof();
+    }
+
+    double GetPercentile(const std::vector<int64_t> &sortedTimes, int32_t percent)
+    {
+        if (sortedTimes.empty()) {
+            return 0;
+        }
+        size_t index = (sortedTimes.size() - 1) * static_cast<size_t>(percent) / PERCENT_100;
+        return static_cast<double>(sortedTimes[index]) / NS_PER_US;
+    }
+
+    std::string GetStageName(const sptr<EventTransmission> &stage)
+    {
+        EventTransmission *node = stage.GetRefPtr();
+        if (dynamic_cast<AccessibilityInputInterceptor *>(node) != nullptr) {
+            return "Interceptor";
+        } else if (dynamic_cast<AccessibilityZoomGesture *>(node) != nullptr) {
+            return "ZoomGesture";
+        } else if (dynamic_cast<TouchGuider *>(node) != nullptr) {
+            return "TouchGuider";
+        } else if (dynamic_cast<AccessibilityScreenTouch *>(node) != nullptr) {
+            return "ScreenTouch";
+        } else if (dynamic_cast<TouchEventInjector *>(node) != nullptr) {
+            return "TouchEventInjector";
+        } else if (dynamic_cast<AccessibilityMouseAutoclick *>(node) != nullptr) {
+            return "MouseAutoclick";
+        } else if (dynamic_cast<AccessibilityMouseKey *>(node) != nullptr) {
+            return "MouseKey";
+        } else if (dynamic_cast<KeyEventFilter *>(node) != nullptr) {
+            return "KeyEventFilter";
+        }
+        return "Unknown";
+    }
+} // namespace
+
+void InputReplayRecorder::Record(const std::string &stage, int64_t selfTime, uint64_t allocCount)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = stages_.find(stage);
+    if (iter == stages_.end()) {
+        stageOrder_.push_back(stage);
+        iter = stages_.emplace(stage, StageSamples()).first;
+    }
+    iter->second.selfTimes.push_back(selfTime);
+    iter->second.allocCount += allocCount;
+}
+
+void InputReplayRecorder::RecordZoomIn()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    zoomInCount_++;
+}
+
+void InputReplayRecorder::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    stageOrder_.clear();
+    stages_.clear();
+    zoomInCount_ = 0;
+}
+
+InputReplayReport InputReplayRecorder::GetReport()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    InputReplayReport report;
+    report.zoomInCount = zoomInCount_;
+    for (auto &name : stageOrder_) {
+        std::vector<int64_t> sortedTimes = stages_[name].selfTimes;
+        std::sort(sortedTimes.begin(), sortedTimes.end());
+        StageLatencyReport stage;
+        stage.name = name;
+        stage.samples = sortedTimes.size();
+        stage.p50 = GetPercentile(sortedTimes, PERCENT_50);
+        stage.p90 = GetPercentile(sortedTimes, PERCENT_90);
+        stage.p99 = GetPercentile(sortedTimes, PERCENT_99);
+        stage.max = GetPercentile(sortedTimes, PERCENT_100);
+        stage.allocCount = stages_[name].allocCount;
+        for (int64_t selfTime : sortedTimes) {
+            report.chainTime += selfTime;
+        }
+        report.stages.push_back(stage);
+    }
+    return report;
+}
+
+InputReplayStageProbe::InputReplayStageProbe(const std::string &name, const sptr<EventTransmission> &stage,
+    InputReplayRecorder &recorder, bool copyEvent) : name_(name), recorder_(recorder), copyEvent_(copyEvent)
+{
+    SetNext(stage);
+    isZoomGesture_ = dynamic_cast<AccessibilityZoomGesture *>(stage.GetRefPtr()) != nullptr;
+}
+
+template<typename Func>
+bool InputReplayStageProbe::Measure(Func func)
+{
+    uint64_t probeAllocCount = g_allocCount;
+    int64_t probeStartTime = GetSteadyTimeNs();
+    AccessibilityZoomGesture *zoomGesture =
+        isZoomGesture_ ? static_cast<AccessibilityZoomGesture *>(GetNext().GetRefPtr()) : nullptr;
+    bool isZoomedIn = zoomGesture != nullptr && zoomGesture->state_ != READY_STATE;
+    g_nestedTimes.push_back(0);
+    g_nestedAllocs.push_back(0);
+
+    uint64_t allocCount = g_allocCount;
+    int64_t startTime = GetSteadyTimeNs();
+    bool result = func();
+    int64_t elapsedTime = GetSteadyTimeNs() - startTime;
+    uint64_t elapsedAllocs = g_allocCount - allocCount;
+
+    int64_t nestedTime = g_nestedTimes.back();
+    uint64_t nestedAllocs = g_nestedAllocs.back();
+    g_nestedTimes.pop_back();
+    g_nestedAllocs.pop_back();
+    recorder_.Record(name_, elapsedTime - nestedTime, elapsedAllocs - nestedAllocs);
+    if (zoomGesture != nullptr && !isZoomedIn && zoomGesture->state_ == ZOOMIN_STATE) {
+        recorder_.RecordZoomIn();
+    }
+
+    // Charge the whole probe, bookkeeping included, to the caller so it never shows up as stage time.
+    if (!g_nestedTimes.empty()) {
+        g_nestedTimes.back() += GetSteadyTimeNs() - probeStartTime;
+        g_nestedAllocs.back() += g_allocCount - probeAllocCount;
+    }
+    return result;
+}
+
+bool InputReplayStageProbe::OnPointerEvent(MMI::PointerEvent &event)
+{
+    if (copyEvent_) {
+        // Copied before the measurement starts, the stages only pay for the copies they keep.
+        MMI::PointerEvent copiedEvent(event);
+        return Measure([this, &copiedEvent]() { return EventTransmission::OnPointerEvent(copiedEvent); });
+    }
+    return Measure([this, &event]() { return EventTransmission::OnPointerEvent(event); });
+}
+
+bool InputReplayStageProbe::OnKeyEvent(MMI::KeyEvent &event)
+{
+    return Measure([this, &event]() { return EventTransmission::OnKeyEvent(event); });
+}
+
+bool AamsInputReplayHarness::ParseFeatures(std::istringstream &line, uint32_t &features)
+{
+    std::string name;
+    while (line >> name) {
+        auto iter = TRACE_FEATURES.find(name);
+        if (iter == TRACE_FEATURES.end()) {
+            HILOG_ERROR("unknown feature %{public}s", name.c_str());
+            return false;
+        }
+        features |= iter->second;
+    }
+    return true;
+}
+
+bool AamsInputReplayHarness::ParseEvent(std::istringstream &line, InputTraceEvent &event)
+{
+    if (!(line >> event.time >> event.type)) {
+        return false;
+    }
+    char action = 0;
+    switch (event.type) {
+        case 'E':
+            return IsLineEnd(line);
+        case 'K':
+            if (!(line >> action >> event.keyCode)) {
+                return false;
+            }
+            event.action = (action == 'D') ? MMI::KeyEvent::KEY_ACTION_DOWN : MMI::KeyEvent::KEY_ACTION_UP;
+            return (action == 'D' || action == 'U') && IsLineEnd(line);
+        case 'T':
+            break;
+        default:
+            return false;
+    }
+
+    if (!(line >> action >> event.pointerId)) {
+        return false;
+    }
+    if (action == 'D') {
+        event.action = MMI::PointerEvent::POINTER_ACTION_DOWN;
+    } else if (action == 'M') {
+        event.action = MMI::PointerEvent::POINTER_ACTION_MOVE;
+    } else if (action == 'U') {
+        event.action = MMI::PointerEvent::POINTER_ACTION_UP;
+    } else {
+        return false;
+    }
+    InputTracePointer pointer;
+    char idSeparator = 0;
+    char xySeparator = 0;
+    // Every token left on the line has to be a pointer, a malformed one fails the whole line.
+    while (!IsLineEnd(line)) {
+        if (!(line >> pointer.id >> idSeparator >> pointer.x >> xySeparator >> pointer.y) ||
+            idSeparator != ':' || xySeparator != ',') {
+            return false;
+        }
+        event.pointers.push_back(pointer);
+    }
+    return !event.pointers.empty();
+}
+
+bool AamsInputReplayHarness::LoadTrace(const std::string &path, InputTrace &trace)
+{
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        HILOG_ERROR("open trace %{public}s failed", path.c_str());
+        return false;
+    }
+
+    trace.name = path.substr(path.find_last_of('/') + 1);
+    trace.features = 0;
+    trace.events.clear();
+    std::string content;
+    int32_t lineNum = 0;
+    while (std::getline(file, content)) {
+        lineNum++;
+        if (content.empty() || content[0] == '#') {
+            continue;
+        }
+        std::istringstream line(content);
+        bool result = false;
+        if (content.rfind("features", 0) == 0) {
+            std::string keyword;
+            line >> keyword;
+            result = ParseFeatures(line, trace.features);
+        } else {
+            InputTraceEvent event;
+            result = ParseEvent(line, event);
+            if (result && !trace.events.empty() && event.time < trace.events.back().time) {
+                result = false;
+            }
+            if (result) {
+                trace.events.push_back(event);
+            }
+        }
+        if (!result) {
+            HILOG_ERROR("%{public}s:%{public}d is malformed", trace.name.c_str(), lineNum);
+            return false;
+        }
+    }
+    return !trace.events.empty() && trace.features != 0;
+}
+
+bool AamsInputReplayHarness::SetUp(const InputTrace &trace, bool copyEvents)
+{
+    if (!AccessibilityCommonHelper::GetInstance().GetIsServicePublished()) {
+        Singleton<AccessibleAbilityManagerService>::GetInstance().OnStart();
+        AccessibilityCommonHelper::GetInstance().WaitForServicePublish();
+        Singleton<AccessibleAbilityManagerService>::GetInstance().SwitchedUser(AccessibilityHelper::accountId_);
+        ConnectTouchGuideAbility();
+    }
+
+    sptr<AccessibilityInputInterceptor> interceptor = AccessibilityInputInterceptor::GetInstance();
+    if (!interceptor) {
+        return false;
+    }
+    // Rebuild the chain so every replay starts from fresh stages.
+    copyEvents_ = copyEvents;
+    interceptor->SetAvailableFunctions(0);
+    interceptor->SetAvailableFunctions(trace.features);
+    RunOnInputRunner([this]() { InterposeProbes(); });
+
+    if (!consumer_) {
+        consumer_ = std::make_shared<AccessibilityInputEventConsumer>();
+    }
+    recorder_.Clear();
+    replayedCount_ = 0;
+    AccessibilityHelper::GetInstance().ClearGestureIds();
+    MMI::MockInputManager::ClearTouchActions();
+    return true;
+}
+
+void AamsInputReplayHarness::ConnectTouchGuideAbility()
+{
+    // Gestures recognized by the touch guider are only delivered to a connected ability.
+    AccessibilityAbilityInitParams initParams;
+    std::shared_ptr<AccessibilityAbilityInfo> abilityInfo = std::make_shared<AccessibilityAbilityInfo>(initParams);
+    abilityInfo->SetAccessibilityAbilityType(AccessibilityAbilityTypes::ACCESSIBILITY_ABILITY_TYPE_ALL);
+    abilityInfo->SetCapabilityValues(Capability::CAPABILITY_TOUCH_GUIDE | Capability::CAPABILITY_GESTURE |
+        Capability::CAPABILITY_KEY_EVENT_OBSERVER | Capability::CAPABILITY_ZOOM);
+    AppExecFwk::ElementName elementName("deviceId", "bundleName", "name");
+    sptr<AccessibilityAccountData> accountData =
+        Singleton<AccessibleAbilityManagerService>::GetInstance().GetCurrentAccountData();
+    if (!accountData) {
+        return;
+    }
+    accountData->AddInstalledAbility(*abilityInfo);
+    sptr<AccessibleAbilityConnection> connection =
+        new AccessibleAbilityConnection(accountData->GetAccountId(), 0, *abilityInfo);
+    sptr<AccessibleAbilityChannel> channel =
+        new AccessibleAbilityChannel(accountData->GetAccountId(), abilityInfo->GetId());
+    connection->OnAbilityConnectDoneSync(elementName, channel);
+}
+
+void AamsInputReplayHarness::RunOnInputRunner(const std::function<void()> &task)
+{
+    std::shared_ptr<AAMSEventHandler> &handler =
+        Singleton<AccessibleAbilityManagerService>::GetInstance().GetInputHandler();
+    if (!handler) {
+        task();
+        return;
+    }
+    ffrt::promise<void> syncPromise;
+    ffrt::future syncFuture = syncPromise.get_future();
+    bool posted = handler->PostTask([&task, &syncPromise]() {
+        task();
+        syncPromise.set_value();
+        }, "InputReplay", 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+    if (!posted) {
+        task();
+        return;
+    }
+    syncFuture.wait();
+}
+
+sptr<EventTransmission> AamsInputReplayHarness::InterposeChain(const sptr<EventTransmission> &header)
+{
+    sptr<EventTransmission> newHeader = nullptr;
+    sptr<EventTransmission> previous = nullptr;
+    sptr<AccessibilityInputInterceptor> interceptor = AccessibilityInputInterceptor::GetInstance();
+    for (sptr<EventTransmission> stage = header; stage != nullptr; stage = stage->GetNext()) {
+        // Only the first probe copies, the stages after it forward what they were given.
+        sptr<EventTransmission> probe = new InputReplayStageProbe(GetStageName(stage), stage, recorder_,
+            copyEvents_ && previous == nullptr);
+        if (previous == nullptr) {
+            newHeader = probe;
+        } else {
+            previous->SetNext(probe);
+        }
+        // The interceptor ends every chain and hands the event back to the input manager.
+        if (stage == interceptor) {
+            break;
+        }
+        previous = stage;
+    }
+    return newHeader;
+}
+
+void AamsInputReplayHarness::InterposeProbes()
+{
+    sptr<AccessibilityInputInterceptor> interceptor = AccessibilityInputInterceptor::GetInstance();
+    if (interceptor->pointerEventTransmitters_) {
+        interceptor->pointerEventTransmitters_ = InterposeChain(interceptor->pointerEventTransmitters_);
+    }
+    if (interceptor->keyEventTransmitters_) {
+        interceptor->keyEventTransmitters_ = InterposeChain(interceptor->keyEventTransmitters_);
+    }
+    if (interceptor->mouseKey_) {
+        interceptor->mouseKey_ = new InputReplayStageProbe("MouseKey", interceptor->mouseKey_, recorder_);
+    }
+}
+
+void AamsInputReplayHarness::InjectEvent(const InputTraceEvent &traceEvent, int64_t virtualTime)
+{
+    if (traceEvent.type == 'K') {
+        std::shared_ptr<MMI::KeyEvent> keyEvent = MMI::KeyEvent::Create();
+        MMI::KeyEvent::KeyItem item;
+        item.SetKeyCode(traceEvent.keyCode);
+        item.SetPressed(traceEvent.action == MMI::KeyEvent::KEY_ACTION_DOWN);
+        keyEvent->AddKeyItem(item);
+        keyEvent->SetKeyCode(traceEvent.keyCode);
+        keyEvent->SetKeyAction(traceEvent.action);
+        keyEvent->SetActionTime(virtualTime);
+        consumer_->OnInputEvent(keyEvent);
+        return;
+    }
+
+    std::shared_ptr<MMI::PointerEvent> pointerEvent = MMI::PointerEvent::Create();
+    for (auto &tracePointer : traceEvent.pointers) {
+        MMI::PointerEvent::PointerItem item;
+        item.SetPointerId(tracePointer.id);
+        item.SetDisplayX(tracePointer.x);
+        item.SetDisplayY(tracePointer.y);
+        item.SetPressed(traceEvent.action != MMI::PointerEvent::POINTER_ACTION_UP ||
+            tracePointer.id != traceEvent.pointerId);
+        pointerEvent->AddPointerItem(item);
+    }
+    pointerEvent->SetPointerId(traceEvent.pointerId);
+    pointerEvent->SetPointerAction(traceEvent.action);
+    pointerEvent->SetSourceType(MMI::PointerEvent::SOURCE_TYPE_TOUCHSCREEN);
+    pointerEvent->SetActionTime(virtualTime);
+    pointerEvent->SetActionStartTime(virtualTime);
+    consumer_->OnInputEvent(pointerEvent);
+}
+
+void AamsInputReplayHarness::Replay(const InputTrace &trace)
+{
+    // The virtual clock starts with the replay, trace times are offsets on it. The gaps are slept through
+    // because the stage timers are EventHandler events on the input runner, which only run on the real clock.
+    int64_t startTime = GetSteadyTimeUs();
+    for (auto &traceEvent : trace.events) {
+        int64_t waitTime = startTime + traceEvent.time - GetSteadyTimeUs();
+        if (waitTime > 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(waitTime));
+        }
+        if (traceEvent.type == 'E') {
+            break;
+        }
+        InjectEvent(traceEvent, startTime + traceEvent.time);
+        replayedCount_++;
+    }
+    // Let the input runner finish what the last events scheduled.
+    RunOnInputRunner([]() {});
+}
+
+InputReplayReport AamsInputReplayHarness::GetReport()
+{
+    InputReplayReport report = recorder_.GetReport();
+    report.replayedCount = replayedCount_;
+    report.forwardedCount = MMI::MockInputManager::GetTouchActions().size();
+    report.gestureIds = AccessibilityHelper::GetInstance().GetGestureIds();
+    return report;
+}
+
+void AamsInputReplayHarness::TearDown()
+{
+    sptr<AccessibilityInputInterceptor> interceptor = AccessibilityInputInterceptor::GetInstance();
+    if (interceptor) {
+        interceptor->SetAvailableFunctions(0);
+    }
+    recorder_.Clear();
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AAMS_INPUT_REPLAY_HARNESS_H
+#define AAMS_INPUT_REPLAY_HARNESS_H
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "accessibility_event_transmission.h"
+
+namespace OHOS {
+namespace Accessibility {
+class AccessibilityInputEventConsumer;
+
+struct InputTracePointer {
+    int32_t id = 0;
+    int32_t x = 0;
+    int32_t y = 0;
+};
+
+/**
+ * One line of a trace file. Lines are "<time us> <type> ...":
+ *     <time> T <D|M|U> <pointerId> <id>:<x>,<y> [<id>:<x>,<y> ...]   touch event with every finger on screen
+ *     <time> K <D|U> <keyCode>                                         key event
+ *     <time> E                                                         end of the replay
+ * "features <name> ..." selects the interceptor features, '#' starts a comment.
+ */
+struct InputTraceEvent {
+    int64_t time = 0; // us from the start of the trace
+    char type = 'E';
+    int32_t action = 0;
+    int32_t pointerId = 0;
+    int32_t keyCode = 0;
+    std::vector<InputTracePointer> pointers {};
+};
+
+struct InputTrace {
+    std::string name = "";
+    uint32_t features = 0;
+    std::vector<InputTraceEvent> events {};
+};
+
+struct StageLatencyReport {
+    std::string name = "";
+    size_t samples = 0;
+    double p50 = 0; // us
+    double p90 = 0; // us
+    double p99 = 0; // us
+    double max = 0; // us
+    uint64_t allocCount = 0;
+};
+
+struct InputReplayReport {
+    std::vector<StageLatencyReport> stages {};
+    uint64_t replayedCount = 0;
+    uint64_t forwardedCount = 0; // pointer events handed back to the input manager
+    uint32_t zoomInCount = 0;
+    std::vector<int32_t> gestureIds {};
+    int64_t chainTime = 0; // ns spent in the stages
+};
+
+/**
+ * Records the self time and allocations of every stage, fed by the stage probes on the input runner.
+ */
+class InputReplayRecorder {
+public:
+    void Record(const std::string &stage, int64_t selfTime, uint64_t allocCount);
+    void RecordZoomIn();
+    void Clear();
+    InputReplayReport GetReport();
+
+private:
+    struct StageSamples {
+        std::vector<int64_t> selfTimes {}; // ns
+        uint64_t allocCount = 0;
+    };
+
+    std::mutex mutex_;
+    std::vector<std::string> stageOrder_ {};
+    std::map<std::string, StageSamples> stages_ {};
+    uint32_t zoomInCount_ = 0;
+};
+
+/**
+ * Sits in front of one stage of the chain and measures the time the stage spends on an event,
+ * leaving out the time spent in the stages it forwards the event to. With copyEvent the stage gets
+ * a copy of the event instead of the dispatched one, so no stage can share it.
+ */
+class InputReplayStageProbe : public EventTransmission {
+public:
+    InputReplayStageProbe(const std::string &name, const sptr<EventTransmission> &stage,
+        InputReplayRecorder &recorder, bool copyEvent = false);
+    ~InputReplayStageProbe() = default;
+
+    bool OnPointerEvent(MMI::PointerEvent &event) override;
+    bool OnKeyEvent(MMI::KeyEvent &event) override;
+
+private:
+    template<typename Func>
+    bool Measure(Func func);
+
+    std::string name_ = "";
+    InputReplayRecorder &recorder_;
+    bool isZoomGesture_ = false;
+    bool copyEvent_ = false;
+};
+
+/**
+ * Replays a trace through AccessibilityInputInterceptor with the multimodal input mocks.
+ * Event times come from a virtual clock anchored at the start of the replay, so stages always see
+ * the recorded timing. The stage timers are EventHandler events on the input runner, which has no
+ * clock of its own to drive, so the replay sleeps through the recorded gaps between events and a
+ * trace takes as long to replay as it took to record.
+ */
+class AamsInputReplayHarness {
+public:
+    static bool LoadTrace(const std::string &path, InputTrace &trace);
+
+    // copyEvents replays the chain as it was before the stages shared the dispatched event.
+    bool SetUp(const InputTrace &trace, bool copyEvents = false);
+    void Replay(const InputTrace &trace);
+    InputReplayReport GetReport();
+    void TearDown();
+
+private:
+    static bool ParseFeatures(std::istringstream &line, uint32_t &features);
+    static bool ParseEvent(std::istringstream &line, InputTraceEvent &event);
+    void ConnectTouchGuideAbility();
+    void InterposeProbes();
+    sptr<EventTransmission> InterposeChain(const sptr<EventTransmission> &header);
+    void RunOnInputRunner(const std::function<void()> &task);
+    void InjectEvent(const InputTraceEvent &traceEvent, int64_t virtualTime);
+
+    InputReplayRecorder recorder_;
+    uint64_t replayedCount_ = 0;
+    bool copyEvents_ = false;
+    std::shared_ptr<AccessibilityInputEventConsumer> consumer_ = nullptr;
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // AAMS_INPUT_REPLAY_HARNESS_H
@@ -0,0 +1,268 @@
+/*
+ * Copyright (C) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include "aams_input_replay_harness.h"
+#include "accessibility_def.h"
+
+using namespace OHOS;
+using namespace OHOS::Accessibility;
+
+namespace {
+    // Pushed by ohos_test.xml, AAMS_REPLAY_TRACE_DIR points elsewhere for runs on a host.
+    const std::string TRACE_DIR = "/data/test/accessibility/trace/";
+    const char* TRACE_DIR_ENV = "AAMS_REPLAY_TRACE_DIR";
+    constexpr double NS_PER_SECOND = 1000000000.0;
+
+    class AamsInputReplayTest : public benchmark::Fixture {
+    public:
+        AamsInputReplayTest()
+        {
+            Iterations(iterations);
+            Repetitions(repetitions);
+            ReportAggregatesOnly();
+        }
+
+        ~AamsInputReplayTest() override = default;
+
+        void SetUp(const ::benchmark::State &state) override;
+        void TearDown(const ::benchmark::State &) override;
+
+    protected:
+        void Replay(benchmark::State &state, const std::string &traceName,
+            GestureType expectedGestureId = GestureType::GESTURE_INVALID, bool copyEvents = false);
+        void ReportReplay(benchmark::State &state, const InputReplayReport &report);
+
+        const int32_t repetitions = 3;
+        const int32_t iterations = 1;
+        AamsInputReplayHarness harness_;
+    };
+
+    void AamsInputReplayTest::SetUp(const ::benchmark::State &state)
+    {
+    }
+
+    void AamsInputReplayTest::TearDown(const ::benchmark::State &)
+    {
+        harness_.TearDown();
+    }
+
+    void AamsInputReplayTest::Replay(benchmark::State &state, const std::string &traceName,
+        GestureType expectedGestureId, bool copyEvents)
+    {
+        const char* traceDir = std::getenv(TRACE_DIR_ENV);
+        std::string tracePath = (traceDir != nullptr) ? std::string(traceDir) + "/" + traceName :
+            TRACE_DIR + traceName;
+        InputTrace trace;
+        if (!AamsInputReplayHarness::LoadTrace(tracePath, trace)) {
+            state.SkipWithError("The trace can not be loaded.");
+            return;
+        }
+
+        InputReplayReport report;
+        while (state.KeepRunning()) {
+            if (!harness_.SetUp(trace, copyEvents)) {
+                state.SkipWithError("The input interceptor is not ready.");
+                return;
+            }
+            harness_.Replay(trace);
+            report = harness_.GetReport();
+            // Only the time spent in the stages counts, not the recorded gaps between events.
+            state.SetIterationTime(static_cast<double>(report.chainTime) / NS_PER_SECOND);
+        }
+        // The traces of the module test sequences must end with the gesture the module test expects.
+        if (expectedGestureId != GestureType::GESTURE_INVALID &&
+            (report.gestureIds.empty() || report.gestureIds.back() != static_cast<int32_t>(expectedGestureId))) {
+            state.SkipWithError("The recognized gesture differs from the module test.");
+            return;
+        }
+        ReportReplay(state, report);
+    }
+
+    void AamsInputReplayTest::ReportReplay(benchmark::State &state, const InputReplayReport &report)
+    {
+        for (auto &stage : report.stages) {
+            state.counters[stage.name + "_p50(us)"] = stage.p50;
+            state.counters[stage.name + "_p90(us)"] = stage.p90;
+            state.counters[stage.name + "_p99(us)"] = stage.p99;
+            state.counters[stage.name + "_max(us)"] = stage.max;
+            state.counters[stage.name + "_allocs"] = static_cast<double>(stage.allocCount);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(report.replayedCount) * state.iterations());
+        state.counters["replayed"] = static_cast<double>(report.replayedCount);
+        state.counters["forwarded"] = static_cast<double>(report.forwardedCount);
+        state.counters["gestures"] = static_cast<double>(report.gestureIds.size());
+        state.counters["lastGestureId"] = report.gestureIds.empty() ? 0 :
+            static_cast<double>(report.gestureIds.back());
+        state.counters["zoomIn"] = static_cast<double>(report.zoomInCount);
+    }
+
+    /**
+     * @tc.name: ExploreByTouchTestCase
+     * @tc.desc: Testcase for replaying a finger exploring a list, followed by a key press.
+     * @tc.type: PERF
+     * @tc.require: Issue Number
+     */
+    BENCHMARK_DEFINE_F(AamsInputReplayTest, ExploreByTouchTestCase)(
+        benchmark::State &state)
+    {
+        Replay(state, "explore_by_touch.trace");
+    }
+
+    /**
+     * @tc.name: TripleTapZoomTestCase
+     * @tc.desc: Testcase for replaying a triple tap that zooms the screen in.
+     * @tc.type: PERF
+     * @tc.require: Issue Number
+     */
+    BENCHMARK_DEFINE_F(AamsInputReplayTest, TripleTapZoomTestCase)(
+        benchmark::State &state)
+    {
+        Replay(state, "triple_tap_zoom.trace");
+    }
+
+    /**
+     * @tc.name: TripleTapZoomCopiedTestCase
+     * @tc.desc: Testcase for replaying the triple tap with the zoom gesture copying the events it caches,
+     *           the baseline of TripleTapZoomTestCase.
+     * @tc.type: PERF
+     * @tc.require: Issue Number
+     */
+    BENCHMARK_DEFINE_F(AamsInputReplayTest, TripleTapZoomCopiedTestCase)(
+        benchmark::State &state)
+    {
+        Replay(state, "triple_tap_zoom.trace", GestureType::GESTURE_INVALID, true);
+    }
+
+    /**
+     * @tc.name: TwoFingerSwipeZoomTestCase
+     * @tc.desc: Testcase for replaying a two finger swipe up through the zoom gesture and the touch guider.
+     * @tc.type: PERF
+     * @tc.require: Issue Number
+     */
+    BENCHMARK_DEFINE_F(AamsInputReplayTest, TwoFingerSwipeZoomTestCase)(
+        benchmark::State &state)
+    {
+        Replay(state, "two_finger_swipe_zoom.trace");
+    }
+
+    /**
+     * @tc.name: TwoFingerSwipeZoomCopiedTestCase
+     * @tc.desc: Testcase for replaying the two finger swipe with the zoom gesture copying the events it caches,
+     *           the baseline of TwoFingerSwipeZoomTestCase.
+     * @tc.type: PERF
+     * @tc.require: Issue Number
+     */
+    BENCHMARK_DEFINE_F(AamsInputReplayTest, TwoFingerSwipeZoomCopiedTestCase)(
+        benchmark::State &state)
+    {
+        Replay(state, "two_finger_swipe_zoom.trace", GestureType::GESTURE_INVALID, true);
+    }
+
+    /**
+     * @tc.name: TwoFingerSwipeTestCase
+     * @tc.desc: Testcase for replaying a two finger swipe up.
+     * @tc.type: PERF
+     * @tc.require: Issue Number
+     */
+    BENCHMARK_DEFINE_F(AamsInputReplayTest, TwoFingerSwipeTestCase)(
+        benchmark::State &state)
+    {
+        Replay(state, "two_finger_swipe.trace");
+    }
+
+    /**
+     * @tc.name: TwoFingerDoubleTapTestCase
+     * @tc.desc: Testcase for replaying a two finger double tap from the module test.
+     * @tc.type: PERF
+     * @tc.require: Issue Number
+     */
+    BENCHMARK_DEFINE_F(AamsInputReplayTest, TwoFingerDoubleTapTestCase)(
+        benchmark::State &state)
+    {
+        Replay(state, "two_finger_double_tap.trace", GestureType::GESTURE_TWO_FINGER_DOUBLE_TAP);
+    }
+
+    /**
+     * @tc.name: ThreeFingerDoubleTapTestCase
+     * @tc.desc: Testcase for replaying a three finger double tap from the module test.
+     * @tc.type: PERF
+     * @tc.require: Issue Number
+     */
+    BENCHMARK_DEFINE_F(AamsInputReplayTest, ThreeFingerDoubleTapTestCase)(
+        benchmark::State &state)
+    {
+        Replay(state, "three_finger_double_tap.trace", GestureType::GESTURE_THREE_FINGER_DOUBLE_TAP);
+    }
+
+    /**
+     * @tc.name: FourFingerTripleTapTestCase
+     * @tc.desc: Testcase for replaying a four finger triple tap from the module test.
+     * @tc.type: PERF
+     * @tc.require: Issue Number
+     */
+    BENCHMARK_DEFINE_F(AamsInputReplayTest, FourFingerTripleTapTestCase)(
+        benchmark::State &state)
+    {
+        Replay(state, "four_finger_triple_tap.trace", GestureType::GESTURE_FOUR_FINGER_TRIPLE_TAP);
+    }
+
+    /**
+     * @tc.name: ThreeFingerSwipeDownTestCase
+     * @tc.desc: Testcase for replaying a three finger swipe down from the module test.
+     * @tc.type: PERF
+     * @tc.require: Issue Number
+     */
+    BENCHMARK_DEFINE_F(AamsInputReplayTest, ThreeFingerSwipeDownTestCase)(
+        benchmark::State &state)
+    {
+        Replay(state, "three_finger_swipe_down.trace", GestureType::GESTURE_THREE_FINGER_SWIPE_DOWN);
+    }
+
+    /**
+     * @tc.name: FourFingerSwipeLeftTestCase
+     * @tc.desc: Testcase for replaying a four finger swipe left from the module test.
+     * @tc.type: PERF
+     * @tc.require: Issue Number
+     */
+    BENCHMARK_DEFINE_F(AamsInputReplayTest, FourFingerSwipeLeftTestCase)(
+        benchmark::State &state)
+    {
+        Replay(state, "four_finger_swipe_left.trace", GestureType::GESTURE_FOUR_FINGER_SWIPE_LEFT);
+    }
+
+    BENCHMARK_REGISTER_F(AamsInputReplayTest, ExploreByTouchTestCase)->UseManualTime()->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(AamsInputReplayTest, TripleTapZoomTestCase)->UseManualTime()->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(AamsInputReplayTest, TripleTapZoomCopiedTestCase)
+        ->UseManualTime()->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(AamsInputReplayTest, TwoFingerSwipeZoomTestCase)
+        ->UseManualTime()->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(AamsInputReplayTest, TwoFingerSwipeZoomCopiedTestCase)
+        ->UseManualTime()->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(AamsInputReplayTest, TwoFingerSwipeTestCase)->UseManualTime()->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(AamsInputReplayTest, TwoFingerDoubleTapTestCase)
+        ->UseManualTime()->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(AamsInputReplayTest, ThreeFingerDoubleTapTestCase)
+        ->UseManualTime()->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(AamsInputReplayTest, FourFingerTripleTapTestCase)
+        ->UseManualTime()->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(AamsInputReplayTest, ThreeFingerSwipeDownTestCase)
+        ->UseManualTime()->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(AamsInputReplayTest, FourFingerSwipeLeftTestCase)
+        ->UseManualTime()->Unit(benchmark::kMicrosecond);
+}
+
+BENCHMARK_MAIN();
@@ -67,6 +67,21 @@ public:
     {
         mTgestureId_ = gestureId;
     }
+    std::vector<int32_t> GetGestureIds()
+    {
+        std::lock_guard<ffrt::mutex> lock(mtx_);
+        return mTgestureIds_;
+    }
+    void PushGestureId(int32_t gestureId)
+    {
+        std::lock_guard<ffrt::mutex> lock(mtx_);
+        mTgestureIds_.push_back(gestureId);
+    }
+    void ClearGestureIds()
+    {
+        std::lock_guard<ffrt::mutex> lock(mtx_);
+        mTgestureIds_.clear();
+    }
     OHOS::sptr<OHOS::Accessibility::IAccessibleAbilityChannel>& GetTestStub()
     {
         return testStub_;
@@ -146,6 +161,7 @@ private:
     OHOS::sptr<OHOS::Accessibility::IAccessibleAbilityChannel> testStub_ = nullptr;
     std::vector<EventType> mTeventType_ = {};
     int32_t mTgestureId_ = 0;
+    std::vector<int32_t> mTgestureIds_ = {};
     uint32_t testStateType_ = 0;
     int32_t testEventType_ = 0;
     int32_t testWindowChangeTypes_ = 0;
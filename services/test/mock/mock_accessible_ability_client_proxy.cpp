@@ -51,6 +51,7 @@ void AccessibleAbilityClientProxy::OnAccessibilityEvent(const AccessibilityEvent
     int32_t gestureId = static_cast<int32_t>(eventInfo.GetGestureType());
     if (gestureId != 0) {
         AccessibilityHelper::GetInstance().SetGestureId(gestureId);
+        AccessibilityHelper::GetInstance().PushGestureId(gestureId);
     }
     AccessibilityHelper::GetInstance().SetTestWindowId(eventInfo.GetWindowId());
     AccessibilityHelper::GetInstance().SetTestWindowChangeTypes(eventInfo.GetWindowChangeTypes());
@@ -61,6 +61,14 @@ RetError MockAccessibleAbilityManagerServiceStub::SendEvent(const AccessibilityE
     return RET_OK;
 }
 
+RetError MockAccessibleAbilityManagerServiceStub::SendEvents(const std::vector<AccessibilityEventInfo> &uiEvents,
+    const int32_t flag)
+{
+    (void)uiEvents;
+    (void)flag;
+    return RET_OK;
+}
+
 RetError MockAccessibleAbilityManagerServiceStub::SetCaptionProperty(
     const AccessibilityConfig::CaptionProperty &caption)
 {
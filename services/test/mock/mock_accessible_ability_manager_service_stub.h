@@ -36,6 +36,8 @@ public:
 
     RetError SendEvent(const AccessibilityEventInfo &uiEvent, const int32_t flag) override;
 
+    RetError SendEvents(const std::vector<AccessibilityEventInfo> &uiEvents, const int32_t flag) override;
+
     uint32_t RegisterStateObserver(const sptr<IAccessibleAbilityManagerStateObserver> &callback) override;
 
     uint32_t RegisterCaptionObserver(const sptr<IAccessibleAbilityManagerCaptionObserver> &callback) override;